@@ -0,0 +1,209 @@
+#include <cstring>
+#include "BitStream.h"
+
+int BitsRequired(uint32_t range)
+{
+	int bits = 0;
+	while (range != 0)
+	{
+		++bits;
+		range >>= 1;
+	}
+	return bits;
+}
+
+void BitWriter::Clear()
+{
+	buffer.clear();
+	scratch = 0;
+	scratchBits = 0;
+}
+
+void BitWriter::WriteBits(uint32_t value, int bits)
+{
+	if (bits < 32)
+		value &= (1u << bits) - 1;
+	scratch |= (uint64_t)value << scratchBits;
+	scratchBits += bits;
+	while (scratchBits >= 8)
+	{
+		buffer.push_back((char)(scratch & 0xFF));
+		scratch >>= 8;
+		scratchBits -= 8;
+	}
+}
+
+void BitWriter::WriteRanged(int32_t value, int32_t min, int32_t max)
+{
+	if (value < min)
+		value = min;
+	if (value > max)
+		value = max;
+	int bits = BitsRequired((uint32_t)max - (uint32_t)min);
+	if (bits > 0)
+		WriteBits((uint32_t)value - (uint32_t)min, bits);
+}
+
+void BitWriter::WriteVarint(uint32_t value)
+{
+	while (value >= 0x80)
+	{
+		WriteBits((value & 0x7F) | 0x80, 8);
+		value >>= 7;
+	}
+	WriteBits(value, 8);
+}
+
+void BitWriter::WriteSignedVarint(int32_t value)
+{	// zigzag, so small negative values stay small too
+	WriteVarint(((uint32_t)value << 1) ^ (uint32_t)(value >> 31));
+}
+
+void BitWriter::WriteQuantized(float value, float min, float max, int bits)
+{
+	uint32_t steps = bits < 32 ? (1u << bits) - 1 : 0xFFFFFFFFu;
+	float unit = (value - min) / (max - min);
+	uint32_t quantized;
+	if (!(unit > 0.0f))		// also catches NaN
+		quantized = 0;
+	else if (unit >= 1.0f)
+		quantized = steps;
+	else
+		quantized = (uint32_t)((double)unit * steps + 0.5);
+	WriteBits(quantized, bits);
+}
+
+void BitWriter::WriteFloat(float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	WriteBits(bits, 32);
+}
+
+void BitWriter::WriteString(const std::string& value, int maxLength)
+{
+	int length = value.size() < (size_t)maxLength ? (int)value.size() : maxLength;
+	WriteRanged(length, 0, maxLength);
+	for (int i = 0; i < length; ++i)
+		WriteBits((uint8_t)value[i], 8);
+}
+
+void BitWriter::Rewind(size_t bitPosition)
+{
+	if (bitPosition >= BitPosition())
+		return;
+
+	size_t bytes = bitPosition / 8;
+	int rest = (int)(bitPosition % 8);
+	if (bytes < buffer.size())
+	{	// the bits kept of the byte cut off go back to scratch
+		scratch = (uint8_t)buffer[bytes];
+		buffer.resize(bytes);
+	}
+	scratch &= ((uint64_t)1 << rest) - 1;
+	scratchBits = rest;
+}
+
+void BitWriter::Flush()
+{
+	if (scratchBits > 0)
+		WriteBits(0, 8 - scratchBits);
+}
+
+BitReader::BitReader(const char* data, size_t size)
+	: data((const uint8_t*)data), size(size), position(0), usedBits(0), failed(false)
+{
+}
+
+uint32_t BitReader::ReadBits(int bits)
+{
+	if ((size_t)bits > BitsLeft())
+	{
+		failed = true;
+		position = size;
+		usedBits = 0;
+		return 0;
+	}
+
+	uint64_t value = 0;
+	int read = 0;
+	while (read < bits)
+	{
+		int take = 8 - usedBits;
+		if (take > bits - read)
+			take = bits - read;
+		uint32_t chunk = (data[position] >> usedBits) & ((1u << take) - 1);
+		value |= (uint64_t)chunk << read;
+		read += take;
+		usedBits += take;
+		if (usedBits == 8)
+		{
+			++position;
+			usedBits = 0;
+		}
+	}
+	return (uint32_t)value;
+}
+
+int32_t BitReader::ReadRanged(int32_t min, int32_t max)
+{
+	int bits = BitsRequired((uint32_t)max - (uint32_t)min);
+	if (bits == 0)
+		return min;
+	int32_t value = (int32_t)((uint32_t)min + ReadBits(bits));
+	// a writer never sends more than max; treat it as corrupt rather than trust it
+	if (value < min || value > max)
+	{
+		failed = true;
+		return min;
+	}
+	return value;
+}
+
+uint32_t BitReader::ReadVarint()
+{
+	uint32_t value = 0;
+	for (int shift = 0; shift < 35; shift += 7)
+	{
+		uint32_t group = ReadBits(8);
+		value |= (group & 0x7F) << shift;
+		if ((group & 0x80) == 0)
+			return value;
+	}
+	failed = true;
+	return 0;
+}
+
+int32_t BitReader::ReadSignedVarint()
+{
+	uint32_t value = ReadVarint();
+	return (int32_t)((value >> 1) ^ (0u - (value & 1)));
+}
+
+float BitReader::ReadQuantized(float min, float max, int bits)
+{
+	uint32_t steps = bits < 32 ? (1u << bits) - 1 : 0xFFFFFFFFu;
+	return (float)((double)ReadBits(bits) / steps * (max - min) + min);
+}
+
+float BitReader::ReadFloat()
+{
+	uint32_t bits = ReadBits(32);
+	float value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+bool BitReader::ReadString(std::string& value, int maxLength)
+{
+	int length = ReadRanged(0, maxLength);
+	if ((size_t)length * 8 > BitsLeft())
+	{
+		failed = true;
+		return false;
+	}
+	value.resize(length);
+	for (int i = 0; i < length; ++i)
+		value[i] = (char)ReadBits(8);
+	return !failed;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+// Bit-level encoding for messages on the game state path, where protobuf's byte-aligned varints
+// and per-field tags cost more than the values. Bits are written least significant first into a
+// little-endian byte stream; the last byte is padded with zeros.
+class BitWriter {
+public:
+	BitWriter() : scratch(0), scratchBits(0) {}
+
+	void Clear();
+	// the low bits of value, 1..32 of them
+	void WriteBits(uint32_t value, int bits);
+	void WriteBool(bool value) { WriteBits(value ? 1 : 0, 1); }
+	// value clamped to min..max, in as few bits as that range needs
+	void WriteRanged(int32_t value, int32_t min, int32_t max);
+	// 7 bits at a time behind a continuation bit, so small values stay small
+	void WriteVarint(uint32_t value);
+	void WriteSignedVarint(int32_t value);
+	// value clamped to min..max and rounded to one of 2^bits evenly spaced steps
+	void WriteQuantized(float value, float min, float max, int bits);
+	void WriteFloat(float value);
+	// at most maxLength bytes of it, behind a length of WriteRanged(0, maxLength)
+	void WriteString(const std::string& value, int maxLength);
+
+	// bits written so far, and taking back everything written after such a point
+	size_t BitPosition() const { return buffer.size() * 8 + (size_t)scratchBits; }
+	void Rewind(size_t bitPosition);
+
+	// Pads out the last byte. Data and Size cover everything written once this is called.
+	void Flush();
+	const char* Data() const { return buffer.data(); }
+	size_t Size() const { return buffer.size(); }
+
+private:
+	std::string buffer;		// kept between messages, so its storage is reused
+	uint64_t scratch;		// bits not yet in buffer
+	int scratchBits;
+};
+
+// Reads what BitWriter wrote with the same calls in the same order. Reading past the end yields
+// zeros and sets Failed, so a message is decoded first and checked once.
+class BitReader {
+public:
+	BitReader(const char* data, size_t size);
+
+	uint32_t ReadBits(int bits);
+	bool ReadBool() { return ReadBits(1) != 0; }
+	int32_t ReadRanged(int32_t min, int32_t max);
+	uint32_t ReadVarint();
+	int32_t ReadSignedVarint();
+	float ReadQuantized(float min, float max, int bits);
+	float ReadFloat();
+	bool ReadString(std::string& value, int maxLength);
+
+	bool Failed() const { return failed; }
+	// bits left, counting the padding of the last byte
+	size_t BitsLeft() const { return (size - position) * 8 - (size_t)usedBits; }
+
+private:
+	const uint8_t* data;
+	size_t size;
+	size_t position;	// byte being read
+	int usedBits;		// bits of it already read
+	bool failed;
+};
+
+// bits needed to write any of range + 1 values
+int BitsRequired(uint32_t range);
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "Platform.h"
+#ifndef _WIN32
+#include <deque>
+#endif
+#ifdef USE_IO_URING
+#include <liburing.h>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+// One outstanding receive or send. On Windows the OVERLAPPED is handed to the kernel,
+// so IoRequest must stay the first member of whatever embeds it (see IOInfo).
+struct IoRequest {
+#ifdef _WIN32
+	OVERLAPPED overlapped;
+#endif
+	WSABUF* buffers;
+	DWORD bufferCount;
+	DWORD transferred;
+
+	IoRequest() : buffers(nullptr), bufferCount(0), transferred(0) {
+#ifdef _WIN32
+		ZeroMemory(&overlapped, sizeof(OVERLAPPED));
+#endif
+	}
+};
+
+// An outstanding accept on a listening socket. The accepted socket and peer address are
+// filled in by the time the completion is dequeued and CompleteAccept has run.
+struct AcceptRequest {
+	IoRequest request;
+	SOCKET acceptSocket;
+	SOCKADDR_IN clntAdr;
+#ifdef _WIN32
+	char addrBuf[2 * (sizeof(SOCKADDR_IN) + 16)];
+#endif
+
+	AcceptRequest() : acceptSocket(INVALID_SOCKET) {
+		ZeroMemory(&clntAdr, sizeof(clntAdr));
+	}
+};
+
+// completions taken from the kernel in one DequeueBatch at most
+#define MAX_DEQUEUE_BATCH 256
+
+struct CompletionEntry {
+	bool success;
+	DWORD dwBytesTransferred;
+	ULONG_PTR completionKey;
+	IoRequest* lpRequest;
+
+	CompletionEntry() : success(false), dwBytesTransferred(0), completionKey(0), lpRequest(nullptr) {}
+};
+
+// Completion-queue engine: requests are posted per socket and come back through Dequeue
+// together with the key the socket was associated with.
+// IOCP is used on Windows, edge-triggered epoll elsewhere, io_uring when built with USE_IO_URING.
+class CompletionPort {
+public:
+	CompletionPort();
+	~CompletionPort();
+
+	bool Create(int maxNumberOfThreads = 0);
+	void Close();
+
+	bool Associate(SOCKET sock, ULONG_PTR completionKey);
+	void Dissociate(SOCKET sock);
+
+	// Queues a user completion, e.g. KILL_THREAD or a Room broadcast job.
+	bool Post(DWORD dwBytesTransferred, ULONG_PTR completionKey, IoRequest* lpRequest = nullptr);
+	bool Dequeue(CompletionEntry& entry, DWORD dwMilliseconds = INFINITE);
+	// Waits for at least one completion, then takes whatever else is ready, up to maxEntries
+	// (GetQueuedCompletionStatusEx, one epoll_wait, or the CQEs already posted).
+	// Each entry carries its own success flag. Returns 0 on timeout or error.
+	int DequeueBatch(CompletionEntry* entries, int maxEntries, DWORD dwMilliseconds = INFINITE);
+
+public:
+	static bool PostRecv(SOCKET sock, IoRequest* lpRequest);
+	static bool PostSend(SOCKET sock, IoRequest* lpRequest);
+	static bool PostAccept(SOCKET listenSock, AcceptRequest* lpRequest);
+	// Finishes a dequeued accept: inherits listener options and resolves the peer address.
+	static bool CompleteAccept(SOCKET listenSock, AcceptRequest* lpRequest);
+
+	// Sends posted by this thread between Begin and Flush may be handed to the kernel together.
+	// Only io_uring defers anything; the other backends issue each send as it is posted.
+	static void BeginSendBatch();
+	static void FlushSendBatch();
+
+private:
+#if defined(_WIN32)
+	HANDLE hCompPort;
+#elif defined(USE_IO_URING)
+	io_uring ring;
+	bool ringInitialized;
+	bool filesRegistered;
+	CRITICAL_SECTION csForSubmit;
+
+	// One worker at a time reaps the completion queue. It keeps a batch for itself and queues
+	// the rest in readyQueue, where the other workers wait for them.
+	std::atomic<bool> reaping;
+	int concurrency;	// waiting workers one reap wakes at most, Create's maxNumberOfThreads
+	__kernel_timespec reapTimeout;	// read by the kernel when the timeout SQE is submitted
+	std::deque<CompletionEntry> readyQueue;
+	std::mutex readyLock;
+	std::condition_variable readyCond;
+
+	bool SetupSocketResources();
+	io_uring_sqe* GetSqe();
+	void Submit();
+	void PrepRecv(struct UringSocket* us, IoRequest* lpRequest);
+	void PrepSend(struct UringSocket* us, IoRequest* lpRequest);
+	void PrepAccept(struct UringSocket* us);
+	bool HandleCqe(io_uring_cqe* cqe, CompletionEntry& entry);
+	int PopReady(CompletionEntry* entries, int maxEntries);
+	void PushReady(const CompletionEntry& entry);
+	int Reap(CompletionEntry* entries, int maxEntries, DWORD dwMilliseconds);
+#else
+	int epollFd;
+	int eventFd;
+	// Completions produced outside epoll_wait (posted, or finished inline by PostRecv/PostSend).
+	// eventFd holds one token per queued entry.
+	std::deque<CompletionEntry> readyQueue;
+	CRITICAL_SECTION csForReadyQueue;
+
+public:
+	void PushReady(const CompletionEntry& entry);
+
+private:
+	int PopReady(CompletionEntry* entries, int maxEntries);
+#endif
+};
@@ -0,0 +1,541 @@
+#if !defined(_WIN32) && !defined(USE_IO_URING)
+
+#include "CompletionPort.h"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/resource.h>
+#include <sys/uio.h>
+#include <ctime>
+#include <atomic>
+#include <deque>
+#include <cassert>
+
+// Edge-triggered epoll emulation of IOCP. A posted receive or send is attempted at once;
+// if the socket would block, it is parked on the descriptor and finished by whichever
+// worker sees the next edge. Either way the result comes back through Dequeue.
+
+#define MAX_IOV 64
+
+struct EpollSocket {
+	CRITICAL_SECTION cs;
+	SOCKET sock;
+	CompletionPort* port;
+	ULONG_PTR completionKey;
+	IoRequest* recvRequest;
+	IoRequest* sendRequest;
+	std::deque<AcceptRequest*> acceptRequests;
+
+	EpollSocket() : sock(INVALID_SOCKET), port(nullptr), completionKey(0), recvRequest(nullptr), sendRequest(nullptr) {
+		InitializeCriticalSection(&cs);
+	}
+};
+
+enum IoResult {
+	IO_COMPLETED,
+	IO_PENDING,
+	IO_FAILED
+};
+
+// Entries are indexed by descriptor and reused, never freed, so an event that races
+// with Dissociate finds a quiet entry rather than freed memory.
+static std::atomic<EpollSocket*>* socketTable = nullptr;
+static size_t socketTableSize = 0;
+
+static void InitSocketTable()
+{
+	static bool initialized = [] {
+		rlimit rl;
+		socketTableSize = 65536;
+		if (getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur != RLIM_INFINITY && rl.rlim_cur > socketTableSize)
+			socketTableSize = rl.rlim_cur < (1 << 20) ? (size_t)rl.rlim_cur : (1 << 20);
+		socketTable = new std::atomic<EpollSocket*>[socketTableSize]();
+		return true;
+	}();
+	(void)initialized;
+}
+
+static EpollSocket* GetEpollSocket(SOCKET sock, bool create)
+{
+	if (sock < 0 || (size_t)sock >= socketTableSize)
+		return nullptr;
+
+	EpollSocket* es = socketTable[sock].load(std::memory_order_acquire);
+	if (es == nullptr && create)
+	{
+		EpollSocket* fresh = new EpollSocket();
+		if (socketTable[sock].compare_exchange_strong(es, fresh))
+			es = fresh;
+		else
+			delete fresh;
+	}
+	return es;
+}
+
+static int ToIovec(IoRequest* lpRequest, iovec* iov)
+{	// skips what a partial send already wrote
+	assert(lpRequest->bufferCount <= MAX_IOV);
+	DWORD skip = lpRequest->transferred;
+	int count = 0;
+	for (DWORD i = 0; i < lpRequest->bufferCount; ++i)
+	{
+		WSABUF& wsaBuf = lpRequest->buffers[i];
+		if (skip >= wsaBuf.len)
+		{
+			skip -= wsaBuf.len;
+			continue;
+		}
+		iov[count].iov_base = wsaBuf.buf + skip;
+		iov[count].iov_len = wsaBuf.len - skip;
+		skip = 0;
+		count++;
+	}
+	return count;
+}
+
+static IoResult TryRecv(SOCKET sock, IoRequest* lpRequest, CompletionEntry& entry)
+{
+	iovec iov[MAX_IOV];
+	int count = ToIovec(lpRequest, iov);
+
+	ssize_t rtn;
+	while ((rtn = readv(sock, iov, count)) < 0 && errno == EINTR);
+	if (rtn < 0)
+	{
+		if (errno == EAGAIN || errno == EWOULDBLOCK)
+			return IO_PENDING;
+		entry.success = false;
+		entry.dwBytesTransferred = 0;
+		entry.lpRequest = lpRequest;
+		return IO_FAILED;
+	}
+
+	// 0 bytes means the peer closed, exactly like a zero-byte IOCP receive
+	entry.success = true;
+	entry.dwBytesTransferred = (DWORD)rtn;
+	entry.lpRequest = lpRequest;
+	return IO_COMPLETED;
+}
+
+static IoResult TrySend(SOCKET sock, IoRequest* lpRequest, CompletionEntry& entry)
+{
+	iovec iov[MAX_IOV];
+	msghdr msg;
+	memset(&msg, 0, sizeof(msg));
+
+	while (true)
+	{
+		msg.msg_iov = iov;
+		msg.msg_iovlen = ToIovec(lpRequest, iov);
+		if (msg.msg_iovlen == 0)
+			break;
+
+		ssize_t rtn = sendmsg(sock, &msg, MSG_NOSIGNAL);
+		if (rtn < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				return IO_PENDING;
+			entry.success = false;
+			entry.dwBytesTransferred = 0;
+			entry.lpRequest = lpRequest;
+			return IO_FAILED;
+		}
+		lpRequest->transferred += (DWORD)rtn;
+	}
+
+	entry.success = true;
+	entry.dwBytesTransferred = lpRequest->transferred;
+	entry.lpRequest = lpRequest;
+	return IO_COMPLETED;
+}
+
+static IoResult TryAccept(SOCKET listenSock, AcceptRequest* lpRequest, CompletionEntry& entry)
+{
+	socklen_t clntAdrSz = sizeof(lpRequest->clntAdr);
+	SOCKET sock;
+	while ((sock = accept4(listenSock, (SOCKADDR*)&lpRequest->clntAdr, &clntAdrSz, SOCK_CLOEXEC)) == INVALID_SOCKET
+		&& (errno == EINTR || errno == ECONNABORTED));
+	if (sock == INVALID_SOCKET)
+	{
+		if (errno == EAGAIN || errno == EWOULDBLOCK)
+			return IO_PENDING;
+		entry.success = false;
+		entry.dwBytesTransferred = 0;
+		entry.lpRequest = &lpRequest->request;
+		return IO_FAILED;
+	}
+
+	lpRequest->acceptSocket = sock;
+	entry.success = true;
+	entry.dwBytesTransferred = 0;
+	entry.lpRequest = &lpRequest->request;
+	return IO_COMPLETED;
+}
+
+static int HandleSocketEvents(EpollSocket* es, uint32_t events, CompletionEntry* entries, int maxEntries)
+{
+	int produced = 0;
+	CompletionEntry completion;
+
+	// completions go back to the caller while there is room, the rest through the ready queue
+	auto emit = [&](CompletionPort* port) {
+		completion.completionKey = es->completionKey;
+		if (produced < maxEntries)
+			entries[produced++] = completion;
+		else
+			port->PushReady(completion);
+	};
+
+	EnterCriticalSection(&es->cs);
+	CompletionPort* port = es->port;
+	if (port != nullptr)
+	{
+		if ((events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) && es->recvRequest != nullptr)
+		{
+			if (TryRecv(es->sock, es->recvRequest, completion) != IO_PENDING)
+			{
+				es->recvRequest = nullptr;
+				emit(port);
+			}
+		}
+		if ((events & (EPOLLOUT | EPOLLHUP | EPOLLERR)) && es->sendRequest != nullptr)
+		{
+			if (TrySend(es->sock, es->sendRequest, completion) != IO_PENDING)
+			{
+				es->sendRequest = nullptr;
+				emit(port);
+			}
+		}
+		// one edge may stand for many queued connections: serve parked accepts until EAGAIN
+		while ((events & EPOLLIN) && !es->acceptRequests.empty())
+		{
+			if (TryAccept(es->sock, es->acceptRequests.front(), completion) == IO_PENDING)
+				break;
+			es->acceptRequests.pop_front();
+			emit(port);
+		}
+	}
+	LeaveCriticalSection(&es->cs);
+
+	return produced;
+}
+
+CompletionPort::CompletionPort()
+{
+	epollFd = -1;
+	eventFd = -1;
+	InitializeCriticalSection(&csForReadyQueue);
+}
+
+CompletionPort::~CompletionPort()
+{
+	Close();
+	DeleteCriticalSection(&csForReadyQueue);
+}
+
+bool CompletionPort::Create(int maxNumberOfThreads)
+{	// IOCP's concurrency limit has no counterpart: every worker blocks in epoll_wait itself
+	(void)maxNumberOfThreads;
+	InitSocketTable();
+
+	epollFd = epoll_create1(EPOLL_CLOEXEC);
+	if (epollFd == -1)
+		return false;
+
+	eventFd = eventfd(0, EFD_NONBLOCK | EFD_SEMAPHORE | EFD_CLOEXEC);
+	if (eventFd == -1)
+	{
+		Close();
+		return false;
+	}
+
+	epoll_event ev;
+	ev.events = EPOLLIN;
+	ev.data.ptr = nullptr;
+	if (epoll_ctl(epollFd, EPOLL_CTL_ADD, eventFd, &ev) == -1)
+	{
+		Close();
+		return false;
+	}
+	return true;
+}
+
+void CompletionPort::Close()
+{
+	if (eventFd != -1)
+		close(eventFd);
+	if (epollFd != -1)
+		close(epollFd);
+	eventFd = epollFd = -1;
+}
+
+bool CompletionPort::Associate(SOCKET sock, ULONG_PTR completionKey)
+{
+	EpollSocket* es = GetEpollSocket(sock, true);
+	if (es == nullptr)
+	{
+		errno = EBADF;
+		return false;
+	}
+
+	int flags = fcntl(sock, F_GETFL, 0);
+	if (flags == -1 || fcntl(sock, F_SETFL, flags | O_NONBLOCK) == -1)
+		return false;
+
+	EnterCriticalSection(&es->cs);
+	es->sock = sock;
+	es->port = this;
+	es->completionKey = completionKey;
+	es->recvRequest = nullptr;
+	es->sendRequest = nullptr;
+	es->acceptRequests.clear();
+
+	epoll_event ev;
+	ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+	ev.data.ptr = es;
+	bool rtn = epoll_ctl(epollFd, EPOLL_CTL_ADD, sock, &ev) == 0;
+	if (!rtn)
+		es->port = nullptr;
+	LeaveCriticalSection(&es->cs);
+	return rtn;
+}
+
+void CompletionPort::Dissociate(SOCKET sock)
+{
+	EpollSocket* es = GetEpollSocket(sock, false);
+	if (es == nullptr)
+		return;
+
+	EnterCriticalSection(&es->cs);
+	if (es->port == this)
+	{
+		epoll_ctl(epollFd, EPOLL_CTL_DEL, sock, NULL);
+		// like closesocket() on IOCP, parked requests still complete, aborted
+		CompletionEntry aborted;
+		aborted.completionKey = es->completionKey;
+		if (es->recvRequest != nullptr)
+		{
+			aborted.lpRequest = es->recvRequest;
+			PushReady(aborted);
+		}
+		if (es->sendRequest != nullptr)
+		{
+			aborted.lpRequest = es->sendRequest;
+			PushReady(aborted);
+		}
+		es->port = nullptr;
+		es->recvRequest = nullptr;
+		es->sendRequest = nullptr;
+		es->acceptRequests.clear();
+	}
+	LeaveCriticalSection(&es->cs);
+}
+
+bool CompletionPort::Post(DWORD dwBytesTransferred, ULONG_PTR completionKey, IoRequest* lpRequest)
+{
+	CompletionEntry entry;
+	entry.success = true;
+	entry.dwBytesTransferred = dwBytesTransferred;
+	entry.completionKey = completionKey;
+	entry.lpRequest = lpRequest;
+	PushReady(entry);
+	return true;
+}
+
+void CompletionPort::PushReady(const CompletionEntry& entry)
+{
+	EnterCriticalSection(&csForReadyQueue);
+	readyQueue.push_back(entry);
+	LeaveCriticalSection(&csForReadyQueue);
+
+	uint64_t token = 1;
+	while (write(eventFd, &token, sizeof(token)) < 0 && errno == EINTR);
+}
+
+int CompletionPort::PopReady(CompletionEntry* entries, int maxEntries)
+{
+	int count = 0;
+	EnterCriticalSection(&csForReadyQueue);
+	for (; count < maxEntries && !readyQueue.empty(); ++count)
+	{
+		entries[count] = readyQueue.front();
+		readyQueue.pop_front();
+	}
+	LeaveCriticalSection(&csForReadyQueue);
+	return count;
+}
+
+static long long NowMillis()
+{
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+bool CompletionPort::Dequeue(CompletionEntry& entry, DWORD dwMilliseconds)
+{
+	entry = CompletionEntry();
+	if (DequeueBatch(&entry, 1, dwMilliseconds) == 0)
+		return false;
+	return entry.success;
+}
+
+int CompletionPort::DequeueBatch(CompletionEntry* entries, int maxEntries, DWORD dwMilliseconds)
+{
+	long long deadline = (dwMilliseconds == INFINITE) ? -1 : NowMillis() + dwMilliseconds;
+	epoll_event events[MAX_DEQUEUE_BATCH];
+	if (maxEntries > MAX_DEQUEUE_BATCH)
+		maxEntries = MAX_DEQUEUE_BATCH;
+
+	int count = 0;
+	while (count == 0)
+	{
+		int timeout = -1;
+		if (deadline != -1)
+		{
+			long long remain = deadline - NowMillis();
+			timeout = remain > 0 ? (int)remain : 0;
+		}
+
+		int rtn = epoll_wait(epollFd, events, maxEntries, timeout);
+		if (rtn < 0 && errno == EINTR)
+			continue;
+		if (rtn <= 0)
+		{
+			if (rtn == 0)
+				errno = ETIMEDOUT;
+			return 0;
+		}
+
+		for (int i = 0; i < rtn; ++i)
+		{
+			if (events[i].data.ptr == nullptr)
+			{	// a token for the ready queue; another worker may have taken it first.
+				// Left unread once the batch is full, so the entry it stands for still wakes someone.
+				uint64_t token;
+				if (count < maxEntries && read(eventFd, &token, sizeof(token)) == sizeof(token))
+					count += PopReady(entries + count, maxEntries - count);
+				continue;
+			}
+			count += HandleSocketEvents((EpollSocket*)events[i].data.ptr, events[i].events,
+				entries + count, maxEntries - count);
+		}
+	}
+	return count;
+}
+
+bool CompletionPort::PostRecv(SOCKET sock, IoRequest* lpRequest)
+{
+	EpollSocket* es = GetEpollSocket(sock, false);
+	if (es == nullptr)
+	{
+		errno = EBADF;
+		return false;
+	}
+
+	CompletionEntry entry;
+	EnterCriticalSection(&es->cs);
+	CompletionPort* port = es->port;
+	if (port == nullptr || es->recvRequest != nullptr)
+	{
+		LeaveCriticalSection(&es->cs);
+		errno = (port == nullptr) ? EBADF : EALREADY;
+		return false;
+	}
+
+	lpRequest->transferred = 0;
+	IoResult result = TryRecv(sock, lpRequest, entry);
+	if (result == IO_PENDING)
+		es->recvRequest = lpRequest;
+	entry.completionKey = es->completionKey;
+	LeaveCriticalSection(&es->cs);
+
+	if (result == IO_FAILED)
+		return false;
+	if (result == IO_COMPLETED)
+		port->PushReady(entry);
+	return true;
+}
+
+bool CompletionPort::PostSend(SOCKET sock, IoRequest* lpRequest)
+{
+	EpollSocket* es = GetEpollSocket(sock, false);
+	if (es == nullptr)
+	{
+		errno = EBADF;
+		return false;
+	}
+
+	CompletionEntry entry;
+	EnterCriticalSection(&es->cs);
+	CompletionPort* port = es->port;
+	if (port == nullptr || es->sendRequest != nullptr)
+	{
+		LeaveCriticalSection(&es->cs);
+		errno = (port == nullptr) ? EBADF : EALREADY;
+		return false;
+	}
+
+	lpRequest->transferred = 0;
+	IoResult result = TrySend(sock, lpRequest, entry);
+	if (result == IO_PENDING)
+		es->sendRequest = lpRequest;
+	entry.completionKey = es->completionKey;
+	LeaveCriticalSection(&es->cs);
+
+	if (result == IO_FAILED)
+		return false;
+	if (result == IO_COMPLETED)
+		port->PushReady(entry);
+	return true;
+}
+
+bool CompletionPort::PostAccept(SOCKET listenSock, AcceptRequest* lpRequest)
+{
+	EpollSocket* es = GetEpollSocket(listenSock, false);
+	if (es == nullptr)
+	{
+		errno = EBADF;
+		return false;
+	}
+
+	CompletionEntry entry;
+	EnterCriticalSection(&es->cs);
+	CompletionPort* port = es->port;
+	if (port == nullptr)
+	{
+		LeaveCriticalSection(&es->cs);
+		errno = EBADF;
+		return false;
+	}
+
+	lpRequest->acceptSocket = INVALID_SOCKET;
+	IoResult result = es->acceptRequests.empty() ? TryAccept(listenSock, lpRequest, entry) : IO_PENDING;
+	if (result == IO_PENDING)
+		es->acceptRequests.push_back(lpRequest);
+	entry.completionKey = es->completionKey;
+	LeaveCriticalSection(&es->cs);
+
+	if (result == IO_FAILED)
+		return false;
+	if (result == IO_COMPLETED)
+		port->PushReady(entry);
+	return true;
+}
+
+bool CompletionPort::CompleteAccept(SOCKET listenSock, AcceptRequest* lpRequest)
+{	// accept4() already filled in the peer address, and the listener's options need no update
+	(void)listenSock;
+	return lpRequest->acceptSocket != INVALID_SOCKET;
+}
+
+void CompletionPort::BeginSendBatch()
+{
+}
+
+void CompletionPort::FlushSendBatch()
+{
+}
+
+#endif
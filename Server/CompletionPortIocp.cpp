@@ -0,0 +1,166 @@
+#ifdef _WIN32
+
+#include "CompletionPort.h"
+#include <MSWSock.h>
+
+static LPFN_ACCEPTEX lpfnAcceptEx = NULL;
+static LPFN_GETACCEPTEXSOCKADDRS lpfnGetAcceptExSockaddrs = NULL;
+
+static bool LoadExtensionFunction(SOCKET sock, GUID guid, void* lpfn, DWORD size)
+{
+	DWORD dwBytes = 0;
+	return WSAIoctl(sock, SIO_GET_EXTENSION_FUNCTION_POINTER, &guid, sizeof(guid),
+		lpfn, size, &dwBytes, NULL, NULL) != SOCKET_ERROR;
+}
+
+CompletionPort::CompletionPort()
+{
+	hCompPort = NULL;
+}
+
+CompletionPort::~CompletionPort()
+{
+	Close();
+}
+
+bool CompletionPort::Create(int maxNumberOfThreads)
+{
+	hCompPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, maxNumberOfThreads);
+	return hCompPort != NULL;
+}
+
+void CompletionPort::Close()
+{
+	if (hCompPort != NULL)
+		CloseHandle(hCompPort);
+	hCompPort = NULL;
+}
+
+bool CompletionPort::Associate(SOCKET sock, ULONG_PTR completionKey)
+{
+	return CreateIoCompletionPort((HANDLE)sock, hCompPort, completionKey, 0) != NULL;
+}
+
+void CompletionPort::Dissociate(SOCKET sock)
+{
+	// closesocket() drops the association and aborts whatever is still pending.
+}
+
+bool CompletionPort::Post(DWORD dwBytesTransferred, ULONG_PTR completionKey, IoRequest* lpRequest)
+{
+	LPOVERLAPPED lpOverlapped = (lpRequest != nullptr) ? &lpRequest->overlapped : NULL;
+	return PostQueuedCompletionStatus(hCompPort, dwBytesTransferred, completionKey, lpOverlapped) != FALSE;
+}
+
+bool CompletionPort::Dequeue(CompletionEntry& entry, DWORD dwMilliseconds)
+{
+	LPOVERLAPPED lpOverlapped = NULL;
+	entry.completionKey = 0;
+	entry.dwBytesTransferred = 0;
+	entry.success = GetQueuedCompletionStatus(hCompPort, &entry.dwBytesTransferred,
+		&entry.completionKey, &lpOverlapped, dwMilliseconds) != FALSE;
+	entry.lpRequest = reinterpret_cast<IoRequest*>(lpOverlapped);
+	return entry.success;
+}
+
+int CompletionPort::DequeueBatch(CompletionEntry* entries, int maxEntries, DWORD dwMilliseconds)
+{
+	OVERLAPPED_ENTRY overlappedEntries[MAX_DEQUEUE_BATCH];
+	ULONG count = 0;
+	if (maxEntries > MAX_DEQUEUE_BATCH)
+		maxEntries = MAX_DEQUEUE_BATCH;
+	if (!GetQueuedCompletionStatusEx(hCompPort, overlappedEntries, (ULONG)maxEntries, &count, dwMilliseconds, FALSE))
+		return 0;
+
+	for (ULONG i = 0; i < count; ++i)
+	{
+		LPOVERLAPPED lpOverlapped = overlappedEntries[i].lpOverlapped;
+		entries[i].completionKey = overlappedEntries[i].lpCompletionKey;
+		entries[i].dwBytesTransferred = overlappedEntries[i].dwNumberOfBytesTransferred;
+		entries[i].lpRequest = reinterpret_cast<IoRequest*>(lpOverlapped);
+		// the status of each request is left in Internal as an NTSTATUS
+		entries[i].success = lpOverlapped == NULL || (LONG)lpOverlapped->Internal >= 0;
+	}
+	return (int)count;
+}
+
+bool CompletionPort::PostRecv(SOCKET sock, IoRequest* lpRequest)
+{
+	DWORD dwRecvBytes = 0;
+	DWORD dwFlags = 0;
+
+	ZeroMemory(&lpRequest->overlapped, sizeof(OVERLAPPED));
+	int rtn = WSARecv(sock, lpRequest->buffers, lpRequest->bufferCount,
+		&dwRecvBytes, &dwFlags, &lpRequest->overlapped, NULL);
+	return rtn != SOCKET_ERROR || WSAGetLastError() == WSA_IO_PENDING;
+}
+
+bool CompletionPort::PostSend(SOCKET sock, IoRequest* lpRequest)
+{
+	DWORD dwSendBytes = 0;
+	DWORD dwFlags = 0;
+
+	ZeroMemory(&lpRequest->overlapped, sizeof(OVERLAPPED));
+	int rtn = WSASend(sock, lpRequest->buffers, lpRequest->bufferCount,
+		&dwSendBytes, dwFlags, &lpRequest->overlapped, NULL);
+	return rtn != SOCKET_ERROR || WSAGetLastError() == WSA_IO_PENDING;
+}
+
+bool CompletionPort::PostAccept(SOCKET listenSock, AcceptRequest* lpRequest)
+{
+	if (lpfnAcceptEx == NULL)
+	{
+		GUID guidAcceptEx = WSAID_ACCEPTEX;
+		GUID guidGetAcceptExSockaddrs = WSAID_GETACCEPTEXSOCKADDRS;
+		if (!LoadExtensionFunction(listenSock, guidAcceptEx, &lpfnAcceptEx, sizeof(lpfnAcceptEx))
+			|| !LoadExtensionFunction(listenSock, guidGetAcceptExSockaddrs,
+				&lpfnGetAcceptExSockaddrs, sizeof(lpfnGetAcceptExSockaddrs)))
+			return false;
+	}
+
+	// AcceptEx wants the socket for the new connection up front
+	lpRequest->acceptSocket = WSASocket(AF_INET, SOCK_STREAM, 0, NULL, 0, WSA_FLAG_OVERLAPPED);
+	if (lpRequest->acceptSocket == INVALID_SOCKET)
+		return false;
+
+	DWORD dwBytes = 0;
+	ZeroMemory(&lpRequest->request.overlapped, sizeof(OVERLAPPED));
+	BOOL rtn = lpfnAcceptEx(listenSock, lpRequest->acceptSocket, lpRequest->addrBuf, 0,
+		sizeof(SOCKADDR_IN) + 16, sizeof(SOCKADDR_IN) + 16, &dwBytes, &lpRequest->request.overlapped);
+	if (!rtn && WSAGetLastError() != WSA_IO_PENDING)
+	{
+		int errCode = WSAGetLastError();
+		closesocket(lpRequest->acceptSocket);
+		lpRequest->acceptSocket = INVALID_SOCKET;
+		WSASetLastError(errCode);
+		return false;
+	}
+	return true;
+}
+
+bool CompletionPort::CompleteAccept(SOCKET listenSock, AcceptRequest* lpRequest)
+{
+	if (setsockopt(lpRequest->acceptSocket, SOL_SOCKET, SO_UPDATE_ACCEPT_CONTEXT,
+		(char*)&listenSock, sizeof(listenSock)) == SOCKET_ERROR)
+		return false;
+
+	SOCKADDR* localAdr = NULL;
+	SOCKADDR* remoteAdr = NULL;
+	int localAdrSz = 0;
+	int remoteAdrSz = 0;
+	lpfnGetAcceptExSockaddrs(lpRequest->addrBuf, 0, sizeof(SOCKADDR_IN) + 16, sizeof(SOCKADDR_IN) + 16,
+		&localAdr, &localAdrSz, &remoteAdr, &remoteAdrSz);
+	if (remoteAdr != NULL)
+		CopyMemory(&lpRequest->clntAdr, remoteAdr, sizeof(SOCKADDR_IN));
+	return true;
+}
+
+void CompletionPort::BeginSendBatch()
+{
+}
+
+void CompletionPort::FlushSendBatch()
+{
+}
+
+#endif
@@ -0,0 +1,732 @@
+#if !defined(_WIN32) && defined(USE_IO_URING)
+
+#include "CompletionPort.h"
+#include <sys/resource.h>
+#include <sys/uio.h>
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <cassert>
+#include <chrono>
+#include <thread>
+
+// io_uring backend. Sockets are registered as fixed files at the slot equal to their
+// descriptor, receives land straight in the IOInfo buffer they were posted with, and sends
+// posted inside BeginSendBatch/FlushSendBatch reach the kernel in a single io_uring_submit.
+// Every session already owns its receive buffer (Packet), so a provided-buffer ring would
+// only add a copy out of it.
+
+#define URING_ENTRIES 1024
+#define MAX_IOV 64
+
+enum UringOp {
+	OP_WAKE = 0,
+	OP_RECV,
+	OP_SEND,
+	OP_CANCEL,
+	OP_ACCEPT,
+	OP_TIMEOUT
+};
+
+struct UringSocket {
+	CRITICAL_SECTION cs;
+	SOCKET sock;
+	unsigned generation;
+	CompletionPort* port;
+	ULONG_PTR completionKey;
+	IoRequest* recvRequest;
+	IoRequest* sendRequest;
+
+	// a single multishot accept feeds whichever AcceptRequests are parked; connections that
+	// arrive while none is parked wait in acceptedSockets
+	bool acceptArmed;
+	std::deque<AcceptRequest*> acceptRequests;
+	std::deque<SOCKET> acceptedSockets;
+
+	// Requests cut off by Dissociate. Their buffers are the kernel's until the CQE comes in,
+	// so each is still completed then, aborted, for its owner to release them.
+	struct Retired {
+		unsigned generation;
+		UringOp op;
+		ULONG_PTR completionKey;
+		IoRequest* lpRequest;
+	};
+	std::deque<Retired> retired;
+
+	// must outlive the SQE, so they live here rather than on the poster's stack
+	msghdr msg;
+	iovec iov[MAX_IOV];
+	msghdr recvMsg;
+	iovec recvIov[MAX_IOV];
+
+	UringSocket() : sock(INVALID_SOCKET), generation(0), port(nullptr), completionKey(0),
+		recvRequest(nullptr), sendRequest(nullptr), acceptArmed(false) {
+		InitializeCriticalSection(&cs);
+		memset(&msg, 0, sizeof(msg));
+		memset(&recvMsg, 0, sizeof(recvMsg));
+	}
+};
+
+// user_data = descriptor | generation | op, so a completion that arrives after the
+// descriptor was reused is recognised as stale instead of finishing someone else's request.
+static inline uint64_t PackUserData(UringSocket* us, UringOp op)
+{
+	return ((uint64_t)(uint32_t)us->sock << 32) | ((uint64_t)(us->generation & 0x1FFFFFFF) << 3) | op;
+}
+
+static std::atomic<UringSocket*>* socketTable = nullptr;
+static size_t socketTableSize = 0;
+
+static void InitSocketTable()
+{
+	static bool initialized = [] {
+		rlimit rl;
+		socketTableSize = 65536;
+		if (getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur != RLIM_INFINITY && rl.rlim_cur > socketTableSize)
+			socketTableSize = rl.rlim_cur < (1 << 20) ? (size_t)rl.rlim_cur : (1 << 20);
+		socketTable = new std::atomic<UringSocket*>[socketTableSize]();
+		return true;
+	}();
+	(void)initialized;
+}
+
+static UringSocket* GetUringSocket(SOCKET sock, bool create)
+{
+	if (sock < 0 || (size_t)sock >= socketTableSize)
+		return nullptr;
+
+	UringSocket* us = socketTable[sock].load(std::memory_order_acquire);
+	if (us == nullptr && create)
+	{
+		UringSocket* fresh = new UringSocket();
+		if (socketTable[sock].compare_exchange_strong(us, fresh))
+			us = fresh;
+		else
+			delete fresh;
+	}
+	return us;
+}
+
+static int ToIovec(IoRequest* lpRequest, iovec* iov)
+{	// skips what a partial send already wrote
+	assert(lpRequest->bufferCount <= MAX_IOV);
+	DWORD skip = lpRequest->transferred;
+	int count = 0;
+	for (DWORD i = 0; i < lpRequest->bufferCount; ++i)
+	{
+		WSABUF& wsaBuf = lpRequest->buffers[i];
+		if (skip >= wsaBuf.len)
+		{
+			skip -= wsaBuf.len;
+			continue;
+		}
+		iov[count].iov_base = wsaBuf.buf + skip;
+		iov[count].iov_len = wsaBuf.len - skip;
+		skip = 0;
+		count++;
+	}
+	return count;
+}
+
+// Sends prepared by this thread while a batch is open, per port.
+static thread_local int sendBatchDepth = 0;
+static thread_local std::vector<CompletionPort*>* batchedPorts = nullptr;
+
+CompletionPort::CompletionPort()
+{
+	ringInitialized = false;
+	filesRegistered = false;
+	reaping = false;
+	concurrency = 1;
+	InitializeCriticalSection(&csForSubmit);
+}
+
+CompletionPort::~CompletionPort()
+{
+	Close();
+	DeleteCriticalSection(&csForSubmit);
+}
+
+bool CompletionPort::Create(int maxNumberOfThreads)
+{
+	InitSocketTable();
+
+	// as with IOCP, 0 means one per processor
+	concurrency = maxNumberOfThreads > 0 ? maxNumberOfThreads : (int)std::thread::hardware_concurrency();
+	if (concurrency < 1)
+		concurrency = 1;
+
+	int rtn = io_uring_queue_init(URING_ENTRIES, &ring, 0);
+	if (rtn < 0)
+	{
+		errno = -rtn;
+		return false;
+	}
+	ringInitialized = true;
+	return true;
+}
+
+bool CompletionPort::SetupSocketResources()
+{	// deferred to the first Associate so ports that only carry posted jobs stay small
+	EnterCriticalSection(&csForSubmit);
+	if (filesRegistered)
+	{
+		LeaveCriticalSection(&csForSubmit);
+		return true;
+	}
+
+	int rtn = io_uring_register_files_sparse(&ring, (unsigned)socketTableSize);
+	if (rtn < 0)
+	{
+		LeaveCriticalSection(&csForSubmit);
+		errno = -rtn;
+		return false;
+	}
+	filesRegistered = true;
+	LeaveCriticalSection(&csForSubmit);
+	return true;
+}
+
+void CompletionPort::Close()
+{
+	if (!ringInitialized)
+		return;
+
+	io_uring_queue_exit(&ring);
+	filesRegistered = false;
+	ringInitialized = false;
+}
+
+io_uring_sqe* CompletionPort::GetSqe()
+{	// caller holds csForSubmit
+	io_uring_sqe* sqe = io_uring_get_sqe(&ring);
+	while (sqe == nullptr)
+	{
+		io_uring_submit(&ring);
+		sqe = io_uring_get_sqe(&ring);
+	}
+	return sqe;
+}
+
+void CompletionPort::Submit()
+{
+	EnterCriticalSection(&csForSubmit);
+	io_uring_submit(&ring);
+	LeaveCriticalSection(&csForSubmit);
+}
+
+bool CompletionPort::Associate(SOCKET sock, ULONG_PTR completionKey)
+{
+	UringSocket* us = GetUringSocket(sock, true);
+	if (us == nullptr)
+	{
+		errno = EBADF;
+		return false;
+	}
+
+	if (!SetupSocketResources())
+		return false;
+
+	int rtn = io_uring_register_files_update(&ring, (unsigned)sock, &sock, 1);
+	if (rtn < 0)
+	{
+		errno = -rtn;
+		return false;
+	}
+
+	EnterCriticalSection(&us->cs);
+	us->sock = sock;
+	us->generation++;
+	us->port = this;
+	us->completionKey = completionKey;
+	us->recvRequest = nullptr;
+	us->sendRequest = nullptr;
+	us->acceptArmed = false;
+	us->acceptRequests.clear();
+	LeaveCriticalSection(&us->cs);
+	return true;
+}
+
+void CompletionPort::Dissociate(SOCKET sock)
+{
+	UringSocket* us = GetUringSocket(sock, false);
+	if (us == nullptr)
+		return;
+
+	EnterCriticalSection(&us->cs);
+	if (us->port == this)
+	{
+		// the fixed-file slot keeps the socket alive, so in-flight requests must be cancelled
+		// before the slot is cleared or closesocket() would not actually close anything
+		EnterCriticalSection(&csForSubmit);
+		io_uring_sqe* sqe = GetSqe();
+		io_uring_prep_cancel_fd(sqe, sock, IORING_ASYNC_CANCEL_ALL | IORING_ASYNC_CANCEL_FD_FIXED);
+		io_uring_sqe_set_data64(sqe, PackUserData(us, OP_CANCEL));
+		io_uring_submit(&ring);
+		LeaveCriticalSection(&csForSubmit);
+
+		int none = -1;
+		io_uring_register_files_update(&ring, (unsigned)sock, &none, 1);
+
+		if (us->recvRequest != nullptr)
+			us->retired.push_back({ us->generation & 0x1FFFFFFF, OP_RECV, us->completionKey, us->recvRequest });
+		if (us->sendRequest != nullptr)
+			us->retired.push_back({ us->generation & 0x1FFFFFFF, OP_SEND, us->completionKey, us->sendRequest });
+		us->generation++;
+		us->port = nullptr;
+		us->recvRequest = nullptr;
+		us->sendRequest = nullptr;
+		us->acceptArmed = false;
+		us->acceptRequests.clear();
+		for (SOCKET accepted : us->acceptedSockets)
+			close(accepted);
+		us->acceptedSockets.clear();
+	}
+	LeaveCriticalSection(&us->cs);
+}
+
+bool CompletionPort::Post(DWORD dwBytesTransferred, ULONG_PTR completionKey, IoRequest* lpRequest)
+{
+	CompletionEntry entry;
+	entry.success = true;
+	entry.dwBytesTransferred = dwBytesTransferred;
+	entry.completionKey = completionKey;
+	entry.lpRequest = lpRequest;
+
+	PushReady(entry);
+
+	// the reaper blocked in the kernel only sees the entry once something completes;
+	// it set reaping before its last look at readyQueue, so this cannot miss it
+	if (reaping)
+	{
+		EnterCriticalSection(&csForSubmit);
+		io_uring_sqe* sqe = GetSqe();
+		io_uring_prep_nop(sqe);
+		io_uring_sqe_set_data64(sqe, OP_WAKE);
+		io_uring_submit(&ring);
+		LeaveCriticalSection(&csForSubmit);
+	}
+	return true;
+}
+
+void CompletionPort::PushReady(const CompletionEntry& entry)
+{
+	{
+		std::lock_guard<std::mutex> lock(readyLock);
+		readyQueue.push_back(entry);
+	}
+	readyCond.notify_one();
+}
+
+int CompletionPort::PopReady(CompletionEntry* entries, int maxEntries)
+{
+	int count = 0;
+	std::lock_guard<std::mutex> lock(readyLock);
+	for (; count < maxEntries && !readyQueue.empty(); ++count)
+	{
+		entries[count] = readyQueue.front();
+		readyQueue.pop_front();
+	}
+	return count;
+}
+
+void CompletionPort::PrepRecv(UringSocket* us, IoRequest* lpRequest)
+{	// caller holds us->cs
+	us->recvMsg.msg_iov = us->recvIov;
+	us->recvMsg.msg_iovlen = ToIovec(lpRequest, us->recvIov);
+
+	EnterCriticalSection(&csForSubmit);
+	io_uring_sqe* sqe = GetSqe();
+	io_uring_prep_recvmsg(sqe, us->sock, &us->recvMsg, 0);
+	io_uring_sqe_set_flags(sqe, IOSQE_FIXED_FILE);
+	io_uring_sqe_set_data64(sqe, PackUserData(us, OP_RECV));
+	io_uring_submit(&ring);
+	LeaveCriticalSection(&csForSubmit);
+}
+
+void CompletionPort::PrepSend(UringSocket* us, IoRequest* lpRequest)
+{	// caller holds us->cs
+	us->msg.msg_iov = us->iov;
+	us->msg.msg_iovlen = ToIovec(lpRequest, us->iov);
+
+	EnterCriticalSection(&csForSubmit);
+	io_uring_sqe* sqe = GetSqe();
+	io_uring_prep_sendmsg(sqe, us->sock, &us->msg, MSG_NOSIGNAL);
+	io_uring_sqe_set_flags(sqe, IOSQE_FIXED_FILE);
+	io_uring_sqe_set_data64(sqe, PackUserData(us, OP_SEND));
+	if (sendBatchDepth == 0)
+		io_uring_submit(&ring);
+	LeaveCriticalSection(&csForSubmit);
+
+	if (sendBatchDepth > 0)
+	{
+		if (batchedPorts == nullptr)
+			batchedPorts = new std::vector<CompletionPort*>();
+		for (CompletionPort* port : *batchedPorts)
+			if (port == this)
+				return;
+		batchedPorts->push_back(this);
+	}
+}
+
+void CompletionPort::PrepAccept(UringSocket* us)
+{	// caller holds us->cs
+	EnterCriticalSection(&csForSubmit);
+	io_uring_sqe* sqe = GetSqe();
+	io_uring_prep_multishot_accept(sqe, us->sock, NULL, NULL, SOCK_CLOEXEC);
+	io_uring_sqe_set_flags(sqe, IOSQE_FIXED_FILE);
+	io_uring_sqe_set_data64(sqe, PackUserData(us, OP_ACCEPT));
+	io_uring_submit(&ring);
+	LeaveCriticalSection(&csForSubmit);
+	us->acceptArmed = true;
+}
+
+bool CompletionPort::HandleCqe(io_uring_cqe* cqe, CompletionEntry& entry)
+{	// caller is the reaper
+	uint64_t userData = io_uring_cqe_get_data64(cqe);
+	UringOp op = (UringOp)(userData & 7);
+	if (op == OP_WAKE || op == OP_CANCEL || op == OP_TIMEOUT)
+		return false;
+
+	SOCKET sock = (SOCKET)(userData >> 32);
+	unsigned generation = (unsigned)((userData >> 3) & 0x1FFFFFFF);
+
+	UringSocket* us = GetUringSocket(sock, false);
+	if (us == nullptr)
+		return false;
+
+	bool produced = false;
+	EnterCriticalSection(&us->cs);
+	bool current = us->port == this && (us->generation & 0x1FFFFFFF) == generation;
+	if (current && op == OP_RECV && us->recvRequest != nullptr)
+	{
+		entry.success = cqe->res >= 0;
+		entry.dwBytesTransferred = cqe->res > 0 ? (DWORD)cqe->res : 0;
+		entry.completionKey = us->completionKey;
+		entry.lpRequest = us->recvRequest;
+		us->recvRequest = nullptr;
+		produced = true;
+	}
+	else if (current && op == OP_ACCEPT)
+	{
+		if (!(cqe->flags & IORING_CQE_F_MORE))
+			us->acceptArmed = false;
+
+		if (!us->acceptRequests.empty())
+		{
+			AcceptRequest* lpRequest = us->acceptRequests.front();
+			us->acceptRequests.pop_front();
+			lpRequest->acceptSocket = cqe->res >= 0 ? (SOCKET)cqe->res : INVALID_SOCKET;
+			entry.success = cqe->res >= 0;
+			entry.dwBytesTransferred = 0;
+			entry.completionKey = us->completionKey;
+			entry.lpRequest = &lpRequest->request;
+			produced = true;
+		}
+		else if (cqe->res >= 0)
+		{
+			us->acceptedSockets.push_back((SOCKET)cqe->res);
+		}
+
+		if (!us->acceptArmed && !us->acceptRequests.empty())
+			PrepAccept(us);
+	}
+	else if (current && op == OP_SEND && us->sendRequest != nullptr)
+	{
+		IoRequest* lpRequest = us->sendRequest;
+		if (cqe->res > 0)
+			lpRequest->transferred += (DWORD)cqe->res;
+
+		DWORD total = 0;
+		for (DWORD i = 0; i < lpRequest->bufferCount; ++i)
+			total += lpRequest->buffers[i].len;
+
+		if (cqe->res > 0 && lpRequest->transferred < total)
+		{	// short write: send the remainder
+			PrepSend(us, lpRequest);
+		}
+		else
+		{
+			entry.success = cqe->res >= 0;
+			entry.dwBytesTransferred = entry.success ? lpRequest->transferred : 0;
+			entry.completionKey = us->completionKey;
+			entry.lpRequest = lpRequest;
+			us->sendRequest = nullptr;
+			produced = true;
+		}
+	}
+	else if (!current && (op == OP_RECV || op == OP_SEND))
+	{
+		for (auto itr = us->retired.begin(); itr != us->retired.end(); ++itr)
+		{
+			if (itr->generation != generation || itr->op != op)
+				continue;
+			entry.success = false;
+			entry.dwBytesTransferred = 0;
+			entry.completionKey = itr->completionKey;
+			entry.lpRequest = itr->lpRequest;
+			us->retired.erase(itr);
+			produced = true;
+			break;
+		}
+	}
+	else if (!current && op == OP_ACCEPT && cqe->res >= 0)
+	{	// the listener went away while a connection was in flight
+		close(cqe->res);
+	}
+	LeaveCriticalSection(&us->cs);
+	return produced;
+}
+
+bool CompletionPort::Dequeue(CompletionEntry& entry, DWORD dwMilliseconds)
+{
+	entry = CompletionEntry();
+	if (DequeueBatch(&entry, 1, dwMilliseconds) == 0)
+		return false;
+	return entry.success;
+}
+
+int CompletionPort::DequeueBatch(CompletionEntry* entries, int maxEntries, DWORD dwMilliseconds)
+{
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(dwMilliseconds);
+	while (true)
+	{
+		int count = PopReady(entries, maxEntries);
+		if (count > 0)
+			return count;
+
+		bool idle = false;
+		if (reaping.compare_exchange_strong(idle, true))
+		{
+			DWORD remaining = INFINITE;
+			if (dwMilliseconds != INFINITE)
+			{
+				auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+				remaining = left.count() > 0 ? (DWORD)left.count() : 0;
+			}
+			count = Reap(entries, maxEntries, remaining);
+
+			// hand the role on; Reap already woke workers for what it queued past this batch
+			reaping = false;
+			{
+				std::lock_guard<std::mutex> lock(readyLock);
+			}
+			readyCond.notify_one();
+
+			if (count > 0)
+				return count;
+			if (count < 0 && count != -EINTR && count != -ETIME)
+			{
+				errno = -count;
+				return 0;
+			}
+			if (dwMilliseconds != INFINITE && std::chrono::steady_clock::now() >= deadline)
+			{
+				errno = ETIMEDOUT;
+				return 0;
+			}
+			continue;
+		}
+
+		// another worker is reaping: wait for what it queues, or for the role to come free
+		std::unique_lock<std::mutex> lock(readyLock);
+		auto ready = [this] { return !readyQueue.empty() || !reaping; };
+		if (dwMilliseconds == INFINITE)
+		{
+			readyCond.wait(lock, ready);
+		}
+		else if (!readyCond.wait_until(lock, deadline, ready))
+		{
+			errno = ETIMEDOUT;
+			return 0;
+		}
+	}
+}
+
+int CompletionPort::Reap(CompletionEntry* entries, int maxEntries, DWORD dwMilliseconds)
+{	// caller set reaping; entries posted before that are taken first
+	int count = PopReady(entries, maxEntries);
+	if (count > 0)
+		return count;
+
+	io_uring_cqe* cqe = nullptr;
+	int rtn;
+	if (dwMilliseconds == INFINITE)
+	{
+		rtn = io_uring_wait_cqe(&ring, &cqe);
+	}
+	else if (ring.features & IORING_FEAT_EXT_ARG)
+	{	// the timeout goes to io_uring_enter itself, nothing is submitted
+		__kernel_timespec ts;
+		ts.tv_sec = dwMilliseconds / 1000;
+		ts.tv_nsec = (long long)(dwMilliseconds % 1000) * 1000000;
+		rtn = io_uring_wait_cqe_timeout(&ring, &cqe, &ts);
+	}
+	else
+	{	// io_uring_wait_cqe_timeout would submit a timeout SQE of its own, outside csForSubmit.
+		// This one also completes as soon as anything else does, so it does not linger.
+		EnterCriticalSection(&csForSubmit);
+		reapTimeout.tv_sec = dwMilliseconds / 1000;
+		reapTimeout.tv_nsec = (long long)(dwMilliseconds % 1000) * 1000000;
+		io_uring_sqe* sqe = GetSqe();
+		io_uring_prep_timeout(sqe, &reapTimeout, 1, 0);
+		io_uring_sqe_set_data64(sqe, OP_TIMEOUT);
+		io_uring_submit(&ring);
+		LeaveCriticalSection(&csForSubmit);
+		rtn = io_uring_wait_cqe(&ring, &cqe);
+	}
+	if (rtn < 0)
+	{
+		count = PopReady(entries, maxEntries);
+		return count > 0 ? count : rtn;
+	}
+
+	// reap every CQE already posted; what does not fit in this batch goes to the other workers
+	CompletionEntry entry;
+	int queued = 0;
+	for (int reaped = 0; cqe != nullptr && reaped < URING_ENTRIES; ++reaped)
+	{
+		if (HandleCqe(cqe, entry))
+		{
+			if (count < maxEntries)
+			{
+				entries[count++] = entry;
+			}
+			else
+			{
+				std::lock_guard<std::mutex> lock(readyLock);
+				readyQueue.push_back(entry);
+				++queued;
+			}
+		}
+		io_uring_cqe_seen(&ring, cqe);
+		if (io_uring_peek_cqe(&ring, &cqe) != 0)
+			cqe = nullptr;
+	}
+	// no more workers than the port was created for are woken at once, like IOCP
+	if (queued >= concurrency)
+	{
+		readyCond.notify_all();
+	}
+	else
+	{
+		for (int i = 0; i < queued; ++i)
+			readyCond.notify_one();
+	}
+	// posted entries, whose wake-ups were among the CQEs
+	return count + PopReady(entries + count, maxEntries - count);
+}
+
+bool CompletionPort::PostRecv(SOCKET sock, IoRequest* lpRequest)
+{
+	UringSocket* us = GetUringSocket(sock, false);
+	if (us == nullptr)
+	{
+		errno = EBADF;
+		return false;
+	}
+
+	EnterCriticalSection(&us->cs);
+	if (us->port == nullptr || us->recvRequest != nullptr)
+	{
+		errno = (us->port == nullptr) ? EBADF : EALREADY;
+		LeaveCriticalSection(&us->cs);
+		return false;
+	}
+
+	lpRequest->transferred = 0;
+	us->recvRequest = lpRequest;
+	us->port->PrepRecv(us, lpRequest);
+	LeaveCriticalSection(&us->cs);
+	return true;
+}
+
+bool CompletionPort::PostSend(SOCKET sock, IoRequest* lpRequest)
+{
+	UringSocket* us = GetUringSocket(sock, false);
+	if (us == nullptr)
+	{
+		errno = EBADF;
+		return false;
+	}
+
+	EnterCriticalSection(&us->cs);
+	if (us->port == nullptr || us->sendRequest != nullptr)
+	{
+		errno = (us->port == nullptr) ? EBADF : EALREADY;
+		LeaveCriticalSection(&us->cs);
+		return false;
+	}
+
+	lpRequest->transferred = 0;
+	us->sendRequest = lpRequest;
+	us->port->PrepSend(us, lpRequest);
+	LeaveCriticalSection(&us->cs);
+	return true;
+}
+
+bool CompletionPort::PostAccept(SOCKET listenSock, AcceptRequest* lpRequest)
+{
+	UringSocket* us = GetUringSocket(listenSock, false);
+	if (us == nullptr)
+	{
+		errno = EBADF;
+		return false;
+	}
+
+	EnterCriticalSection(&us->cs);
+	CompletionPort* port = us->port;
+	if (port == nullptr)
+	{
+		LeaveCriticalSection(&us->cs);
+		errno = EBADF;
+		return false;
+	}
+
+	lpRequest->acceptSocket = INVALID_SOCKET;
+	ZeroMemory(&lpRequest->clntAdr, sizeof(lpRequest->clntAdr));
+	if (!us->acceptedSockets.empty())
+	{
+		lpRequest->acceptSocket = us->acceptedSockets.front();
+		us->acceptedSockets.pop_front();
+		ULONG_PTR completionKey = us->completionKey;
+		LeaveCriticalSection(&us->cs);
+		return port->Post(0, completionKey, &lpRequest->request);
+	}
+
+	us->acceptRequests.push_back(lpRequest);
+	if (!us->acceptArmed)
+		port->PrepAccept(us);
+	LeaveCriticalSection(&us->cs);
+	return true;
+}
+
+bool CompletionPort::CompleteAccept(SOCKET listenSock, AcceptRequest* lpRequest)
+{	// multishot accept does not report addresses; the listener's options need no update
+	(void)listenSock;
+	if (lpRequest->acceptSocket == INVALID_SOCKET)
+		return false;
+
+	socklen_t clntAdrSz = sizeof(lpRequest->clntAdr);
+	getpeername(lpRequest->acceptSocket, (SOCKADDR*)&lpRequest->clntAdr, &clntAdrSz);
+	return true;
+}
+
+void CompletionPort::BeginSendBatch()
+{
+	sendBatchDepth++;
+}
+
+void CompletionPort::FlushSendBatch()
+{
+	if (sendBatchDepth == 0 || --sendBatchDepth > 0)
+		return;
+
+	if (batchedPorts == nullptr)
+		return;
+	for (CompletionPort* port : *batchedPorts)
+		port->Submit();
+	batchedPorts->clear();
+}
+
+#endif
@@ -1,13 +1,19 @@
 #include "ErrorHandle.h"
-#include <Windows.h>
+#include "Platform.h"
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 void ErrorHandling(int errCode, bool isExit) {
+#ifdef _WIN32
 	WCHAR errMsg[1024];
 	FormatMessage(FORMAT_MESSAGE_FROM_SYSTEM, NULL, errCode, 0, errMsg, 1024, NULL);
 	fprintf(stderr, "[Error Code]: %d, ", errCode);
 	fwprintf(stderr, L"[Error Message]: %s\n", errMsg);
+#else
+	fprintf(stderr, "[Error Code]: %d, ", errCode);
+	fprintf(stderr, "[Error Message]: %s\n", strerror(errCode));
+#endif
 	if (isExit) exit(1);
 }
 
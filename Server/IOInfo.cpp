@@ -1,131 +1,323 @@
 #include "IOInfo.h"
+#include "SocketInfo.h"
+#include "Metrics.h"
 #include <cassert>
+#include <vector>
+
+int IOInfo::sendSoftBytes = 64 * 1024;
+int IOInfo::sendHardBytes = 1024 * 1024;
+int IOInfo::sendSoftFrames = 128;
+int IOInfo::sendHardFrames = 2048;
+
+static thread_local int sendBatchDepth = 0;
+static thread_local std::vector<IOInfo*> deferredSends;
 
 IOInfo::IOInfo()
 {
-	memset(&(overlapped), 0, sizeof(WSAOVERLAPPED));
+	request.buffers = &wsaBuf;
+	request.bufferCount = 1;
 	wsaBuf.len = 0;
 	wsaBuf.buf = NULL;
+	lpPacket = NULL;
+	lpSocketInfo = NULL;
+	sock = INVALID_SOCKET;
+	owner = INVALID_SESSION;
 	called = false;
-	hSemaForSend = CreateSemaphore(NULL, 1, 1, NULL);
+	inFlight = 0;
+	sending = false;
+	deferred = false;
+	queuedBytes = 0;
+	InitializeCriticalSection(&csForSendQueue);
 }
 
 IOInfo::~IOInfo() 
 {
-	if (hSemaForSend != NULL)
-		CloseHandle(hSemaForSend);
+	for (SendFrame* frame : sendQueue)
+		frame->Release();
+	while (!msgQueue.Empty())
+		MessageContext::DeallocateMessageContext(msgQueue.Pop());
+	DeleteCriticalSection(&csForSendQueue);
 }
 
-IOInfo* IOInfo::AllocateIoInfo()
+IOInfo* IOInfo::AllocateIoInfo(SocketInfo* lpSocketInfo, bool forRecv)
 {
 	IOInfo* lpIoInfo = new IOInfo();
-	lpIoInfo->lpPacket = Packet::AllocatePacket(&(lpIoInfo->msgQueue));
-	lpIoInfo->wsaBuf.buf = lpIoInfo->lpPacket->buffer;
-	lpIoInfo->wsaBuf.len = FOR_IO_SIZE;
+	lpIoInfo->lpSocketInfo = lpSocketInfo;
+	if (forRecv)
+		lpIoInfo->lpPacket = Packet::AllocatePacket(&(lpIoInfo->msgQueue));
 
 	return lpIoInfo;
 }
 
+void IOInfo::Reset()
+{
+	EnterCriticalSection(&csForSendQueue);
+	assert(owner == INVALID_SESSION && inFlight == 0);
+	for (SendFrame* frame : sendQueue)
+		frame->Release();
+	sendQueue.clear();
+	sending = false;
+	deferred = false;
+	queuedBytes = 0;
+	LeaveCriticalSection(&csForSendQueue);
+
+	while (!msgQueue.Empty())
+		MessageContext::DeallocateMessageContext(msgQueue.Pop());
+	if (lpPacket != NULL)
+		lpPacket->Reset();
+
+	request.buffers = &wsaBuf;
+	request.bufferCount = 1;
+	called = false;
+}
+
+void IOInfo::Bind(const SOCKET& sock, SessionHandle session)
+{
+	EnterCriticalSection(&csForSendQueue);
+	this->sock = sock;
+	owner = session;
+	LeaveCriticalSection(&csForSendQueue);
+}
+
+void IOInfo::Detach()
+{
+	EnterCriticalSection(&csForSendQueue);
+	sock = INVALID_SOCKET;
+	owner = INVALID_SESSION;
+	deferred = false;
+	// the first inFlight frames are still the kernel's
+	while ((int)sendQueue.size() > inFlight)
+	{
+		queuedBytes -= sendQueue.back()->length;
+		sendQueue.back()->Release();
+		sendQueue.pop_back();
+	}
+	if (inFlight == 0)
+		sending = false;
+	LeaveCriticalSection(&csForSendQueue);
+}
+
 void IOInfo::DeallocateIoInfo(IOInfo* lpIoInfo)
 {
 	assert(lpIoInfo != NULL);
 	if (lpIoInfo->lpPacket != NULL)
 		Packet::DeallocatePacket(lpIoInfo->lpPacket);
-	free(lpIoInfo);
+	delete lpIoInfo;
 }
 
-bool IOInfo::Receive(const SOCKET& sock)
+bool IOInfo::Receive()
 {
 	if (called) {
 		fprintf(stderr, "Already Recv Called!!\n");
 		return true;
 	}
 
-	DWORD dwRecvBytes = 0;
-	DWORD dwFlags = 0;
+	// receive straight into the free tail of the packet's buffer
+	wsaBuf.buf = lpPacket->WritePtr();
+	wsaBuf.len = lpPacket->WritableBytes();
 
-	ZeroMemory(&overlapped, sizeof(WSAOVERLAPPED));
-	int rtn = WSARecv(sock, &wsaBuf, 1, &dwRecvBytes, &dwFlags, &overlapped, NULL);
-	if (rtn == SOCKET_ERROR)
+	EnterCriticalSection(&csForSendQueue);
+	if (owner == INVALID_SESSION)
 	{
-		int errCode = WSAGetLastError();
-		if (errCode != WSA_IO_PENDING)
-		{
-			ErrorHandling("[Socket #%d] WSARecv Failed...", errCode, false);
-			return false;
-		}
+		LeaveCriticalSection(&csForSendQueue);
+		return false;
 	}
-
 	called = true;
+	lpSocketInfo->AddRef();
+	if (!CompletionPort::PostRecv(sock, &request))
+	{
+		called = false;
+		lpSocketInfo->Release();
+		LeaveCriticalSection(&csForSendQueue);
+		ErrorHandling("[Socket #%d] WSARecv Failed...", WSAGetLastError(), false);
+		return false;
+	}
+	LeaveCriticalSection(&csForSendQueue);
+
 	return true;
 }
 
-bool IOInfo::Send(const SOCKET& sock, const MessageContext* msgContext)
+bool IOInfo::Send(SessionHandle session, const MessageContext* msgContext)
+{
+	SendFrame* frame = SendFrame::Create(msgContext->header.type, msgContext->message);
+	return EnqueueFrame(session, frame);
+}
+
+bool IOInfo::Send(SessionHandle session, SendFrame* frame)
+{
+	frame->AddRef();
+	return EnqueueFrame(session, frame);
+}
+
+void IOInfo::BeginSendBatch()
 {
-	WaitForSingleObject(hSemaForSend, INFINITE);
+	sendBatchDepth++;
+	CompletionPort::BeginSendBatch();
+}
 
-	if (msgContext != nullptr) {
-		ZeroMemory(wsaBuf.buf, FOR_IO_SIZE);
-		wsaBuf.len = lpPacket->PackMessage(msgContext->header.type, msgContext->message);
+void IOInfo::FlushSendBatch()
+{
+	if (sendBatchDepth > 0 && --sendBatchDepth == 0)
+	{
+		for (IOInfo* lpIoInfo : deferredSends)
+			lpIoInfo->PostDeferred();
+		deferredSends.clear();
 	}
+	CompletionPort::FlushSendBatch();
+}
 
-	DWORD dwSendBytes = 0;
-	DWORD dwFlags = 0;
+// A failed post has no caller left to report to; the receive side sees the broken connection.
+void IOInfo::PostDeferred()
+{
+	EnterCriticalSection(&csForSendQueue);
+	// cleared by Detach if the session closed in the meantime
+	if (deferred)
+	{
+		deferred = false;
+		PostQueuedFrames();
+	}
+	LeaveCriticalSection(&csForSendQueue);
+}
 
-	ZeroMemory(&overlapped, sizeof(WSAOVERLAPPED));
-	int rtn = WSASend(sock, &wsaBuf, 1, &dwSendBytes, dwFlags, &overlapped, NULL);
-	if (rtn == SOCKET_ERROR)
+void IOInfo::SetSendLimits(int softBytes, int hardBytes, int softFrames, int hardFrames)
+{
+	sendSoftBytes = softBytes;
+	sendHardBytes = hardBytes;
+	sendSoftFrames = softFrames;
+	sendHardFrames = hardFrames;
+}
+
+bool IOInfo::EnqueueFrame(SessionHandle session, SendFrame* frame)
+{
+	bool rtn = true;
+	EnterCriticalSection(&csForSendQueue);
+	// the session closed, or its slot went to another one, after the caller resolved it
+	if (owner == INVALID_SESSION || owner != session)
 	{
-		int errCode = WSAGetLastError();
-		if (errCode != WSA_IO_PENDING)
+		LeaveCriticalSection(&csForSendQueue);
+		frame->Release();
+		return true;
+	}
+	if (queuedBytes >= sendSoftBytes || (int)sendQueue.size() >= sendSoftFrames)
+	{
+		Metrics::sendOverSoftMark++;
+		if (ConflateFrame(frame))
 		{
-			ErrorHandling("WSASend Failed...", errCode, false);
-			return false;
+			LeaveCriticalSection(&csForSendQueue);
+			return true;
 		}
 	}
-	return true;
+
+	// a single frame larger than the byte mark still goes out on an idle connection
+	if ((!sendQueue.empty() && queuedBytes + frame->length > sendHardBytes)
+		|| (int)sendQueue.size() >= sendHardFrames)
+	{
+		LeaveCriticalSection(&csForSendQueue);
+		frame->Release();
+		Metrics::sendOverHardMark++;
+		return false;
+	}
+
+	sendQueue.push_back(frame);
+	queuedBytes += frame->length;
+	if (!sending)
+	{
+		sending = true;
+		if (sendBatchDepth > 0)
+		{
+			deferred = true;
+			deferredSends.push_back(this);
+		}
+		else
+		{
+			rtn = PostQueuedFrames();
+		}
+	}
+	LeaveCriticalSection(&csForSendQueue);
+	return rtn;
 }
 
-void IOInfo::HandleReceive(int readBytes)
+// Puts frame in the place of an older queued frame it supersedes. The one in flight is
+// left alone. csForSendQueue must be held.
+bool IOInfo::ConflateFrame(SendFrame* frame)
 {
-	if (readBytes <= 0)
-		return;
+	if (frame->conflationKey == 0)
+		return false;
 
-	lpPacket->UnpackMessage(readBytes);
-	ZeroMemory(wsaBuf.buf, FOR_IO_SIZE);
+	for (size_t i = inFlight; i < sendQueue.size(); ++i)
+	{
+		SendFrame*& queued = sendQueue[i];
+		if (queued->conflationKey == frame->conflationKey && queued->type == frame->type)
+		{
+			queuedBytes += (long)frame->length - (long)queued->length;
+			queued->Release();
+			queued = frame;
+			Metrics::sendConflated++;
+			return true;
+		}
+	}
+	return false;
 }
 
-bool IOInfo::HandleSend(const SOCKET& sock)
+// Hands everything queued so far (up to MAX_GATHER_FRAMES) to one gather-send.
+// csForSendQueue must be held and the object bound.
+bool IOInfo::PostQueuedFrames()
 {
-	long previous;
-	ReleaseSemaphore(hSemaForSend, 1, NULL);
+	inFlight = 0;
+	for (auto itr = sendQueue.begin(); itr != sendQueue.end() && inFlight < MAX_GATHER_FRAMES; ++itr, ++inFlight)
+	{
+		gatherBufs[inFlight].buf = (*itr)->data;
+		gatherBufs[inFlight].len = (*itr)->length;
+	}
+	request.buffers = gatherBufs;
+	request.bufferCount = inFlight;
+
+	lpSocketInfo->AddRef();
+	if (!CompletionPort::PostSend(sock, &request))
+	{
+		lpSocketInfo->Release();
+		ErrorHandling("WSASend Failed...", WSAGetLastError(), false);
+		inFlight = 0;
+		sending = false;
+		return false;
+	}
 	return true;
 }
 
-void IOInfo::CopyRawToBuffer(const void* src, DWORD& length)
+bool IOInfo::HandleReceive(int readBytes, bool relayOnly)
 {
-	wsaBuf.len = length;
-	ZeroMemory(wsaBuf.buf, FOR_IO_SIZE);
-	CopyMemory(wsaBuf.buf, src, length);
+	if (readBytes <= 0)
+		return true;
+
+	return lpPacket->UnpackMessage(readBytes, relayOnly);
 }
 
-void IOInfo::CopyBufferToRaw(void* dst, DWORD& length)
+bool IOInfo::HandleSend()
 {
-	CopyMemory(dst, wsaBuf.buf, length);
-	ZeroMemory(wsaBuf.buf, FOR_IO_SIZE);
+	bool rtn = true;
+	EnterCriticalSection(&csForSendQueue);
+	for (; inFlight > 0; --inFlight)
+	{
+		queuedBytes -= sendQueue.front()->length;
+		sendQueue.front()->Release();
+		sendQueue.pop_front();
+	}
+
+	// chain whatever was queued while the last send was in flight
+	if (sendQueue.empty() || owner == INVALID_SESSION)
+		sending = false;
+	else
+		rtn = PostQueuedFrames();
+	LeaveCriticalSection(&csForSendQueue);
+	return rtn;
 }
 
 bool IOInfo::HasMessage()
 {
-	return !msgQueue.empty();
+	return !msgQueue.Empty();
 }
 
 MessageContext* IOInfo::NextMessage()
 {
-	if (msgQueue.empty())
-		return nullptr;
-
-	MessageContext* msg = msgQueue.front();
-	msgQueue.pop();
-	return msg;
+	return msgQueue.Pop();
 }
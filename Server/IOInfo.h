@@ -1,10 +1,22 @@
 #pragma once
 
 #include "Packet.h"
-#include <WinSock2.h>
-#include <Windows.h>
-#include <queue>
-using std::queue;
+#include "Platform.h"
+#include "CompletionPort.h"
+#include "SendFrame.h"
+#include <deque>
+#include <cstdint>
+
+// Refers to one session: slot index in the low bits, the slot's generation above them.
+// A handle outlives its session safely; FromHandle simply stops resolving it.
+typedef uint64_t SessionHandle;
+
+#define INVALID_SESSION 0
+
+// frames handed to one gather-send at most
+#define MAX_GATHER_FRAMES 32
+
+class SocketInfo;
 
 class IOInfo {
 public:
@@ -12,29 +24,73 @@ public:
 	~IOInfo();
 
 public:
-	static IOInfo* AllocateIoInfo();
+	// Only the receive side parses, so only it gets a Packet and its buffer.
+	static IOInfo* AllocateIoInfo(SocketInfo* lpSocketInfo, bool forRecv);
 	static void DeallocateIoInfo(IOInfo* lpIoInfo);
 
+	// Drops everything left from the previous session using this object. Only called once
+	// no request of that session is outstanding any more.
+	void Reset();
+	// Hands the object to a new session; requests go to sock from now on.
+	void Bind(const SOCKET& sock, SessionHandle session);
+	// Stops posting for the session before its socket is closed. Frames of a send still in
+	// flight are kept until its completion, which arrives aborted, releases them.
+	void Detach();
+
 public:
-	bool Receive(const SOCKET& sock);
-	bool Send(const SOCKET& sock, const MessageContext* msgContext);
-	void HandleReceive(int readBytes);
-	bool HandleSend(const SOCKET& sock);
+	bool Receive();
+	// Queues the message and returns without waiting; the send path drains the queue.
+	// session is the handle the caller resolved; once it no longer owns this object the
+	// message is dropped. Returns false if the send failed or the queue passed its hard mark.
+	bool Send(SessionHandle session, const MessageContext* msgContext);
+	// Queues a shared frame; the queue takes its own reference.
+	bool Send(SessionHandle session, SendFrame* frame);
+	bool HandleReceive(int readBytes, bool relayOnly = false);
+	// Releases the frames of the completed send and chains the next one, unless detached.
+	bool HandleSend();
 
-	void CopyRawToBuffer(const void* src, DWORD& length);
-	void CopyBufferToRaw(void* dst, DWORD& length);
+	// Outbound queue marks, counting frames not yet handed to the kernel as well as in flight.
+	// Above a soft mark superseded state frames are conflated, past a hard mark sends fail.
+	static void SetSendLimits(int softBytes, int hardBytes, int softFrames, int hardFrames);
+
+	// Sends queued by this thread between Begin and Flush are held back and posted at Flush,
+	// so a connection sent several frames gets them in one gather-send. Calls nest.
+	static void BeginSendBatch();
+	static void FlushSendBatch();
 
 	bool HasMessage();
 	MessageContext* NextMessage();
 
 private:
-	OVERLAPPED overlapped;
+	IoRequest request;
 	WSABUF wsaBuf;
 	Packet* lpPacket;
 
-	queue<MessageContext*> msgQueue;
+	// Bind and Detach change these under csForSendQueue, which every post takes
+	SocketInfo* lpSocketInfo;
+	SOCKET sock;
+	SessionHandle owner;
+
+	MessageQueue msgQueue;
+
+	// outbound frames; the first inFlight of them belong to the send currently posted
+	std::deque<SendFrame*> sendQueue;
+	WSABUF gatherBufs[MAX_GATHER_FRAMES];
+	int inFlight;
+	bool sending;
+	bool deferred;			// sending is held until the batching thread flushes
+	long queuedBytes;
+	CRITICAL_SECTION csForSendQueue;
+
+	static int sendSoftBytes;
+	static int sendHardBytes;
+	static int sendSoftFrames;
+	static int sendHardFrames;
 
-	HANDLE hSemaForSend;
+	bool EnqueueFrame(SessionHandle session, SendFrame* frame);
+	bool ConflateFrame(SendFrame* frame);
+	bool PostQueuedFrames();
+	void PostDeferred();
 
 public:
 	bool called;
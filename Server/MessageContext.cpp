@@ -0,0 +1,51 @@
+#include "MessageContext.h"
+
+// contexts kept per thread; anything released beyond this goes back to the heap
+#define MAX_FREE_CONTEXTS 1024
+
+struct FreeContextList {
+	MessageContext* head;
+	int count;
+
+	FreeContextList() : head(nullptr), count(0) {}
+	~FreeContextList()
+	{
+		while (head != nullptr)
+		{
+			MessageContext* msgContext = head;
+			head = head->next;
+			delete msgContext;
+		}
+	}
+};
+
+static thread_local FreeContextList freeContexts;
+
+MessageContext* MessageContext::AllocateMessageContext()
+{
+	MessageContext* msgContext = freeContexts.head;
+	if (msgContext == nullptr)
+		return new MessageContext();
+
+	freeContexts.head = msgContext->next;
+	freeContexts.count--;
+
+	msgContext->header = Header();
+	msgContext->message = nullptr;
+	msgContext->frame = nullptr;
+	msgContext->next = nullptr;
+	return msgContext;
+}
+
+void MessageContext::DeallocateMessageContext(MessageContext* msgContext)
+{
+	if (freeContexts.count >= MAX_FREE_CONTEXTS)
+	{
+		delete msgContext;
+		return;
+	}
+
+	msgContext->next = freeContexts.head;
+	freeContexts.head = msgContext;
+	freeContexts.count++;
+}
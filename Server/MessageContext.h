@@ -1,8 +1,10 @@
 #pragma once
 
-class google::protobuf::MessageLite;
+namespace google { namespace protobuf { class MessageLite; } }
 using namespace google::protobuf;
 
+class SendFrame;
+
 struct Header {
 	int type;
 	int length;
@@ -13,6 +15,48 @@ struct Header {
 struct MessageContext {
 	Header header;
 	MessageLite* message;
+	SendFrame* frame;		// the frame verbatim, when it is only relayed and never decoded
+	MessageContext* next;	// link for MessageQueue and the free list
+
+	MessageContext() : message(nullptr), frame(nullptr), next(nullptr) {}
+
+	// Contexts are recycled through a per-thread free list, so a steady message stream
+	// never reaches the allocator. Deallocate may run on any thread.
+	static MessageContext* AllocateMessageContext();
+	static void DeallocateMessageContext(MessageContext* msgContext);
+};
+
+// FIFO of decoded messages linked through MessageContext::next.
+class MessageQueue {
+public:
+	MessageQueue() : head(nullptr), tail(nullptr) {}
+
+	bool Empty() const { return head == nullptr; }
+
+	void Push(MessageContext* msgContext)
+	{
+		msgContext->next = nullptr;
+		if (tail == nullptr)
+			head = msgContext;
+		else
+			tail->next = msgContext;
+		tail = msgContext;
+	}
+
+	MessageContext* Pop()
+	{
+		MessageContext* msgContext = head;
+		if (msgContext != nullptr)
+		{
+			head = msgContext->next;
+			if (head == nullptr)
+				tail = nullptr;
+			msgContext->next = nullptr;
+		}
+		return msgContext;
+	}
 
-	MessageContext() : message(nullptr) {}
+private:
+	MessageContext* head;
+	MessageContext* tail;
 };
@@ -0,0 +1,96 @@
+#include "Metrics.h"
+#include <cstdio>
+
+std::atomic<long> Metrics::accepted(0);
+std::atomic<long> Metrics::acceptFailed(0);
+std::atomic<long> Metrics::sendOverSoftMark(0);
+std::atomic<long> Metrics::sendConflated(0);
+std::atomic<long> Metrics::sendOverHardMark(0);
+std::atomic<long> Metrics::sendFailed(0);
+std::atomic<long> Metrics::slowConsumerKicks(0);
+std::atomic<long> Metrics::idleClosed(0);
+std::atomic<long> Metrics::pongs(0);
+std::atomic<long> Metrics::rttTotal(0);
+std::atomic<long> Metrics::roomTicks(0);
+std::atomic<long> Metrics::stateUpdates(0);
+std::atomic<long> Metrics::snapshotsSent(0);
+std::atomic<long> Metrics::fullSnapshots(0);
+std::atomic<long> Metrics::snapshotBytes(0);
+std::atomic<long> Metrics::statesDeferred(0);
+std::atomic<long> Metrics::loopBatchSizes[BATCH_BUCKETS];
+std::atomic<long> Metrics::roomBatchSizes[BATCH_BUCKETS];
+long Metrics::totalAccepted = 0;
+
+void Metrics::RecordBatch(std::atomic<long>* histogram, int size)
+{
+	int bucket = 0;
+	while (size > 1 && bucket < BATCH_BUCKETS - 1)
+	{
+		size >>= 1;
+		++bucket;
+	}
+	histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void Metrics::ReportHistogram(const char* name, std::atomic<long>* histogram)
+{
+	long counts[BATCH_BUCKETS];
+	long total = 0;
+	for (int i = 0; i < BATCH_BUCKETS; ++i)
+		total += counts[i] = histogram[i].exchange(0);
+	if (total == 0)
+		return;
+
+	printf("[Metrics] %s batches: %ld/s |", name, total);
+	for (int i = 0; i < BATCH_BUCKETS; ++i)
+	{
+		if (counts[i] == 0)
+			continue;
+		if (i == 0)
+			printf(" 1:%ld", counts[i]);
+		else if (i == BATCH_BUCKETS - 1)
+			printf(" %d+:%ld", 1 << i, counts[i]);
+		else
+			printf(" %d-%d:%ld", 1 << i, (2 << i) - 1, counts[i]);
+	}
+	printf("\n");
+}
+
+void Metrics::Report()
+{
+	long acceptedPerSec = accepted.exchange(0);
+	long failedPerSec = acceptFailed.exchange(0);
+	totalAccepted += acceptedPerSec;
+
+	if (acceptedPerSec != 0 || failedPerSec != 0)
+		printf("[Metrics] accept: %ld/s (failed %ld/s, total %ld)\n", acceptedPerSec, failedPerSec, totalAccepted);
+
+	long overSoft = sendOverSoftMark.exchange(0);
+	long conflated = sendConflated.exchange(0);
+	long overHard = sendOverHardMark.exchange(0);
+	long failed = sendFailed.exchange(0);
+	long kicks = slowConsumerKicks.exchange(0);
+	if (overSoft != 0 || overHard != 0 || failed != 0 || kicks != 0)
+		printf("[Metrics] send: over soft mark %ld/s (conflated %ld/s), over hard mark %ld/s, failed %ld/s, slow consumers closed %ld/s\n",
+			overSoft, conflated, overHard, failed, kicks);
+
+	long pongCount = pongs.exchange(0);
+	long rttSum = rttTotal.exchange(0);
+	long idle = idleClosed.exchange(0);
+	if (pongCount != 0 || idle != 0)
+		printf("[Metrics] heartbeat: %ld pongs/s (avg rtt %ld ms), idle closed %ld/s\n",
+			pongCount, pongCount != 0 ? rttSum / pongCount : 0, idle);
+
+	long ticks = roomTicks.exchange(0);
+	long updates = stateUpdates.exchange(0);
+	long snapshots = snapshotsSent.exchange(0);
+	long full = fullSnapshots.exchange(0);
+	long bytes = snapshotBytes.exchange(0);
+	long deferred = statesDeferred.exchange(0);
+	if (ticks != 0 || updates != 0)
+		printf("[Metrics] rooms: %ld ticks/s, %ld states/s in, %ld snapshots/s out (%ld full), avg %ld bytes, %ld states/s deferred\n",
+			ticks, updates, snapshots, full, snapshots != 0 ? bytes / snapshots : 0, deferred);
+
+	ReportHistogram("loop", loopBatchSizes);
+	ReportHistogram("room", roomBatchSizes);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <atomic>
+
+// histogram buckets by powers of two: 1, 2-3, 4-7, ... 256
+#define BATCH_BUCKETS 9
+
+// Process-wide counters. Workers bump them; ServerManager::MonitorServer prints and resets
+// the per-second ones once a second.
+class Metrics {
+public:
+	static std::atomic<long> accepted;
+	static std::atomic<long> acceptFailed;
+	static std::atomic<long> sendOverSoftMark;	// enqueues onto a queue above its soft mark
+	static std::atomic<long> sendConflated;		// frames that replaced a superseded one
+	static std::atomic<long> sendOverHardMark;	// sends refused at the hard mark
+	static std::atomic<long> sendFailed;		// room sends to sessions already closed or refusing
+	static std::atomic<long> slowConsumerKicks;	// connections closed for lagging
+	static std::atomic<long> idleClosed;		// connections reaped by the heartbeat
+	static std::atomic<long> pongs;
+	static std::atomic<long> rttTotal;			// ms, summed over pongs
+	static std::atomic<long> roomTicks;
+	static std::atomic<long> stateUpdates;		// player states applied to rooms
+	static std::atomic<long> snapshotsSent;		// snapshot frames queued to recipients by room ticks
+	static std::atomic<long> fullSnapshots;		// of which full, the rest are deltas
+	static std::atomic<long> snapshotBytes;
+	static std::atomic<long> statesDeferred;	// player states held back by a client's snapshot budget
+
+	// completions handled per dequeue, by event loop workers and by room threads
+	static std::atomic<long> loopBatchSizes[BATCH_BUCKETS];
+	static std::atomic<long> roomBatchSizes[BATCH_BUCKETS];
+	static void RecordBatch(std::atomic<long>* histogram, int size);
+
+	static void Report();
+
+private:
+	static long totalAccepted;
+	static void ReportHistogram(const char* name, std::atomic<long>* histogram);
+};
@@ -1,4 +1,6 @@
+#include <climits>
 #include "Packet.h"
+#include "SendFrame.h"
 #include "def.h"
 
 Packet::TypeMap Packet::typeMap = {
@@ -23,118 +25,150 @@ Packet::InvTypeMap Packet::invTypeMap = {
 	{MessageType::WORLD_STATE, typeid(WorldState)}
 };
 
+// Decoded messages live in the arena of the worker that parsed them, until that worker
+// finishes the completion and calls ResetDecodeArena.
+static thread_local Arena decodeArena;
+
+int Packet::maxMessageSize = DEFAULT_MAX_MESSAGE_SIZE;
+
 Packet::Packet() 
 {
-	backup = pack = nullptr;
-	backupLength = 0;
-	memset(buffer, 0, FOR_IO_SIZE);
+	readPos = writePos = 0;
+	largeFrame = nullptr;
+	largeLength = largeFilled = 0;
 }
 
 Packet::~Packet() 
 {
+	delete[] largeFrame;
 
 }
 
-int Packet::PackMessage(int type, MessageLite* message)
+void Packet::PackMessage(char* dst, DWORD length, int type, MessageLite* message)
 {
-	int msgLength = 8;
-	if (message != nullptr)
-		msgLength += message->ByteSize();
-
-	pack = new char[msgLength];
-	aos = new ArrayOutputStream(pack, msgLength);
-	cos = new CodedOutputStream(aos);
-
-	if (message == nullptr)
+	// several threads may pack for the same connection, so nothing here touches members
+	ArrayOutputStream aos(dst, length);
 	{
-		assert(type != -1);
-		cos->WriteLittleEndian32(type);
-		cos->WriteLittleEndian32(0);
-	}
-	else
-	{
-		Serialize(cos, message);
+		// CodedOutputStream may hold the tail of a small message until it is destroyed
+		CodedOutputStream cos(&aos);
+		if (message == nullptr)
+		{
+			assert(type != -1);
+			cos.WriteLittleEndian32(type);
+			cos.WriteLittleEndian32(0);
+		}
+		else
+		{
+			Serialize(&cos, message);
+		}
 	}
-
-	CopyMemory(buffer, pack, msgLength);
-
-	delete cos;
-	delete aos;
-	delete pack;
-	return msgLength;
 }
 
-void Packet::UnpackHeader(int& type, int& length)
+void Packet::UnpackHeader(const char* src, int& type, int& length)
 {
-	ais = new ArrayInputStream(pack, 8);
-	cis = new CodedInputStream(ais);
-
-	cis->ReadLittleEndian32((uint*)&type);
-	cis->ReadLittleEndian32((uint*)&length);
-
-	delete cis;
-	delete ais;
+	// both fields are little-endian int32, like the rest of the wire format
+	uint32 field;
+	CodedInputStream::ReadLittleEndian32FromArray((const uint8*)src, &field);
+	type = (int)field;
+	CodedInputStream::ReadLittleEndian32FromArray((const uint8*)src + 4, &field);
+	length = (int)field;
 }
 
-void Packet::UnpackMessage(int& readBytes)
+bool Packet::UnpackMessage(int readBytes, bool relayOnly)
 {
-	int totalLength = readBytes;
-	if (backup != nullptr)
-	{
-		pack = new char[backupLength + readBytes];
-		CopyMemory(pack, backup, backupLength);
-		CopyMemory(pack + backupLength, buffer, readBytes);
-
-		totalLength += backupLength;
-		delete backup;
-		backup = nullptr;
-		backupLength = 0;
-	}
-	else
-	{
-		pack = new char[readBytes];
-		CopyMemory(pack, buffer, readBytes);
-	}
+	if (largeFrame != nullptr)
+		return ContinueLargeFrame(readBytes, relayOnly);
+
+	writePos += readBytes;
 
-	int loop = 0;
-	int offset = 0;
-	while(offset < totalLength)
+	while (writePos - readPos >= HEADER_SIZE)
 	{
-		if ((totalLength - offset) < 8)
-		{
-			BackupStream(offset, totalLength);
-			delete pack;
-			return;
-		}
-		
 		int type, length;
-		UnpackHeader(type, length);
-		offset += 8;
-		
-		MessageContext* msgContext = new MessageContext();
-		msgContext->header.type = (int)type;
-		msgContext->header.length = (int)length;
-
-		if (length == 0) 
+		UnpackHeader(buffer + readPos, type, length);
+		if (length < 0 || length > maxMessageSize - HEADER_SIZE)
 		{
-			msgQueue->push(msgContext);
-			continue;
+			fprintf(stderr, "Invalid frame length... %d\n", length);
+			return false;
 		}
 
-		if (length > (totalLength - offset))
+		int available = writePos - readPos;
+		if (available < HEADER_SIZE + length)
 		{
-			BackupStream(offset, totalLength);
-			delete pack;
-			return;
+			if (HEADER_SIZE + length > INLINE_FRAME_SIZE)
+			{	// take what has arrived so far and let the rest be received in place
+				largeLength = HEADER_SIZE + length;
+				largeFrame = new char[largeLength];
+				CopyMemory(largeFrame, buffer + readPos, available);
+				largeFilled = available;
+				readPos = writePos;
+			}
+			break;
 		}
 
-		Deserialize(type, length, offset, msgContext->message);
-		offset += length;
+		PushMessage(type, length, buffer + readPos, relayOnly);
+		readPos += HEADER_SIZE + length;
+	}
+
+	CompactBuffer();
+	return true;
+}
+
+bool Packet::ContinueLargeFrame(int readBytes, bool relayOnly)
+{
+	// recvs never ask for more than the frame still needs, so nothing spills past it
+	largeFilled += readBytes;
+	if (largeFilled < largeLength)
+		return true;
+
+	int type, length;
+	UnpackHeader(largeFrame, type, length);
+	PushMessage(type, length, largeFrame, relayOnly);
+
+	delete[] largeFrame;
+	largeFrame = nullptr;
+	largeLength = largeFilled = 0;
+	return true;
+}
 
-		msgQueue->push(msgContext);
+void Packet::PushMessage(int type, int length, const char* frame, bool relayOnly)
+{
+	MessageContext* msgContext = MessageContext::AllocateMessageContext();
+	msgContext->header.type = type;
+	msgContext->header.length = length;
+	if (relayOnly)
+	{
+		msgContext->frame = SendFrame::Create(frame, HEADER_SIZE + length);
+		msgContext->frame->type = type;
 	}
+	else if (length != 0)
+	{
+		Deserialize(type, length, frame + HEADER_SIZE, msgContext->message);
+	}
+
+	msgQueue->Push(msgContext);
+}
+
+char* Packet::WritePtr()
+{
+	return largeFrame != nullptr ? largeFrame + largeFilled : buffer + writePos;
+}
+
+int Packet::WritableBytes() const
+{
+	return largeFrame != nullptr ? largeLength - largeFilled : RECV_BUFFER_SIZE - writePos;
+}
 
-	delete pack;
+void Packet::Reset()
+{
+	delete[] largeFrame;
+	largeFrame = nullptr;
+	largeLength = largeFilled = 0;
+	readPos = writePos = 0;
+}
+
+void Packet::SetMaxMessageSize(int size)
+{
+	maxMessageSize = size < INLINE_FRAME_SIZE ? INLINE_FRAME_SIZE : size;
 }
 
 bool Packet::CheckValidType(int& type)
@@ -142,27 +176,40 @@ bool Packet::CheckValidType(int& type)
 	return invTypeMap.find(type) != invTypeMap.end();
 }
 
-void Packet::BackupStream(int& offset, int& totalLength)
+void Packet::CompactBuffer()
 {
-	int remain = totalLength - offset;
-	backup = new char[remain];
-	backupLength = remain;
-	CopyMemory(backup, pack + offset, remain);
+	if (readPos == writePos)
+	{
+		readPos = writePos = 0;
+		return;
+	}
+
+	// only a partial frame is ever moved, and only once the tail gets too short for a full recv
+	if (WritableBytes() < FOR_IO_SIZE)
+	{
+		memmove(buffer, buffer + readPos, writePos - readPos);
+		writePos -= readPos;
+		readPos = 0;
+	}
 }
 
-void Packet::Serialize(CodedOutputStream*& cos, MessageLite*& message)
+void Packet::Serialize(CodedOutputStream* cos, MessageLite*& message)
 {
 	int contentType = typeMap[typeid(*message)];
-	int contentLength = message->ByteSize();
+	size_t byteSize = message->ByteSizeLong();
+	// the header carries an int32 length
+	if (byteSize > INT_MAX)
+		ErrorHandling("Message too large to serialize....");
+	int contentLength = (int)byteSize;
 
 	//fprintf(stderr, "[ContentType]: %d, [ContentLength]: %d\n", contentType, contentLength);
 
 	cos->WriteLittleEndian32(contentType);
 	cos->WriteLittleEndian32(contentLength);
-	message->SerializeToCodedStream(cos);
+	message->SerializeWithCachedSizes(cos);
 }
 
-void Packet::Deserialize(int& type, int& length, int& offset, MessageLite*& message)
+void Packet::Deserialize(int& type, int& length, const char* body, MessageLite*& message)
 {
 	if (!CheckValidType(type)) {
 		fprintf(stderr, "Invalid type... %d\n", type);
@@ -171,33 +218,32 @@ void Packet::Deserialize(int& type, int& length, int& offset, MessageLite*& mess
 
 	if (type == MessageType::DATA)
 	{
-		message = new Data();
+		message = Arena::Create<Data>(&decodeArena);
 	}
 	else if (type == MessageType::PLAY_STATE)
 	{
-		message = new PlayState();
+		message = Arena::Create<PlayState>(&decodeArena);
 	}
 	else if (type == MessageType::TRANSFORM)
 	{
-		message = new TransformProto();
+		message = Arena::Create<TransformProto>(&decodeArena);
 	}
 	else if (type == MessageType::VECTOR_3)
 	{
-		message = new Vector3Proto();
+		message = Arena::Create<Vector3Proto>(&decodeArena);
 	}
 	else if (type == MessageType::WORLD_STATE)
 	{
-		message = new WorldState();
+		message = Arena::Create<WorldState>(&decodeArena);
 	}
 	else {
 		return;
 	}
 
-	ais = new ArrayInputStream(pack + offset, length);
-	cis = new CodedInputStream(ais);
-	bool check = message->ParseFromCodedStream(cis);
+	CodedInputStream cis((const uint8*)body, length);
+	bool check = message->ParseFromCodedStream(&cis);
 	if (check) {
-		if (cis->ConsumedEntireMessage()) {
+		if (cis.ConsumedEntireMessage()) {
 			//printf("ConsumedEntireMessage return true!\n");
 		}
 		else {
@@ -207,11 +253,14 @@ void Packet::Deserialize(int& type, int& length, int& offset, MessageLite*& mess
 	else {
 		printf("ParseFromCodedStream return false!\n");
 	}
-	delete cis;
-	delete ais;
 }
 
-Packet* Packet::AllocatePacket(queue<MessageContext*> *msgQueue)
+void Packet::ResetDecodeArena()
+{
+	decodeArena.Reset();
+}
+
+Packet* Packet::AllocatePacket(MessageQueue* msgQueue)
 {
 	Packet* lpPacket = new Packet();
 	lpPacket->msgQueue = msgQueue;
@@ -3,57 +3,78 @@
 #include <google/protobuf/util/time_util.h>
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <google/protobuf/message_lite.h>
+#include <google/protobuf/arena.h>
 
 #include <unordered_map>
-#include <queue>
+#include <string>
 #include <typeindex>
 #include <typeinfo>
 #include <cassert>
 #include <cstring>
 
+#include "Platform.h"
 #include "MessageContext.h"
 #include "ErrorHandle.h"
 #include "protobuf/room.pb.h"
 #include "protobuf/PlayState.pb.h"
 #include "protobuf/data.pb.h"
 
-using std::queue;
+using std::string;
 using namespace packet;
 using namespace state;
 using namespace google::protobuf;
 using namespace google::protobuf::io;
 
 #define FOR_IO_SIZE 4096
-#define FOR_BAKCUP_SIZE 2048
-#define FOR_PACK_SIZE 4096
-#define MAX_SIZE 4096
+// receive buffer: one whole frame plus room for the next recv behind it
+#define RECV_BUFFER_SIZE (2 * FOR_IO_SIZE)
+#define HEADER_SIZE 8
+// frames up to this size are parsed straight out of the receive buffer
+#define INLINE_FRAME_SIZE (RECV_BUFFER_SIZE - FOR_IO_SIZE)
 
 class Packet {
 public:
 	Packet();
 	~Packet();
 
-	int PackMessage(int type = -1, MessageLite* message = nullptr);
-	void UnpackMessage(int& totalLength);
+	// Writes the framed message into dst, which must hold 8 + message->ByteSize() bytes.
+	static void PackMessage(char* dst, DWORD length, int type = -1, MessageLite* message = nullptr);
+	// Parses every complete frame in the receive buffer after readBytes more arrived at WritePtr().
+	// Returns false if the stream can never yield a valid frame.
+	// With relayOnly, frames are not decoded but copied whole into MessageContext::frame.
+	bool UnpackMessage(int readBytes, bool relayOnly = false);
+	// Frees every message this thread decoded so far in one go. Nothing decoded before the
+	// call may be touched afterwards.
+	static void ResetDecodeArena();
+	// Discards buffered bytes, e.g. when the owning session slot is reused.
+	void Reset();
+
+	// Where the next recv lands: the free tail of the receive buffer (at least FOR_IO_SIZE
+	// bytes), or the rest of a large frame being reassembled.
+	char* WritePtr();
+	int WritableBytes() const;
+
+	// Inbound frames above this are refused; it also bounds the reassembly buffer per connection.
+	static void SetMaxMessageSize(int size);
 
 public:
-	static Packet* AllocatePacket(queue<MessageContext*> *msgQueue);
+	static Packet* AllocatePacket(MessageQueue* msgQueue);
 	static void DeallocatePacket(Packet* lpPacket);
 
-public:
-	char buffer[FOR_IO_SIZE];
-
 private:
-	ArrayInputStream* ais;
-	ArrayOutputStream* aos;
-	CodedInputStream* cis;
-	CodedOutputStream* cos;
+	// bytes [readPos, writePos) are received but not yet parsed; a partial frame stays in place
+	char buffer[RECV_BUFFER_SIZE];
+	int readPos;
+	int writePos;
+
+	// a frame too big for the buffer is collected here, one exact-size recv after another
+	char* largeFrame;
+	int largeLength;
+	int largeFilled;
 
-	char* backup;
-	char* pack;
-	int backupLength;
+	static int maxMessageSize;
 
-	queue<MessageContext*> *msgQueue;
+	MessageQueue* msgQueue;
 
 private:
 	typedef std::unordered_map<std::type_index, int> TypeMap;
@@ -62,11 +83,13 @@ private:
 	static InvTypeMap invTypeMap;
 
 private:
-	void UnpackHeader(int& type, int& length);
+	void UnpackHeader(const char* src, int& type, int& length);
 
 	bool CheckValidType(int& type);
-	void BackupStream(int& offset, int& readBytes);
+	void CompactBuffer();
+	void PushMessage(int type, int length, const char* frame, bool relayOnly);
+	bool ContinueLargeFrame(int readBytes, bool relayOnly);
 
-	void Serialize(CodedOutputStream*&, MessageLite*&);
-	void Deserialize(int& type, int& length, int& offset, MessageLite*& message);
+	static void Serialize(CodedOutputStream*, MessageLite*&);
+	void Deserialize(int& type, int& length, const char* body, MessageLite*& message);
 };
\ No newline at end of file
@@ -0,0 +1,156 @@
+#include "Platform.h"
+#ifndef _WIN32
+#include <dirent.h>
+#include <sched.h>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#endif
+
+#ifdef _WIN32
+
+#define BEGINTHREADEX(psa, cbStack, pfnStartAddr, \
+   pvParam, fdwCreate, pdwThreadId)                 \
+      ((HANDLE)_beginthreadex(                      \
+         (void *)        (psa),                     \
+         (unsigned)      (cbStack),                 \
+         (PTHREAD_START) (pfnStartAddr),            \
+         (void *)        (pvParam),                 \
+         (unsigned)      (fdwCreate),               \
+         (unsigned *)    (pdwThreadId)))
+
+bool StartThread(PTHREAD_START pfnStartAddr, void* pvParam)
+{
+	DWORD dwThreadId = 0;
+	HANDLE hThread = BEGINTHREADEX(NULL, 0, pfnStartAddr, pvParam, 0, &dwThreadId);
+	if (hThread == NULL)
+		return false;
+
+	CloseHandle(hThread);
+	return true;
+}
+
+int GetNumberOfProcessors()
+{
+	SYSTEM_INFO sysinfo;
+	GetSystemInfo(&sysinfo);
+	return (int)sysinfo.dwNumberOfProcessors;
+}
+
+bool SetCurrentThreadAffinity(int processor)
+{	// processor groups are not handled, only the first 64 processors can be pinned
+	if (processor < 0 || processor >= 64)
+		return false;
+	return SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << processor) != 0;
+}
+
+int GetNumaNodeOfProcessor(int processor)
+{
+	UCHAR node = 0;
+	if (processor < 0 || processor > 255 || !GetNumaProcessorNode((UCHAR)processor, &node))
+		return 0;
+	return (int)node;
+}
+
+ULONGLONG GetMicroseconds()
+{
+	static LARGE_INTEGER frequency = [] {
+		LARGE_INTEGER f;
+		QueryPerformanceFrequency(&f);
+		return f;
+	}();
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter(&counter);
+	return (ULONGLONG)(counter.QuadPart / frequency.QuadPart) * 1000000
+		+ (ULONGLONG)(counter.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart;
+}
+
+ULONGLONG GetCurrentThreadCpuMicros()
+{
+	FILETIME creation, exit, kernel, user;
+	if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+		return 0;
+	ULONGLONG ticks = ((ULONGLONG)kernel.dwHighDateTime << 32 | kernel.dwLowDateTime)
+		+ ((ULONGLONG)user.dwHighDateTime << 32 | user.dwLowDateTime);
+	return ticks / 10;	// 100ns units
+}
+
+#else
+
+struct ThreadStart {
+	PTHREAD_START pfnStartAddr;
+	void* pvParam;
+};
+
+static void* ThreadTrampoline(void* pVoid)
+{
+	ThreadStart start = *(ThreadStart*)pVoid;
+	delete (ThreadStart*)pVoid;
+	start.pfnStartAddr(start.pvParam);
+	return nullptr;
+}
+
+bool StartThread(PTHREAD_START pfnStartAddr, void* pvParam)
+{
+	pthread_t thread;
+	ThreadStart* start = new ThreadStart{ pfnStartAddr, pvParam };
+	if (pthread_create(&thread, NULL, ThreadTrampoline, start) != 0) {
+		delete start;
+		return false;
+	}
+
+	pthread_detach(thread);
+	return true;
+}
+
+int GetNumberOfProcessors()
+{
+	return (int)sysconf(_SC_NPROCESSORS_ONLN);
+}
+
+bool SetCurrentThreadAffinity(int processor)
+{
+	if (processor < 0 || processor >= CPU_SETSIZE)
+		return false;
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(processor, &set);
+	return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+int GetNumaNodeOfProcessor(int processor)
+{	// sysfs lists the node as a nodeN entry in the processor's directory
+	char path[64];
+	snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d", processor);
+	DIR* dir = opendir(path);
+	if (dir == NULL)
+		return 0;
+
+	int node = 0;
+	while (dirent* entry = readdir(dir))
+	{
+		if (strncmp(entry->d_name, "node", 4) == 0 && isdigit((unsigned char)entry->d_name[4]))
+		{
+			node = atoi(entry->d_name + 4);
+			break;
+		}
+	}
+	closedir(dir);
+	return node;
+}
+
+ULONGLONG GetMicroseconds()
+{
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ULONGLONG)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+ULONGLONG GetCurrentThreadCpuMicros()
+{
+	timespec ts;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+	return (ULONGLONG)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+#endif
@@ -0,0 +1,97 @@
+#pragma once
+
+// Win32 names used throughout the server. On Windows they come straight from the SDK,
+// elsewhere they are mapped onto POSIX so the same sources build on Linux.
+
+#ifdef _WIN32
+
+#include <WinSock2.h>
+#include <WS2tcpip.h>
+#include <Windows.h>
+#include <process.h>
+
+#else
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+typedef int SOCKET;
+typedef uint32_t DWORD;
+typedef uint64_t ULONGLONG;
+typedef uintptr_t ULONG_PTR;
+typedef void* HANDLE;
+typedef sockaddr SOCKADDR;
+typedef sockaddr_in SOCKADDR_IN;
+typedef linger LINGER;
+
+struct WSABUF {
+	unsigned long len;
+	char* buf;
+};
+
+#define __stdcall
+#define INVALID_SOCKET (-1)
+#define SOCKET_ERROR (-1)
+#define INFINITE 0xFFFFFFFF
+#define WSAEINTR EINTR
+#define WSA_IO_PENDING EINPROGRESS
+
+#define closesocket(s) close(s)
+#define WSAGetLastError() errno
+#define GetLastError() errno
+#define ZeroMemory(dst, len) memset((dst), 0, (len))
+#define CopyMemory(dst, src, len) memcpy((dst), (src), (len))
+
+typedef pthread_mutex_t CRITICAL_SECTION;
+
+inline void InitializeCriticalSection(CRITICAL_SECTION* cs)
+{	// Win32 critical sections are re-entrant
+	pthread_mutexattr_t attr;
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(cs, &attr);
+	pthread_mutexattr_destroy(&attr);
+}
+
+inline void DeleteCriticalSection(CRITICAL_SECTION* cs) { pthread_mutex_destroy(cs); }
+inline void EnterCriticalSection(CRITICAL_SECTION* cs) { pthread_mutex_lock(cs); }
+inline void LeaveCriticalSection(CRITICAL_SECTION* cs) { pthread_mutex_unlock(cs); }
+
+inline DWORD GetCurrentThreadId() { return (DWORD)syscall(SYS_gettid); }
+inline void Sleep(DWORD dwMilliseconds) { usleep((useconds_t)dwMilliseconds * 1000); }
+
+inline ULONGLONG GetTickCount64()
+{	// milliseconds on a monotonic clock
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ULONGLONG)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+#endif
+
+typedef unsigned (__stdcall *PTHREAD_START) (void *);
+
+// Starts a detached thread running pfnStartAddr(pvParam).
+bool StartThread(PTHREAD_START pfnStartAddr, void* pvParam);
+
+int GetNumberOfProcessors();
+
+// Pins the calling thread to one logical processor.
+bool SetCurrentThreadAffinity(int processor);
+// NUMA node the processor belongs to, 0 when the system does not say.
+int GetNumaNodeOfProcessor(int processor);
+
+// Monotonic wall clock and the calling thread's CPU time, both in microseconds.
+ULONGLONG GetMicroseconds();
+ULONGLONG GetCurrentThreadCpuMicros();
@@ -0,0 +1,146 @@
+#include <cmath>
+#include "Quantize.h"
+
+#define POSITION_MAX ((1u << QUANT_POSITION_BITS) - 1)
+#define ROTATION_MAX ((1u << QUANT_ROTATION_BITS) - 1)
+// the three smallest components of a unit quaternion lie within +-1/sqrt(2)
+#define ROTATION_RANGE 0.70710678f
+#define DEG_TO_RAD 0.017453292519943295f
+#define RAD_TO_DEG 57.29577951308232f
+
+static uint32_t PackCoordinate(float value, float bound)
+{
+	float unit = (value + bound) / (2.0f * bound);
+	if (!(unit > 0.0f))		// also catches NaN
+		return 0;
+	if (unit >= 1.0f)
+		return POSITION_MAX;
+	return (uint32_t)(unit * POSITION_MAX + 0.5f);
+}
+
+static float UnpackCoordinate(uint32_t value, float bound)
+{
+	return (float)value / POSITION_MAX * (2.0f * bound) - bound;
+}
+
+uint64_t PackPosition(const state::Vector3Proto& position, float bound)
+{
+	return (uint64_t)PackCoordinate(position.x(), bound)
+		| ((uint64_t)PackCoordinate(position.y(), bound) << QUANT_POSITION_BITS)
+		| ((uint64_t)PackCoordinate(position.z(), bound) << (2 * QUANT_POSITION_BITS));
+}
+
+void UnpackPosition(uint64_t packed, float bound, state::Vector3Proto* position)
+{
+	position->set_x(UnpackCoordinate((uint32_t)(packed & POSITION_MAX), bound));
+	position->set_y(UnpackCoordinate((uint32_t)((packed >> QUANT_POSITION_BITS) & POSITION_MAX), bound));
+	position->set_z(UnpackCoordinate((uint32_t)((packed >> (2 * QUANT_POSITION_BITS)) & POSITION_MAX), bound));
+}
+
+uint32_t PackRotation(const state::Vector3Proto& eulerDegrees)
+{
+	if (!std::isfinite(eulerDegrees.x()) || !std::isfinite(eulerDegrees.y()) || !std::isfinite(eulerDegrees.z()))
+		return PackRotation(state::Vector3Proto());
+
+	float hx = eulerDegrees.x() * DEG_TO_RAD * 0.5f;
+	float hy = eulerDegrees.y() * DEG_TO_RAD * 0.5f;
+	float hz = eulerDegrees.z() * DEG_TO_RAD * 0.5f;
+	float cx = cosf(hx), sx = sinf(hx);
+	float cy = cosf(hy), sy = sinf(hy);
+	float cz = cosf(hz), sz = sinf(hz);
+
+	// q = qy * qx * qz, components x, y, z, w
+	float q[4] = {
+		sx * cy * cz + cx * sy * sz,
+		cx * sy * cz - sx * cy * sz,
+		cx * cy * sz - sx * sy * cz,
+		cx * cy * cz + sx * sy * sz
+	};
+
+	int largest = 0;
+	for (int i = 1; i < 4; ++i)
+	{
+		if (fabsf(q[i]) > fabsf(q[largest]))
+			largest = i;
+	}
+	// q and -q are the same rotation, so the dropped component is always taken as positive
+	float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+
+	uint32_t packed = (uint32_t)largest;
+	for (int i = 0; i < 4; ++i)
+	{
+		if (i == largest)
+			continue;
+		float unit = (q[i] * sign + ROTATION_RANGE) / (2.0f * ROTATION_RANGE);
+		if (unit < 0.0f)
+			unit = 0.0f;
+		if (unit > 1.0f)
+			unit = 1.0f;
+		packed = (packed << QUANT_ROTATION_BITS) | (uint32_t)(unit * ROTATION_MAX + 0.5f);
+	}
+	return packed;
+}
+
+void UnpackRotation(uint32_t packed, state::Vector3Proto* eulerDegrees)
+{
+	int largest = (int)(packed >> (3 * QUANT_ROTATION_BITS));
+	float q[4];
+	float sum = 0.0f;
+	int shift = 2 * QUANT_ROTATION_BITS;
+	for (int i = 0; i < 4; ++i)
+	{
+		if (i == largest)
+			continue;
+		uint32_t value = (packed >> shift) & ROTATION_MAX;
+		q[i] = (float)value / ROTATION_MAX * (2.0f * ROTATION_RANGE) - ROTATION_RANGE;
+		sum += q[i] * q[i];
+		shift -= QUANT_ROTATION_BITS;
+	}
+	q[largest] = sum < 1.0f ? sqrtf(1.0f - sum) : 0.0f;
+
+	float x = q[0], y = q[1], z = q[2], w = q[3];
+	float sinX = 2.0f * (w * x - y * z);
+	if (sinX > 1.0f)
+		sinX = 1.0f;
+	if (sinX < -1.0f)
+		sinX = -1.0f;
+	eulerDegrees->set_x(asinf(sinX) * RAD_TO_DEG);
+	eulerDegrees->set_y(atan2f(2.0f * (x * z + w * y), 1.0f - 2.0f * (x * x + y * y)) * RAD_TO_DEG);
+	eulerDegrees->set_z(atan2f(2.0f * (x * y + w * z), 1.0f - 2.0f * (x * x + z * z)) * RAD_TO_DEG);
+}
+
+bool IsUnitScale(const state::Vector3Proto& scale)
+{
+	return scale.x() == 1.0f && scale.y() == 1.0f && scale.z() == 1.0f;
+}
+
+void PackTransform(const state::TransformProto& transform, float bound, state::CompactTransform* compact)
+{
+	compact->Clear();
+	if (transform.has_position())
+		compact->set_position(PackPosition(transform.position(), bound));
+	if (transform.has_rotation())
+		compact->set_rotation(PackRotation(transform.rotation()));
+	if (transform.has_scale() && !IsUnitScale(transform.scale()))
+		*compact->mutable_scale() = transform.scale();
+}
+
+void UnpackTransform(const state::CompactTransform& compact, float bound, state::TransformProto* transform)
+{
+	transform->Clear();
+	if (compact.has_position())
+		UnpackPosition(compact.position(), bound, transform->mutable_position());
+	if (compact.has_rotation())
+		UnpackRotation(compact.rotation(), transform->mutable_rotation());
+	state::Vector3Proto* scale = transform->mutable_scale();
+	if (compact.has_scale())
+	{
+		*scale = compact.scale();
+	}
+	else
+	{
+		scale->set_x(1.0f);
+		scale->set_y(1.0f);
+		scale->set_z(1.0f);
+	}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include "protobuf/PlayState.pb.h"
+
+// Compact TransformProto kernels behind CompactTransform in PlayState.proto.
+// Positions are fixed point over a cube of +-bound on each axis, rotations (Euler angles in
+// degrees, applied Z, X, then Y) travel as smallest-three quaternions in 32 bits.
+#define QUANT_POSITION_BITS 21
+#define QUANT_ROTATION_BITS 10
+
+// Three QUANT_POSITION_BITS values, x lowest. Coordinates outside +-bound are clamped, NaN
+// goes out as -bound.
+uint64_t PackPosition(const state::Vector3Proto& position, float bound);
+void UnpackPosition(uint64_t packed, float bound, state::Vector3Proto* position);
+
+// Index of the largest quaternion component in the top two bits, the other three below it.
+// Clients should apply the decoded quaternion itself: back in Euler angles the error grows
+// near x = +-90 degrees, where y and z turn into the same axis. NaN or infinite angles go out as
+// no rotation.
+uint32_t PackRotation(const state::Vector3Proto& eulerDegrees);
+void UnpackRotation(uint32_t packed, state::Vector3Proto* eulerDegrees);
+
+bool IsUnitScale(const state::Vector3Proto& scale);
+
+// The vectors transform has, scale left out when it is (1, 1, 1).
+void PackTransform(const state::TransformProto& transform, float bound, state::CompactTransform* compact);
+// The client's side: an absent scale is (1, 1, 1).
+void UnpackTransform(const state::CompactTransform& compact, float bound, state::TransformProto* transform);
@@ -1,270 +1,891 @@
-#include <process.h>
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <cassert>
 #include "def.h"
 #include "Room.h"
+#include "RoomExecutor.h"
 #include "ServerManager.h"
+#include "MessageContext.h"
+#include "protobuf/data.pb.h"
+#include "Metrics.h"
 
 
-Room::Room(RoomInfo * initVal) : roomInfo(initVal)
+// tasks a thread keeps for itself; past this they go to the shared list for the posting threads
+#define MAX_LOCAL_TASKS 64
+// tasks kept in the shared list; anything released beyond this goes back to the heap
+#define MAX_SHARED_TASKS 4096
+
+struct FreeTaskList {
+	RoomTask* head;
+	int count;
+
+	FreeTaskList() : head(nullptr), count(0) {}
+	~FreeTaskList()
+	{
+		while (head != nullptr)
+		{
+			RoomTask* task = head;
+			head = head->next.load(std::memory_order_relaxed);
+			delete task;
+		}
+	}
+};
+
+static thread_local FreeTaskList freeTasks;
+// Tasks are mostly freed on room threads and allocated on event loop workers. Room threads
+// hand theirs over MAX_LOCAL_TASKS at a time, and a worker that runs out takes the whole list.
+static FreeTaskList sharedFreeTasks;
+static CRITICAL_SECTION csForFreeTasks;
+
+static struct FreeTaskListInit {
+	FreeTaskListInit() { InitializeCriticalSection(&csForFreeTasks); }
+} freeTaskListInit;
+
+RoomTask* RoomTask::AllocateRoomTask()
+{
+	if (freeTasks.head == nullptr)
+	{
+		EnterCriticalSection(&csForFreeTasks);
+		freeTasks.head = sharedFreeTasks.head;
+		freeTasks.count = sharedFreeTasks.count;
+		sharedFreeTasks.head = nullptr;
+		sharedFreeTasks.count = 0;
+		LeaveCriticalSection(&csForFreeTasks);
+		if (freeTasks.head == nullptr)
+			return new RoomTask();
+	}
+
+	RoomTask* task = freeTasks.head;
+	freeTasks.head = task->next.load(std::memory_order_relaxed);
+	freeTasks.count--;
+
+	task->next.store(nullptr, std::memory_order_relaxed);
+	task->type = 0;
+	task->session = INVALID_SESSION;
+	task->message = 0;
+	task->userName.clear();
+	return task;
+}
+
+void RoomTask::DeallocateRoomTask(RoomTask* task)
 {
-	InitializeCriticalSection(&csForClientSockets);
-	InitializeCriticalSection(&csForRoomInfo);
-	InitializeCriticalSection(&csForBroadcast);
+	task->next.store(freeTasks.head, std::memory_order_relaxed);
+	freeTasks.head = task;
+	if (++freeTasks.count < MAX_LOCAL_TASKS)
+		return;
+
+	// find the end of the local list outside the lock
+	RoomTask* last = freeTasks.head;
+	for (RoomTask* next; (next = last->next.load(std::memory_order_relaxed)) != nullptr; )
+		last = next;
+
+	EnterCriticalSection(&csForFreeTasks);
+	if (sharedFreeTasks.count < MAX_SHARED_TASKS)
+	{
+		last->next.store(sharedFreeTasks.head, std::memory_order_relaxed);
+		sharedFreeTasks.head = freeTasks.head;
+		sharedFreeTasks.count += freeTasks.count;
+		freeTasks.head = nullptr;
+		freeTasks.count = 0;
+	}
+	LeaveCriticalSection(&csForFreeTasks);
+
+	// the shared list is full: this thread's goes back to the heap
+	while (freeTasks.head != nullptr)
+	{
+		RoomTask* freed = freeTasks.head;
+		freeTasks.head = freed->next.load(std::memory_order_relaxed);
+		delete freed;
+	}
+	freeTasks.count = 0;
+}
+
+Room::Room(const RoomInfo& initVal, SessionHandle host, RoomExecutor* executor) : roomInfo(initVal), executor(executor)
+{
+	members[host].client = roomInfo.mutable_redteam(0);
 	gameStarted = false;
+	closed = false;
+	nextTickAt = 0;
+	tickNumber = 0;
+	statesDeferred = false;
+	RebuildSlots();
+	cleanupTimer.context = this;
+	tickTimer.context = this;
+	tickTimer.callback = Room::OnTick;
+	mailboxHead = &mailboxStub;
+	mailboxTail = &mailboxStub;
+	pendingTasks = 0;
 }
 
 Room::~Room()
 {
-	DeleteCriticalSection(&csForClientSockets);
-	DeleteCriticalSection(&csForRoomInfo);
-	DeleteCriticalSection(&csForBroadcast);
-	CloseHandle(hCompPort);
+	RoomTask* task;
+	while ((task = Pop()) != nullptr)
+	{
+		DiscardTask(task);
+		RoomTask::DeallocateRoomTask(task);
+	}
 
 	std::cout << "~Room() called" << std::endl;
 }
 
-void Room::AddClientInfo(SocketInfo * lpSocketInfo, string& userName)
+void Room::Post(DWORD type, SessionHandle session, ULONG_PTR message, const string& userName)
 {
-	EnterCriticalSection(&csForClientSockets);
-	clientSockets.push_front(lpSocketInfo);
-	LeaveCriticalSection(&csForClientSockets);
-	clientMap[userName] = lpSocketInfo;
+	RoomTask* task = RoomTask::AllocateRoomTask();
+	task->type = type;
+	task->session = session;
+	task->message = message;
+	task->userName = userName;
+	Push(task);
+
+	// only the first task of an idle room puts it on the executor
+	if (pendingTasks.fetch_add(1) == 0)
+		executor->Schedule(this);
 }
 
-void Room::RemoveClientInfo(SocketInfo * lpSocketInfo, string& userName)
+void Room::InsertDataIntoBroadcastQueue(DWORD additionalData, ULONG_PTR message)
 {
-	EnterCriticalSection(&csForClientSockets);
-	clientSockets.remove(lpSocketInfo);
-	LeaveCriticalSection(&csForClientSockets);
-	if (clientMap.find(userName) != clientMap.end()) {
-		clientMap.erase(userName);
+	Post(additionalData, INVALID_SESSION, message);
+}
+
+bool Room::HasGameStarted() const
+{
+	return gameStarted.load();
+}
+
+bool Room::HasPendingTasks() const
+{
+	return pendingTasks.load() != 0;
+}
+
+void Room::Push(RoomTask* task)
+{
+	task->next.store(nullptr, std::memory_order_relaxed);
+	RoomTask* prev = mailboxHead.exchange(task, std::memory_order_acq_rel);
+	// until this store the consumer sees the queue end at prev
+	prev->next.store(task, std::memory_order_release);
+}
+
+RoomTask* Room::Pop()
+{
+	RoomTask* tail = mailboxTail;
+	RoomTask* next = tail->next.load(std::memory_order_acquire);
+	if (tail == &mailboxStub)
+	{
+		if (next == nullptr)
+			return nullptr;
+		mailboxTail = next;
+		tail = next;
+		next = next->next.load(std::memory_order_acquire);
+	}
+	if (next != nullptr)
+	{
+		mailboxTail = next;
+		return tail;
 	}
+
+	// tail is the last task unless a producer is between its exchange and its link
+	if (tail != mailboxHead.load(std::memory_order_acquire))
+		return nullptr;
+	// the stub goes in behind tail so tail can be handed out
+	Push(&mailboxStub);
+	next = tail->next.load(std::memory_order_acquire);
+	if (next != nullptr)
+	{
+		mailboxTail = next;
+		return tail;
+	}
+	return nullptr;
 }
 
-std::forward_list<SocketInfo*>::const_iterator Room::ClientSocketsBegin()
+bool Room::RunTasks()
 {
-	EnterCriticalSection(&csForClientSockets);
-	auto itr = clientSockets.cbegin();
-	LeaveCriticalSection(&csForClientSockets);
-	return itr;
+	ServerManager& servManager = ServerManager::getInstance();
+	// only tasks already counted, so the count never drops below zero
+	int maxTasks = pendingTasks.load();
+	if (maxTasks > servManager.DequeueBatchSize())
+		maxTasks = servManager.DequeueBatchSize();
+
+	// Broadcast: every send of the batch goes to the kernel at once, and a client sent
+	// several frames in it gets them in one gather-send
+	int processed = 0;
+	IOInfo::BeginSendBatch();
+	while (processed < maxTasks)
+	{
+		// nullptr while an earlier producer has not linked its task yet; the room is retried
+		RoomTask* task = Pop();
+		if (task == nullptr)
+			break;
+
+		RunTask(servManager, task);
+		RoomTask::DeallocateRoomTask(task);
+		++processed;
+	}
+	IOInfo::FlushSendBatch();
+	Metrics::RecordBatch(Metrics::roomBatchSizes, processed);
+
+	// the room may be freed as soon as the count reaches zero, this is the last access
+	return pendingTasks.fetch_sub(processed) != processed;
+}
+
+void Room::DiscardTask(RoomTask* task)
+{	// frees what a task that never ran owns; ROOM_ACK carries the tick itself
+	switch (task->type)
+	{
+		case ROOM_STATE:
+		case SHARED_FRAME:
+			reinterpret_cast<SendFrame*>(task->message)->Release();
+			break;
+		case DISPOSABLE:
+			delete reinterpret_cast<MessageLite*>(task->message);
+			break;
+		case TYPEWITHOUTBODY:
+			delete reinterpret_cast<int*>(task->message);
+			break;
+	}
 }
 
-std::forward_list<SocketInfo*>::const_iterator Room::ClientSocketsEnd()
+void Room::RunTask(ServerManager& servManager, RoomTask* task)
 {
-	EnterCriticalSection(&csForClientSockets);
-	auto itr = clientSockets.cend();
-	LeaveCriticalSection(&csForClientSockets);
-	return itr;
+	if (task->type == ROOM_ENTER)
+	{
+		ProcessEnterEvent(servManager, task->session, task->userName);
+		return;
+	}
+	if (task->type == ROOM_TICK)
+	{
+		RunTick(servManager);
+		return;
+	}
+	if (task->type == ROOM_STATE)
+	{
+		SendFrame* frame = reinterpret_cast<SendFrame*>(task->message);
+		auto member = members.find(task->session);
+		if (member != members.end())
+			ApplyState(member->second, frame);
+		frame->Release();
+		return;
+	}
+	if (task->type == ROOM_ACK)
+	{
+		uint32_t tick = (uint32_t)task->message;
+		auto member = members.find(task->session);
+		if (member != members.end() && tick <= tickNumber && tick > member->second.ackedTick && tick > rosterTick)
+			member->second.ackedTick = tick;
+		return;
+	}
+
+	if (task->type >= ROOM_ENTER)
+	{	// the other commands come from members only; anything else left or was never let in
+		auto member = members.find(task->session);
+		if (member == members.end())
+			return;
+
+		Client* affectedClient = member->second.client;
+		switch (task->type)
+		{
+			case ROOM_READY:
+				ProcessReadyEvent(affectedClient);
+				break;
+			case ROOM_TEAM_CHANGE:
+			{
+				Client* newPosition = ProcessTeamChangeEvent(affectedClient);
+				if (newPosition != nullptr)
+				{
+					member->second.client = newPosition;
+					RebuildSlots();
+				}
+				break;
+			}
+			case ROOM_LEAVE:
+				if (ProcessLeaveGameroomEvent(affectedClient, task->session))
+				{ //방이 사라진 경우, 리소스 정리해야함
+					closed = true;
+					servManager.CancelRoomTimer(&tickTimer);
+					servManager.CloseRoom(this, roomInfo);
+					return;
+				}
+				RebuildSlots();
+				break;
+			case ROOM_START_GAME:
+				ProcessStartGameEvent(servManager, task->session);
+				return;
+			case ROOM_SEEK_POSITION:
+				ProcessSeekPositionEvent(servManager, affectedClient, task->session);
+				return;
+			default:
+				ErrorHandling("Unknown Room Command....", false);
+				return;
+		}
+		PublishRoomInfo(servManager);
+		BroadcastGeneralData(servManager, NON_DISPOSABLE, &roomInfo);
+		return;
+	}
+
+	MessageLite* pMessage = reinterpret_cast<MessageLite*>(task->message);
+	if (pMessage == NULL) {
+		ErrorHandling("Message is NULL....", false);
+		return;
+	}
+
+	switch (task->type)
+	{
+		case DISPOSABLE:
+		case NON_DISPOSABLE:
+			BroadcastGeneralData(servManager, task->type, pMessage);
+			break;
+		case TYPEWITHOUTBODY:
+			BroadcastTypeData(servManager, pMessage);
+			break;
+		case SHARED_FRAME:
+			BroadcastSharedFrame(servManager, reinterpret_cast<SendFrame*>(pMessage));
+			break;
+		default:
+			ErrorHandling("Unknown Broadcast Type....", false);
+			break;
+	}
 }
 
-void Room::InsertDataIntoBroadcastQueue(DWORD additionalData, ULONG_PTR message)
+void Room::ProcessEnterEvent(ServerManager& servManager, SessionHandle session, const string& userName)
 {
-	PostQueuedCompletionStatus(hCompPort, additionalData, message, NULL);
+	if (closed)
+	{
+		Reject(servManager, session, "REJECT_ENTER_ROOM", "401", "Room already has been destroyed!");
+		return;
+	}
+	if (HasGameStarted())
+	{ //게임이 시작했을 때
+		Reject(servManager, session, "REJECT_ENTER_ROOM", "401", "The game has already started!");
+		return;
+	}
+	// positions are slots, so a room never holds more than MAX_ROOM_SLOTS whatever its limit
+	if (roomInfo.current() >= roomInfo.limit() || roomInfo.current() >= MAX_ROOM_SLOTS)
+	{ // 인원수 꽉찬경우.
+		Reject(servManager, session, "REJECT_ENTER_ROOM", "401", "The room is already full!");
+		return;
+	}
+	// fails if the client disconnected or got into another room since it asked
+	if (!servManager.ClaimClientLocation(session, roomInfo.roomid()))
+		return;
+
+	// 방 입장 처리
+	Client* clnt;
+	if (roomInfo.redteam_size() > roomInfo.blueteam_size()) {
+		clnt = roomInfo.add_blueteam();
+		clnt->set_position(roomInfo.blueteam_size() + 7);
+	}
+	else {
+		clnt = roomInfo.add_redteam();
+		clnt->set_position(roomInfo.redteam_size() - 1);
+	}
+	clnt->set_clntid(roomInfo.roomid());
+	clnt->set_name(userName);
+	clnt->set_ready(false);
+	roomInfo.set_current(roomInfo.current() + 1);
+	members[session].client = clnt;
+	RebuildSlots();
+
+	PublishRoomInfo(servManager);
+	BroadcastGeneralData(servManager, NON_DISPOSABLE, &roomInfo);
 }
 
-void Room::ProcessReadyEvent(Client*& affectedClient)
+void Room::ProcessReadyEvent(Client* affectedClient)
 {
-	EnterCriticalSection(&csForRoomInfo);
 	bool toReady = !affectedClient->ready() ? true : false;
 	if (toReady) 
 	{
-		roomInfo->set_readycount(roomInfo->readycount() + 1);
+		roomInfo.set_readycount(roomInfo.readycount() + 1);
 	} 
 	else 
 	{
-		roomInfo->set_readycount(roomInfo->readycount() - 1);
+		roomInfo.set_readycount(roomInfo.readycount() - 1);
 	}	
 	affectedClient->set_ready(toReady);
-	LeaveCriticalSection(&csForRoomInfo);
 }
 
-Client* Room::ProcessTeamChangeEvent(Client*& affectedClient)
+Client* Room::ProcessTeamChangeEvent(Client* affectedClient)
 {
 	bool isOnRedTeam = affectedClient->position() < BLUEINDEXSTART ? true : false;
 	
-	int maxuser = roomInfo->limit() / 2;
+	int maxuser = roomInfo.limit() / 2;
 	int nextIdx;
-	Client* newClient;
-	EnterCriticalSection(&csForRoomInfo);
 	if (isOnRedTeam) 
 	{
-		nextIdx = roomInfo->blueteam_size();
+		nextIdx = roomInfo.blueteam_size();
 		if (nextIdx == maxuser)
 			return nullptr;
 		
 		nextIdx += BLUEINDEXSTART;
-		newClient = MoveClientToOppositeTeam(affectedClient, nextIdx, roomInfo->mutable_redteam(), roomInfo->mutable_blueteam());
+		return MoveClientToOppositeTeam(affectedClient, nextIdx, roomInfo.mutable_redteam(), roomInfo.mutable_blueteam());
 	}
 	else 
 	{
-		nextIdx = roomInfo->redteam_size();
+		nextIdx = roomInfo.redteam_size();
 		if (nextIdx == maxuser)
 			return nullptr;
 
-		newClient = MoveClientToOppositeTeam(affectedClient, nextIdx, roomInfo->mutable_blueteam(), roomInfo->mutable_redteam());
+		return MoveClientToOppositeTeam(affectedClient, nextIdx, roomInfo.mutable_blueteam(), roomInfo.mutable_redteam());
 	}
-	LeaveCriticalSection(&csForRoomInfo);
-	return newClient;
 }
 
-bool Room::ProcessLeaveGameroomEvent(Client*& affectedClient, SocketInfo* lpSocketInfo) 
+bool Room::ProcessLeaveGameroomEvent(Client* affectedClient, SessionHandle session) 
 {
 	int position = affectedClient->position();
 	bool isOnRedTeam = position < BLUEINDEXSTART ? true : false;
 	bool isClosed = false;
 
-	EnterCriticalSection(&csForRoomInfo);
 	if (affectedClient->ready())
-		roomInfo->set_readycount(roomInfo->readycount() - 1);
+		roomInfo.set_readycount(roomInfo.readycount() - 1);
 
+	members.erase(session);
 	if (isOnRedTeam) 
-		roomInfo->mutable_redteam()->DeleteSubrange(position, 1);
+		roomInfo.mutable_redteam()->DeleteSubrange(position, 1);
 	else
-		roomInfo->mutable_blueteam()->DeleteSubrange(position % BLUEINDEXSTART, 1);
+		roomInfo.mutable_blueteam()->DeleteSubrange(position % BLUEINDEXSTART, 1);
 
-	EnterCriticalSection(&csForClientSockets);
-	clientSockets.remove(lpSocketInfo); 
-	LeaveCriticalSection(&csForClientSockets);
-
-	if (roomInfo->current() == 1)
+	if (roomInfo.current() == 1)
 	{
 		isClosed = true; 
 	}
 	else
 	{
-		if (roomInfo->host() == position)
+		if (roomInfo.host() == position)
 		{ 
 			ChangeGameroomHost(isOnRedTeam); 
 		}
 	}
 
 	AdjustClientsIndexes(position);
-	roomInfo->set_current(roomInfo->current() - 1); 
-	LeaveCriticalSection(&csForRoomInfo);
+	roomInfo.set_current(roomInfo.current() - 1); 
 	return isClosed;
 }
 
-bool Room::CanStart(string& errorMessage)
-{	
-	EnterCriticalSection(&csForRoomInfo);
-	bool allReady = (roomInfo->current() - 1) == roomInfo->readycount();
-	bool isFair = roomInfo->blueteam_size() == roomInfo->redteam_size();
-	LeaveCriticalSection(&csForRoomInfo);
-	
-	if (!allReady)
+void Room::ProcessStartGameEvent(ServerManager& servManager, SessionHandle session)
+{
+	string errorMessage;
+	if (!CanStart(errorMessage))
 	{
-		errorMessage = "To start a game, all users should be ready!";
-		return false;
+		Reject(servManager, session, "REJECT_START_GAME", "402", errorMessage);
+		return;
 	}
-	
-	if (!isFair) 
+
+	gameStarted = true;
+	SendFrame* frame = SendFrame::Create(START_GAME);
+	BroadcastFrame(servManager, frame);
+	frame->Release();
+
+	ULONGLONG period = 1000000 / servManager.TickRate();
+	nextTickAt = GetMicroseconds() + period;
+	tickNumber = 0;
+	servManager.ScheduleRoomTimer(&tickTimer, (DWORD)(period / 1000));
+}
+
+void Room::ApplyState(RoomMember& member, SendFrame* frame)
+{
+	const char* body = frame->data + HEADER_SIZE;
+	int size = (int)frame->length - HEADER_SIZE;
+	state::WorldState& current = member.state;
+
+	if (frame->type == MessageType::WORLD_STATE || frame->type == MessageType::WORLD_STATE_BITS)
 	{
-		errorMessage = "To start a game, the number of users on each team should be the same!";
-		return false;
-	}
+		state::WorldState update;
+		bool packed = frame->type == MessageType::WORLD_STATE_BITS;
+		if (packed ? !SnapshotBuilder::ParsePackedState(body, size, update) : !update.ParseFromArray(body, size))
+			return;
+		member.packed = packed;
+
+		// players go by slot: the sender is known, and a hit on no one is dropped
+		update.clear_clntname();
+		if (update.has_hitstate() && !ResolveHit(member, *update.mutable_hitstate()))
+		{
+			update.clear_hitstate();
+			update.set_hit(false);
+		}
 
-	return true;
+		// a newer state does not cancel an event no tick has sent yet
+		bool fired = current.fired();
+		bool hit = current.hit() && !update.hit();
+		state::HitState hitState;
+		if (hit)
+			hitState.Swap(current.mutable_hitstate());
+		current.Swap(&update);
+		if (fired)
+			current.set_fired(true);
+		if (hit)
+		{
+			current.set_hit(true);
+			current.mutable_hitstate()->Swap(&hitState);
+		}
+	}
+	else
+	{
+		state::PlayState update;
+		if (!update.ParseFromArray(body, size))
+			return;
+
+		current.set_roomid(update.roomid());
+		current.mutable_transform()->Swap(update.mutable_transform());
+		current.set_animstate(update.animstate());
+		current.set_health(update.health());
+		current.set_killpoint(update.killcount());
+		current.set_deathpoint(update.deathcount());
+	}
+	current.set_slot(member.client->position());
+	member.updated = true;
+	member.hasState = true;
+	Metrics::stateUpdates++;
 }
 
-void Room::SetGameStartFlag(bool to)
+// Called on every roster change. Positions shift when a player leaves or changes team, so
+// clients are sent full snapshots until they acknowledge one with the new slots.
+void Room::RebuildSlots()
 {
-	gameStarted = to;
+	for (int i = 0; i < MAX_ROOM_SLOTS; ++i)
+		slots[i] = INVALID_SESSION;
+	for (auto& member : members)
+	{
+		int slot = member.second.client->position();
+		if (slot >= 0 && slot < MAX_ROOM_SLOTS)
+			slots[slot] = member.first;
+		member.second.state.set_slot(slot);
+		member.second.ackedTick = 0;
+		ZeroMemory(member.second.priority, sizeof(member.second.priority));
+	}
+	rosterTick = tickNumber;
+
+	// slots moved, so every player is placed again
+	grid.Clear();
+	for (auto& member : members)
+	{
+		RoomMember& player = member.second;
+		if (player.hasState)
+			grid.Update(player.client->position(), player.state.transform().position().x(), player.state.transform().position().z());
+	}
 }
 
-bool Room::HasGameStarted() const
+bool Room::ResolveHit(const RoomMember& member, state::HitState& hitState)
 {
-	return gameStarted;
+	int toSlot = hitState.toslot();
+	if (!hitState.to().empty())
+	{	// clients from before slots name the target
+		toSlot = -1;
+		for (int i = 0; i < MAX_ROOM_SLOTS && toSlot < 0; ++i)
+		{
+			if (slots[i] != INVALID_SESSION && GetClient(i)->name() == hitState.to())
+				toSlot = i;
+		}
+	}
+	if (toSlot < 0 || toSlot >= MAX_ROOM_SLOTS || slots[toSlot] == INVALID_SESSION)
+		return false;
+
+	// only the damage and the two slots go out
+	hitState.clear_from();
+	hitState.clear_to();
+	hitState.set_fromslot(member.client->position());
+	hitState.set_toslot(toSlot);
+	return true;
 }
 
-SocketInfo*& Room::GetSocketUsingName(string & userName)
+void Room::OnTick(TimerWheel* wheel, Timer* timer)
 {
-	return clientMap[userName];
+	// fired under the wheel lock on a worker, the tick itself runs on the room's turn
+	Room* pRoom = (Room*)timer->context;
+	pRoom->Post(ROOM_TICK, INVALID_SESSION);
 }
 
-void Room::InitCompletionPort(int maxNumberOfThreads)
+void Room::RunTick(ServerManager& servManager)
 {
-	hCompPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, maxNumberOfThreads);
-	if (hCompPort == NULL) {
-		ErrorHandling(WSAGetLastError());
+	if (closed)
 		return;
+
+	// ticks keep to a fixed schedule, a late one covers every step it missed
+	ULONGLONG period = 1000000 / servManager.TickRate();
+	ULONGLONG now = GetMicroseconds();
+	while (nextTickAt <= now)
+	{
+		nextTickAt += period;
+		++tickNumber;
 	}
+
+	SendSnapshot(servManager);
+	Metrics::roomTicks++;
+	servManager.ScheduleRoomTimer(&tickTimer, (DWORD)((nextTickAt - now + 999) / 1000));
 }
 
-void Room::CreateThreadPool(int numOfThreads)
+void Room::SendSnapshot(ServerManager& servManager)
 {
-	for (int i = 0; i < numOfThreads; ++i) {
-		DWORD dwThreadId = 0;
-		HANDLE hThread = BEGINTHREADEX(NULL, 0, Room::ThreadMain, this, 0, &dwThreadId);
-		CloseHandle(hThread);
+	bool changed = statesDeferred;
+	for (auto& member : members)
+		changed = changed || member.second.updated;
+	if (!changed)
+		return;
+	statesDeferred = false;
+
+	// what every player is sent with this tick, the base of later deltas once acknowledged
+	uint32_t slot = tickNumber % SNAPSHOT_HISTORY;
+	for (auto& member : members)
+	{
+		RoomMember& player = member.second;
+		player.history[slot].tick = player.hasState ? tickNumber : 0;
+		if (player.hasState)
+			player.history[slot].state = player.state;
+	}
+
+	// only players that moved change cell
+	float radius = (float)servManager.InterestRadius();
+	if (radius > 0)
+	{
+		grid.SetCellSize(radius);
+		for (auto& member : members)
+		{
+			RoomMember& player = member.second;
+			if (player.updated)
+			{
+				const state::Vector3Proto& position = player.state.transform().position();
+				grid.Update(player.client->position(), position.x(), position.z());
+			}
+		}
+	}
+
+	// recipients that acknowledged the same tick, use the same codec and see the same players
+	// share one frame, all the rest get full ones; either way a newer snapshot supersedes an
+	// unsent one. The key packs the base's age, the codec and the two player sets. Under a
+	// budget every recipient's frame is its own, as its priorities are.
+	static_assert(MAX_ROOM_SLOTS <= 16, "player sets are packed into the frame key");
+	int budget = servManager.SnapshotBudget();
+	std::unordered_map<uint64_t, BuiltSnapshot> framesByBase;
+	for (auto& member : members)
+	{
+		RoomMember& recipient = member.second;
+		uint32_t baseTick = recipient.ackedTick;
+		if (baseTick != 0 && tickNumber - baseTick >= SNAPSHOT_HISTORY)
+			baseTick = 0;
+
+		// a client that may be sent only some players is told which ones to keep
+		uint32_t visible = ALL_VISIBLE;
+		if (radius > 0)
+			visible = VisibleTo(recipient, radius);
+		else if (budget > 0)
+			visible = (1u << MAX_ROOM_SLOTS) - 1;
+		uint32_t baseFresh = baseTick != 0 ? recipient.freshAt[baseTick % SNAPSHOT_HISTORY] : 0;
+
+		BuiltSnapshot built;
+		if (budget > 0)
+		{
+			built = BuildSnapshot(recipient, baseTick, visible, baseFresh, budget);
+		}
+		else
+		{
+			uint64_t key = (baseTick != 0 ? tickNumber - baseTick + 1 : 0) | ((uint64_t)recipient.packed << 6);
+			if (radius > 0)
+				key |= ((uint64_t)visible << 7) | ((uint64_t)(baseFresh & 0xFFFF) << 23);
+			auto cached = framesByBase.find(key);
+			if (cached == framesByBase.end())
+				cached = framesByBase.emplace(key, BuildSnapshot(recipient, baseTick, visible, baseFresh, 0)).first;
+			built = cached->second;
+		}
+		recipient.freshAt[slot] = built.fresh;
+
+		if (baseTick == 0)
+			Metrics::fullSnapshots++;
+		Metrics::snapshotsSent++;
+		Metrics::snapshotBytes += built.frame->length;
+
+		if (!servManager.SendSharedFrame(member.first, built.frame))
+			Metrics::sendFailed++;
+		if (budget > 0)
+			built.frame->Release();
+	}
+	for (auto& entry : framesByBase)
+		entry.second.frame->Release();
+
+	for (auto& member : members)
+	{
+		RoomMember& player = member.second;
+		player.updated = false;
+		player.state.set_fired(false);
+		player.state.set_hit(false);
+		player.state.clear_hitstate();
 	}
 }
 
-unsigned __stdcall Room::ThreadMain(void * pVoid)
+// The recipient's team and, when it has a position, the players within radius of it.
+uint32_t Room::VisibleTo(const RoomMember& recipient, float radius)
 {
-	printf("[Room Thread #%d]\n", GetCurrentThreadId());
+	uint32_t redTeam = (1u << BLUEINDEXSTART) - 1;
+	uint32_t blueTeam = ((1u << MAX_ROOM_SLOTS) - 1) & ~redTeam;
+	uint32_t visible = recipient.client->position() < BLUEINDEXSTART ? redTeam : blueTeam;
+	if (recipient.hasState)
+	{
+		const state::Vector3Proto& position = recipient.state.transform().position();
+		visible |= grid.Query(position.x(), position.z(), radius);
+	}
+	return visible;
+}
 
-	Room* self = (Room*)pVoid;
-	MessageLite* pMessage;
-	LPOVERLAPPED lpOverlapped;
+// How much more a player is due to a recipient for each tick it is held back: nearer players
+// count for more, and players that fired or were hit jump ahead.
+float Room::PriorityGain(const RoomMember& recipient, const RoomMember& player)
+{
+	float gain = 1.0f;
+	if (recipient.hasState)
+	{
+		const state::Vector3Proto& from = recipient.state.transform().position();
+		const state::Vector3Proto& to = player.state.transform().position();
+		float dx = to.x() - from.x(), dy = to.y() - from.y(), dz = to.z() - from.z();
+		float distance = sqrtf(dx * dx + dy * dy + dz * dz);
+		gain += PRIORITY_NEAR_DISTANCE / (PRIORITY_NEAR_DISTANCE + distance);
+	}
+	if (player.state.fired() || player.state.hit())
+		gain += PRIORITY_EVENT_GAIN;
+	return gain;
+}
 
-	DWORD dwBytesTransferred = 0;
-	ServerManager& servManager = ServerManager::getInstance();
+// visible: slot bits of the players to send, baseFresh: those the recipient had up to date in
+// the base snapshot. With a budget, the players due are written most urgent first until the
+// frame would pass budget bytes; the rest wait for a later tick with a higher priority.
+Room::BuiltSnapshot Room::BuildSnapshot(RoomMember& recipient, uint32_t baseTick, uint32_t visible, uint32_t baseFresh, int budget)
+{
+	BuiltSnapshot built;
+	built.fresh = 0;
 
-	while (true)
+	int dueCount = 0;
+	uint32_t baseSlot = baseTick % SNAPSHOT_HISTORY;
+	for (auto& member : members)
 	{
-		pMessage = NULL;
-		lpOverlapped = NULL;
-	
-		bool rtn = GetQueuedCompletionStatus(self->hCompPort, &dwBytesTransferred,
-			reinterpret_cast<ULONG_PTR*>(&pMessage), &lpOverlapped, INFINITE);
+		RoomMember& player = member.second;
+		int position = player.client->position();
+		// positions index the slot masks and arrays, see RebuildSlots
+		if (position < 0 || position >= MAX_ROOM_SLOTS)
+			continue;
+		if (!player.hasState || ((visible >> position) & 1) == 0)
+			continue;
 
-		if (!rtn) {
-			if (lpOverlapped != NULL) {
-				printf("lpOverlapped is not NULL!: %d\n", GetLastError());
-			}
-			else {
-				printf("lpOverlapped is NULL!: %d\n", GetLastError());
+		assert(dueCount < MAX_ROOM_SLOTS);
+		DueState& due = dueStates[dueCount];
+		StateRecord& base = player.history[baseSlot];
+		if (baseTick != 0 && base.tick == baseTick && ((baseFresh >> position) & 1))
+		{
+			due.changed = SnapshotBuilder::Diff(base.state, player.state, deltaFields[dueCount]);
+			if (due.changed == 0)
+			{	// the recipient is still up to date
+				built.fresh |= 1u << position;
+				continue;
 			}
-			//continue;
-			break;
+			due.fields = &deltaFields[dueCount];
 		}
-
-		if (pMessage == NULL) {
-			ErrorHandling("Message is NULL....", false);
-			continue;
+		else
+		{	// not in the base snapshot, or out of date in it: everything is new to the recipient
+			due.changed = ALL_FIELDS;
+			due.fields = &player.state;
 		}
-		else if (reinterpret_cast<DWORD>(pMessage) == KILL_THREAD)
+		due.slot = position;
+		due.player = &player;
+		++dueCount;
+	}
+
+	if (budget > 0)
+	{
+		for (int i = 0; i < dueCount; ++i)
 		{
-			std::cout << "ACTION : KILL THREAD" << std::endl;
-			break;
+			float& priority = recipient.priority[dueStates[i].slot];
+			priority += PriorityGain(recipient, *dueStates[i].player);
+			dueStates[i].priority = priority;
 		}
+		std::sort(dueStates, dueStates + dueCount,
+			[](const DueState& a, const DueState& b) { return a.priority > b.priority; });
+	}
 
-		// Broadcast
-		EnterCriticalSection(&self->csForBroadcast);
-		auto begin = self->ClientSocketsBegin();
-		auto end = self->ClientSocketsEnd();
+	if (baseTick == 0)
+		snapshot.Begin(roomInfo.roomid(), tickNumber, recipient.packed, visible);
+	else
+		snapshot.BeginDelta(roomInfo.roomid(), tickNumber, baseTick, recipient.packed, visible);
+	for (int i = 0; i < dueCount; ++i)
+	{
+		DueState& due = dueStates[i];
+		size_t mark = snapshot.Mark();
+		if (baseTick == 0)
+			snapshot.AddState(due.slot, *due.fields);
+		else
+			snapshot.AddDelta(due.slot, due.changed, *due.fields);
 
-		switch (dwBytesTransferred)
+		// the most urgent player and events are never held back: an event would be lost, and
+		// its end would be seen late, as a second event
+		bool event = due.player->state.fired() || due.player->state.hit()
+			|| (baseTick != 0 && (due.changed & (FIELD_FIRED | FIELD_HIT)) != 0);
+		if (budget > 0 && i > 0 && !event && HEADER_SIZE + snapshot.Size() > (size_t)budget)
 		{
-			case DISPOSABLE:
-			case NON_DISPOSABLE:
-				self->BroadcastGeneralData(servManager, dwBytesTransferred, pMessage, begin, end);
-				break;
-			case TYPEWITHOUTBODY:
-				self->BroadcastTypeData(servManager, pMessage, begin, end);
-				break;
-			default:
-				self->BroadcastRawData(servManager, dwBytesTransferred, reinterpret_cast<char*>(pMessage), begin, end);
-				break;
+			snapshot.Rewind(mark);
+			// only clients that acknowledge are caught up once play goes quiet, the others
+			// would be sent full snapshots every tick for ever
+			if (baseTick != 0)
+				statesDeferred = true;
+			Metrics::statesDeferred++;
+			continue;
 		}
-		LeaveCriticalSection(&self->csForBroadcast);
+		built.fresh |= 1u << due.slot;
+		if (budget > 0)
+			recipient.priority[due.slot] = 0;
 	}
-	return 0;
+
+	built.frame = snapshot.Finish();
+	built.frame->conflationKey = roomInfo.roomid();
+	return built;
+}
+
+void Room::ProcessSeekPositionEvent(ServerManager& servManager, Client* affectedClient, SessionHandle session)
+{
+	Data response;
+	(*response.mutable_datamap())["contentType"] = "CLIENT_POSITION";
+	(*response.mutable_datamap())["position"] = std::to_string(affectedClient->position());
+	MessageContext msgContext;
+	msgContext.header.type = MessageType::DATA;
+	msgContext.message = &response;
+	servManager.SendPacket(session, &msgContext);
+}
+
+bool Room::CanStart(string& errorMessage)
+{	
+	bool allReady = (roomInfo.current() - 1) == roomInfo.readycount();
+	bool isFair = roomInfo.blueteam_size() == roomInfo.redteam_size();
+	
+	if (!allReady)
+	{
+		errorMessage = "To start a game, all users should be ready!";
+		return false;
+	}
+	
+	if (!isFair) 
+	{
+		errorMessage = "To start a game, the number of users on each team should be the same!";
+		return false;
+	}
+
+	return true;
+}
+
+void Room::Reject(ServerManager& servManager, SessionHandle session, const char* contentType, const char* errorCode, const string& errorMessage)
+{
+	Data response;
+	(*response.mutable_datamap())["contentType"] = contentType;
+	(*response.mutable_datamap())["errorCode"] = errorCode;
+	(*response.mutable_datamap())["errorMessage"] = errorMessage;
+	MessageContext msgContext;
+	msgContext.header.type = MessageType::DATA;
+	msgContext.message = &response;
+	servManager.SendPacket(session, &msgContext);
+}
+
+void Room::PublishRoomInfo(ServerManager& servManager)
+{
+	servManager.PublishRoomInfo(roomInfo);
 }
 
 Client* Room::GetClient(int position)
 {
 	return position < BLUEINDEXSTART ? 
-		roomInfo->mutable_redteam(position) : roomInfo->mutable_blueteam(position % BLUEINDEXSTART);
+		roomInfo.mutable_redteam(position) : roomInfo.mutable_blueteam(position % BLUEINDEXSTART);
 }
 
 Client* Room::MoveClientToOppositeTeam(Client*& affectedClient, int next_pos, Mutable_Team deleteFrom, Mutable_Team addTo)
@@ -272,9 +893,9 @@ Client* Room::MoveClientToOppositeTeam(Client*& affectedClient, int next_pos, Mu
 	Client* newClient = addTo->Add();
 	newClient->CopyFrom(*affectedClient);
 	int prev_pos = affectedClient->position();
-	if (affectedClient->position() == roomInfo->host()) 
+	if (affectedClient->position() == roomInfo.host()) 
 	{
-		roomInfo->set_host(next_pos);
+		roomInfo.set_host(next_pos);
 	}
 	deleteFrom->DeleteSubrange(prev_pos % BLUEINDEXSTART, 1);
 	AdjustClientsIndexes(prev_pos);
@@ -287,22 +908,22 @@ void Room::AdjustClientsIndexes(int basePos)
 	int size;
 	Mutable_Team team;
 	bool needHostDecrement = false;
-	int hostPos = roomInfo->host();
+	int hostPos = roomInfo.host();
 
 	if (basePos < BLUEINDEXSTART)
 	{
 		if (hostPos < BLUEINDEXSTART && hostPos >= basePos)
 			needHostDecrement = true;
-		size = roomInfo->redteam_size();
-		team = roomInfo->mutable_redteam();
+		size = roomInfo.redteam_size();
+		team = roomInfo.mutable_redteam();
 	}
 	else
 	{
 		if (hostPos >= BLUEINDEXSTART && hostPos >= basePos)
 			needHostDecrement = true;
 		basePos -= BLUEINDEXSTART;
-		size = roomInfo->blueteam_size();
-		team = roomInfo->mutable_blueteam();
+		size = roomInfo.blueteam_size();
+		team = roomInfo.mutable_blueteam();
 	}
 
 	if (basePos >= size)
@@ -314,7 +935,7 @@ void Room::AdjustClientsIndexes(int basePos)
 	}
 
 	if (needHostDecrement)
-		roomInfo->set_host(roomInfo->host() - 1);
+		roomInfo.set_host(roomInfo.host() - 1);
 }
 
 void Room::ChangeGameroomHost(bool isOnRedteam)
@@ -322,70 +943,59 @@ void Room::ChangeGameroomHost(bool isOnRedteam)
 	int nextHost;
 	if (isOnRedteam) 
 	{
-		if (roomInfo->blueteam_size() != 0)
+		if (roomInfo.blueteam_size() != 0)
 			nextHost = BLUEINDEXSTART;
 		else
 			nextHost = 0;
 	}
 	else
 	{
-		if (roomInfo->redteam_size() != 0)
+		if (roomInfo.redteam_size() != 0)
 			nextHost = 0;
 		else
 			nextHost = BLUEINDEXSTART;
 	}
-	roomInfo->set_host(nextHost);
+	roomInfo.set_host(nextHost);
 	Client* nextHostClnt = GetClient(nextHost);
 	if (nextHostClnt->ready())
 	{
 		GetClient(nextHost)->set_ready(false);
-		roomInfo->set_readycount(roomInfo->readycount() - 1);
+		roomInfo.set_readycount(roomInfo.readycount() - 1);
 	}
 }
 
-void Room::BroadcastGeneralData(ServerManager& servManager, DWORD broadcastType, MessageLite * data, SocketIterator begin, SocketIterator end)
+void Room::BroadcastGeneralData(ServerManager& servManager, DWORD broadcastType, MessageLite * data)
 {
-	MessageContext msgContext;
-	msgContext.message = data;
-	for (auto itr = begin; itr != end; itr++)
-	{
-		if ((*itr)->socket != INVALID_SOCKET)
-		{
-			if (!servManager.SendPacket(*itr, &msgContext))
-				std::cout << "Send Message Failed\n";
-		}
-	}
+	// serialized once, every recipient queues the same frame
+	SendFrame* frame = SendFrame::Create(-1, data);
+	BroadcastFrame(servManager, frame);
+	frame->Release();
 
 	if (broadcastType == DISPOSABLE)
 		delete data;
 }
 
-void Room::BroadcastTypeData(ServerManager& servManager, MessageLite * data, SocketIterator begin, SocketIterator end)
+void Room::BroadcastTypeData(ServerManager& servManager, MessageLite * data)
 {
 	int* type = (int*)data;
-	MessageContext msgContext;
-	msgContext.header.type = *type;
-	for (auto itr = begin; itr != end; itr++)
-	{
-		if ((*itr)->socket != INVALID_SOCKET)
-		{
-			if (!servManager.SendPacket(*itr, &msgContext))
-				std::cout << "Send Message Failed\n";
-		}
-	}
+	SendFrame* frame = SendFrame::Create(*type);
+	BroadcastFrame(servManager, frame);
+	frame->Release();
 	delete type;
 }
 
-void Room::BroadcastRawData(ServerManager& servManager, DWORD dwBytesTransferred, char * data, SocketIterator begin, SocketIterator end)
+void Room::BroadcastSharedFrame(ServerManager& servManager, SendFrame* frame)
+{
+	BroadcastFrame(servManager, frame);
+	frame->Release();
+}
+
+void Room::BroadcastFrame(ServerManager& servManager, SendFrame* frame)
 {
-	for (auto itr = begin; itr != end; itr++)
+	// sessions are held by handle, a client that disconnected mid-broadcast is just skipped
+	for (auto& member : members)
 	{
-		if ((*itr)->socket != INVALID_SOCKET)
-		{
-			(*itr)->sendBuf->CopyRawToBuffer(data, dwBytesTransferred);
-			if (!servManager.SendPacket(*itr, nullptr))
-				std::cout << "Send Message Failed\n";
-		}
+		if (!servManager.SendSharedFrame(member.first, frame))
+			Metrics::sendFailed++;
 	}
-	delete data;
-}
+}
\ No newline at end of file
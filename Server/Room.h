@@ -1,50 +1,160 @@
 #pragma once
 #include "SocketInfo.h"
+#include "CompletionPort.h"
+#include "TimerWheel.h"
+#include "Snapshot.h"
+#include "SpatialGrid.h"
 #include "protobuf/room.pb.h"
 #include "protobuf/PlayState.pb.h"
-#include "forward_list"
+#include <atomic>
+#include <string>
+#include <unordered_map>
 typedef google::protobuf::RepeatedPtrField<packet::Client>* Mutable_Team;
-typedef std::forward_list<SocketInfo*>::const_iterator SocketIterator;
 class ServerManager;
+class RoomExecutor;
 
+// A state a player was sent with in some tick's snapshot.
+struct StateRecord {
+	uint32_t tick;		// 0 while unused
+	state::WorldState state;
+
+	StateRecord() : tick(0) {}
+};
+
+// A member and the state the room simulates for it.
+struct RoomMember {
+	Client* client;
+	// latest applied state; fired and hit stay set until a tick has sent them
+	state::WorldState state;
+	bool updated;		// applied since the last tick
+	bool hasState;		// anything applied at all; players yet to send are left out of snapshots
+	// this player's state in recent snapshots, at tick % SNAPSHOT_HISTORY; the bases of deltas
+	StateRecord history[SNAPSHOT_HISTORY];
+	uint32_t ackedTick;	// newest snapshot this client acknowledged, 0 = none yet
+	bool packed;		// sends WORLD_STATE_BITS, so it is sent ROOM_SNAPSHOT_BITS
+	// slots this client had up to date after recent snapshots, at tick % SNAPSHOT_HISTORY
+	uint32_t freshAt[SNAPSHOT_HISTORY];
+	// by slot, how overdue each player is to this client under a snapshot budget
+	float priority[MAX_ROOM_SLOTS];
+
+	RoomMember() : client(nullptr), updated(false), hasState(false), ackedTick(0), packed(false)
+	{
+		ZeroMemory(freshAt, sizeof(freshAt));
+		ZeroMemory(priority, sizeof(priority));
+	}
+};
+
+// A player held back gains 1 priority a tick, up to 1 more the nearer it is to the recipient
+// (half at PRIORITY_NEAR_DISTANCE), and PRIORITY_EVENT_GAIN while it has fired or been hit.
+#define PRIORITY_NEAR_DISTANCE 10.0f
+#define PRIORITY_EVENT_GAIN 8.0f
+
+// One queued command or broadcast job, linked into a room's mailbox.
+// type is a RoomCommand or a BroadcastType.
+struct RoomTask {
+	std::atomic<RoomTask*> next;
+	DWORD type;
+	SessionHandle session;	// client the command came from
+	ULONG_PTR message;
+	std::string userName;
+
+	RoomTask() : next(nullptr), type(0), session(INVALID_SESSION), message(0) {}
+
+	// Tasks are recycled: room threads give them back and the posting threads take them,
+	// so a steady state stream never reaches the allocator. Either may run on any thread.
+	static RoomTask* AllocateRoomTask();
+	static void DeallocateRoomTask(RoomTask* task);
+};
+
+// A room is an actor: its state is touched only by the task it runs on the executor, one task
+// at a time, so none of it is locked. Every other thread talks to it through Post, which never
+// blocks; producers link tasks into an intrusive MPSC queue with one atomic exchange.
 class Room
 {
 public:
-	Room(RoomInfo* initVal);
+	Room(const RoomInfo& initVal, SessionHandle host, RoomExecutor* executor);
 	~Room();
 
-	void AddClientInfo(SocketInfo* lpSocketInfo, string& userName);
-	void RemoveClientInfo(SocketInfo* lpSocketInfo, string& userName);
-
-	std::forward_list<SocketInfo*>::const_iterator ClientSocketsBegin();
-	std::forward_list<SocketInfo*>::const_iterator ClientSocketsEnd();
+	// Queue a command or broadcast from any thread. Tasks from one thread run in the order posted.
+	void Post(DWORD type, SessionHandle session, ULONG_PTR message = 0, const string& userName = string());
 	void InsertDataIntoBroadcastQueue(DWORD, ULONG_PTR);
 
-	void ProcessReadyEvent(Client*& affectedClient);
-	Client* ProcessTeamChangeEvent(Client*& affectedClient);
-	bool ProcessLeaveGameroomEvent(Client*& affectedClient, SocketInfo* lpSocketInfo);
-
-	bool CanStart(string& errorMessage);
+	// Read by workers to decide whether input is relayed; only the room itself sets it.
 	bool HasGameStarted() const;
-	void SetGameStartFlag(bool to);
 
-	SocketInfo*& GetSocketUsingName(string& userName);
-	void InitCompletionPort(int maxNumberOfThreads = 1);
-	void CreateThreadPool(int numOfThreads = 1);
+	// Runs up to one batch of queued tasks on the calling executor thread.
+	// Returns true when tasks are left and the room has to be scheduled again.
+	bool RunTasks();
+	bool HasPendingTasks() const;
+
+	// frees the room once it has been closed and its mailbox has drained
+	Timer cleanupTimer;
+	// posts ROOM_TICK at the configured rate while a game runs
+	Timer tickTimer;
 
 private:
-	RoomInfo* roomInfo;
-	std::forward_list<SocketInfo*> clientSockets;
-	std::unordered_map<std::string, SocketInfo*> clientMap; // <Client_Name, Client_Socket>
-	HANDLE hCompPort;
-	CRITICAL_SECTION csForClientSockets;
-	CRITICAL_SECTION csForRoomInfo;
-	CRITICAL_SECTION csForBroadcast;
+	RoomInfo roomInfo;
+	// <Client_Session, Member>; client points into roomInfo and is replaced on a team change
+	std::unordered_map<SessionHandle, RoomMember> members;
+	// slot (Client.position) -> session, INVALID_SESSION where no one is; rebuilt on every roster change
+	SessionHandle slots[MAX_ROOM_SLOTS];
+	uint32_t rosterTick;	// snapshots up to this tick used the slots from before the last change
+	std::atomic<bool> gameStarted;
+	bool closed;
+	ULONGLONG nextTickAt;	// GetMicroseconds() the next tick is due
+	uint32_t tickNumber;
+	SnapshotBuilder snapshot;
+	// where players stand, for interest management; kept up to date only while it is on
+	SpatialGrid grid;
+
+	// A player a snapshot being built is due to carry.
+	struct DueState {
+		int slot;
+		RoomMember* player;
+		uint32_t changed;
+		state::WorldState* fields;
+		float priority;
+	};
+	struct BuiltSnapshot {
+		SendFrame* frame;
+		uint32_t fresh;		// slots the recipient has up to date once it applies frame
+	};
+	DueState dueStates[MAX_ROOM_SLOTS];
+	state::WorldState deltaFields[MAX_ROOM_SLOTS];
+	bool statesDeferred;	// the last tick held states back, so the next one sends even if nothing changed
+
+	RoomExecutor* executor;
+	std::atomic<RoomTask*> mailboxHead;	// last task pushed
+	RoomTask* mailboxTail;				// next task to run, consumer only
+	RoomTask mailboxStub;
+	// tasks queued and not yet run; the room is on the executor while this is nonzero
+	std::atomic<int> pendingTasks;
 
 	const int BLUEINDEXSTART = 8;
-	bool gameStarted;
 
-	static unsigned __stdcall ThreadMain(void* pVoid);
+	void Push(RoomTask* task);
+	RoomTask* Pop();
+	void RunTask(ServerManager&, RoomTask*);
+	void DiscardTask(RoomTask*);
+
+	void ProcessEnterEvent(ServerManager&, SessionHandle session, const string& userName);
+	void ProcessReadyEvent(Client* affectedClient);
+	Client* ProcessTeamChangeEvent(Client* affectedClient);
+	bool ProcessLeaveGameroomEvent(Client* affectedClient, SessionHandle session);
+	void ProcessStartGameEvent(ServerManager&, SessionHandle session);
+	void ProcessSeekPositionEvent(ServerManager&, Client* affectedClient, SessionHandle session);
+	void ApplyState(RoomMember& member, SendFrame* frame);
+	void RebuildSlots();
+	bool ResolveHit(const RoomMember& member, state::HitState& hitState);
+	void RunTick(ServerManager&);
+	void SendSnapshot(ServerManager&);
+	uint32_t VisibleTo(const RoomMember& recipient, float radius);
+	float PriorityGain(const RoomMember& recipient, const RoomMember& player);
+	BuiltSnapshot BuildSnapshot(RoomMember& recipient, uint32_t baseTick, uint32_t visible, uint32_t baseFresh, int budget);
+	static void OnTick(TimerWheel* wheel, Timer* timer);
+	bool CanStart(string& errorMessage);
+	void Reject(ServerManager&, SessionHandle session, const char* contentType, const char* errorCode, const string& errorMessage);
+	void PublishRoomInfo(ServerManager&);
 
 	Client* GetClient(int position);
 	Client* MoveClientToOppositeTeam(Client*& affectedClient, int next_pos, Mutable_Team deleteFrom, Mutable_Team addTo);
@@ -52,14 +162,30 @@ private:
 	void ChangeGameroomHost(bool isOnRedteam);
 
 	//test
-	void BroadcastGeneralData(ServerManager&, DWORD, MessageLite*, SocketIterator, SocketIterator);
-	void BroadcastTypeData(ServerManager&, MessageLite*, SocketIterator, SocketIterator);
-	void BroadcastRawData(ServerManager&, DWORD, char*, SocketIterator, SocketIterator);
+	void BroadcastGeneralData(ServerManager&, DWORD, MessageLite*);
+	void BroadcastTypeData(ServerManager&, MessageLite*);
+	void BroadcastSharedFrame(ServerManager&, SendFrame*);
+	void BroadcastFrame(ServerManager&, SendFrame*);
 };
 
 enum BroadcastType
 {
 	DISPOSABLE = 4097,
 	NON_DISPOSABLE = 4098,
-	TYPEWITHOUTBODY = 4099
+	TYPEWITHOUTBODY = 4099,
+	SHARED_FRAME = 4100
+};
+
+// Requests a client makes of its room, run by the room like broadcasts
+enum RoomCommand
+{
+	ROOM_ENTER = 4201,
+	ROOM_READY,
+	ROOM_TEAM_CHANGE,
+	ROOM_LEAVE,
+	ROOM_START_GAME,
+	ROOM_SEEK_POSITION,
+	ROOM_STATE,		// a PLAY_STATE, WORLD_STATE or WORLD_STATE_BITS frame from a player, applied at once
+	ROOM_TICK,		// send a snapshot if anything changed since the last tick
+	ROOM_ACK		// a client acknowledged the snapshot of the tick in message
 };
\ No newline at end of file
@@ -0,0 +1,150 @@
+#include "RoomExecutor.h"
+#include "Room.h"
+#include "ErrorHandle.h"
+#include "def.h"
+
+// completion key of a wake-up that only tells a sleeping thread there is something to steal
+#define NUDGE_KEY 0
+
+static thread_local ExecutorThread* currentThread = nullptr;
+
+RoomExecutor::RoomExecutor()
+{
+}
+
+RoomExecutor::~RoomExecutor()
+{
+	for (ExecutorThread* lpThread : threads)
+		DeleteCriticalSection(&lpThread->csForRunQueue);
+	compPort.Close();
+}
+
+bool RoomExecutor::Start(int numOfThreads)
+{
+	if (!compPort.Create(numOfThreads))
+	{
+		ErrorHandling("Room Executor Port Creation Failed...", false);
+		return false;
+	}
+
+	// every thread is registered before any runs, so thieves never see the vector change
+	for (int i = 0; i < numOfThreads; ++i)
+	{
+		ExecutorThread* lpThread = new ExecutorThread();
+		lpThread->owner = this;
+		lpThread->index = i;
+		InitializeCriticalSection(&lpThread->csForRunQueue);
+		threads.push_back(lpThread);
+	}
+	for (ExecutorThread* lpThread : threads)
+	{
+		if (!StartThread(RoomExecutor::ThreadMain, lpThread))
+			ErrorHandling("Room Executor Thread Creation Failed...", false);
+	}
+
+	printf("[Log]: %d room executor threads\n", numOfThreads);
+	return true;
+}
+
+void RoomExecutor::Stop()
+{
+	for (size_t i = 0; i < threads.size(); ++i)
+		compPort.Post(0, KILL_THREAD);
+}
+
+void RoomExecutor::Schedule(Room* pRoom)
+{
+	if (currentThread != nullptr && currentThread->owner == this)
+		PushLocal(currentThread, pRoom);
+	else
+		compPort.Post(0, reinterpret_cast<ULONG_PTR>(pRoom));
+}
+
+void RoomExecutor::PushLocal(ExecutorThread* self, Room* pRoom)
+{
+	EnterCriticalSection(&self->csForRunQueue);
+	self->runQueue.push_back(pRoom);
+	bool shared = self->runQueue.size() > 1;
+	LeaveCriticalSection(&self->csForRunQueue);
+
+	// more than this thread can run right now: let a sleeping one come and steal
+	if (shared)
+		compPort.Post(0, NUDGE_KEY);
+}
+
+Room* RoomExecutor::PopLocal(ExecutorThread* self)
+{
+	Room* pRoom = nullptr;
+	EnterCriticalSection(&self->csForRunQueue);
+	if (!self->runQueue.empty())
+	{
+		pRoom = self->runQueue.front();
+		self->runQueue.pop_front();
+	}
+	LeaveCriticalSection(&self->csForRunQueue);
+	return pRoom;
+}
+
+Room* RoomExecutor::Steal(ExecutorThread* self)
+{
+	for (size_t i = 1; i < threads.size(); ++i)
+	{
+		ExecutorThread* victim = threads[(self->index + i) % threads.size()];
+		Room* pRoom = nullptr;
+		EnterCriticalSection(&victim->csForRunQueue);
+		if (!victim->runQueue.empty())
+		{
+			pRoom = victim->runQueue.back();
+			victim->runQueue.pop_back();
+		}
+		LeaveCriticalSection(&victim->csForRunQueue);
+		if (pRoom != nullptr)
+			return pRoom;
+	}
+	return nullptr;
+}
+
+unsigned __stdcall RoomExecutor::ThreadMain(void* pVoid)
+{
+	ExecutorThread* self = (ExecutorThread*)pVoid;
+	RoomExecutor* executor = self->owner;
+	CompletionEntry entries[ROOM_EXECUTOR_BATCH];
+	currentThread = self;
+
+	while (true)
+	{
+		Room* pRoom = executor->PopLocal(self);
+		if (pRoom == nullptr)
+			pRoom = executor->Steal(self);
+		if (pRoom != nullptr)
+		{
+			// a room with work left goes to the back of this thread's queue, behind the others
+			if (pRoom->RunTasks())
+				executor->PushLocal(self, pRoom);
+			continue;
+		}
+
+		int count = executor->compPort.DequeueBatch(entries, ROOM_EXECUTOR_BATCH);
+		if (count == 0)
+			continue;
+
+		bool killed = false;
+		for (int i = 0; i < count; ++i)
+		{
+			if (entries[i].completionKey == KILL_THREAD)
+			{	// the rest of the batch is handed back to the port
+				for (int j = i + 1; j < count; ++j)
+					executor->compPort.Post(0, entries[j].completionKey);
+				killed = true;
+				break;
+			}
+			if (entries[i].completionKey != NUDGE_KEY)
+				executor->PushLocal(self, reinterpret_cast<Room*>(entries[i].completionKey));
+		}
+		if (killed)
+			break;
+	}
+
+	currentThread = nullptr;
+	return 0;
+}
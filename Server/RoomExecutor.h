@@ -0,0 +1,44 @@
+#pragma once
+
+#include <deque>
+#include <vector>
+#include "Platform.h"
+#include "CompletionPort.h"
+
+class Room;
+class RoomExecutor;
+
+// rooms one executor thread takes from the port in one wait
+#define ROOM_EXECUTOR_BATCH 16
+
+struct ExecutorThread {
+	RoomExecutor* owner;
+	int index;
+	// rooms this thread queued for itself; idle threads steal from the back
+	std::deque<Room*> runQueue;
+	CRITICAL_SECTION csForRunQueue;
+};
+
+// Runs every room on a fixed set of threads. A room with work is queued once (see
+// Room::InsertDataIntoBroadcastQueue) and run by one thread at a time, so room tasks never
+// run concurrently with each other. Rooms queued from outside go through the completion port,
+// where idle threads sleep; a room still busy after its turn goes back on its thread's own
+// queue, from which idle threads steal.
+class RoomExecutor {
+public:
+	RoomExecutor();
+	~RoomExecutor();
+
+	bool Start(int numOfThreads);
+	void Stop();
+	void Schedule(Room* pRoom);
+
+private:
+	CompletionPort compPort;
+	std::vector<ExecutorThread*> threads;
+
+	static unsigned __stdcall ThreadMain(void* pVoid);
+	Room* PopLocal(ExecutorThread* self);
+	Room* Steal(ExecutorThread* self);
+	void PushLocal(ExecutorThread* self, Room* pRoom);
+};
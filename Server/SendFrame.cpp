@@ -0,0 +1,62 @@
+#include <climits>
+#include "SendFrame.h"
+#include "Packet.h"
+
+SendFrame::SendFrame(DWORD length) : refCount(1)
+{
+	this->length = length;
+	data = new char[length];
+	type = -1;
+	conflationKey = 0;
+}
+
+SendFrame::~SendFrame()
+{
+	delete[] data;
+}
+
+SendFrame* SendFrame::Create(int type, MessageLite* message)
+{
+	DWORD length = HEADER_SIZE;
+	if (message != nullptr)
+	{
+		size_t byteSize = message->ByteSizeLong();
+		// the header carries an int32 length
+		if (byteSize > INT_MAX)
+			ErrorHandling("Message too large for a frame....");
+		length += (DWORD)byteSize;
+	}
+
+	SendFrame* frame = new SendFrame(length);
+	Packet::PackMessage(frame->data, length, type, message);
+	frame->type = type;
+	return frame;
+}
+
+SendFrame* SendFrame::Create(const char* raw, DWORD length)
+{
+	SendFrame* frame = new SendFrame(length);
+	CopyMemory(frame->data, raw, length);
+	return frame;
+}
+
+SendFrame* SendFrame::Create(int type, const char* body, DWORD bodyLength)
+{
+	SendFrame* frame = new SendFrame(HEADER_SIZE + bodyLength);
+	CodedOutputStream::WriteLittleEndian32ToArray((uint32)type, (uint8*)frame->data);
+	CodedOutputStream::WriteLittleEndian32ToArray((uint32)bodyLength, (uint8*)frame->data + 4);
+	CopyMemory(frame->data + HEADER_SIZE, body, bodyLength);
+	frame->type = type;
+	return frame;
+}
+
+void SendFrame::AddRef()
+{
+	refCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SendFrame::Release()
+{
+	if (refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		delete this;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include "Platform.h"
+#include "MessageContext.h"
+
+// An immutable, fully framed message. A broadcast serializes once and every recipient's
+// send queue holds a reference; the frame is freed when the last send using it completes.
+class SendFrame {
+public:
+	static SendFrame* Create(int type, MessageLite* message = nullptr);
+	static SendFrame* Create(const char* raw, DWORD length);
+	// Frames a body that is already serialized.
+	static SendFrame* Create(int type, const char* body, DWORD bodyLength);
+
+	void AddRef();
+	void Release();
+
+	char* data;
+	DWORD length;
+	int type;
+	// Frames with the same non-zero key and type supersede each other, so a lagging
+	// receiver only needs the newest one. Room snapshots use the room id, so a queued
+	// snapshot is replaced by the room's next one.
+	uint32_t conflationKey;
+
+private:
+	SendFrame(DWORD length);
+	~SendFrame();
+
+	std::atomic<int> refCount;
+};
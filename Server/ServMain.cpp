@@ -1,18 +1,18 @@
 #include <cstdio>
 #include <cstdlib>
-#include <WinSock2.h>
-#include <Windows.h>
 #include "ServerManager.h"
+#include "ServerConfig.h"
 
 int main(int argc, char* argv[])
 {
-	//if (argc != 2) {
-	//	printf("Usage: %s <Port>\n", argv[0]);
-	//	exit(1);
-	//}
+	ServerConfig config;
+	if (!config.ParseArgs(argc, argv)) {
+		ServerConfig::PrintUsage(argv[0]);
+		exit(1);
+	}
 
 	ServerManager& servManager = ServerManager::getInstance();
-	servManager.Start();
+	servManager.Start(config);
 
 	return 0;
-}
\ No newline at end of file
+}
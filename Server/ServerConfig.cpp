@@ -0,0 +1,145 @@
+#include "ServerConfig.h"
+#include "CompletionPort.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+ServerConfig::ServerConfig()
+{
+	port = PORT;
+	backlog = SOMAXCONN;
+	outstandingAccepts = 64;
+	maxMessageSize = DEFAULT_MAX_MESSAGE_SIZE;
+	sendSoftBytes = 64 * 1024;
+	sendHardBytes = 1024 * 1024;
+	sendSoftFrames = 128;
+	sendHardFrames = 2048;
+	idleTimeout = 60;
+	pingInterval = 15;
+	dequeueBatch = 64;
+	workers = 0;
+	minWorkers = 0;
+	maxWorkers = 0;
+	affinity = 0;
+	numa = 0;
+	tickRate = 30;
+	compactTransform = 0;
+	worldBound = 1024;
+	interestRadius = 0;
+	snapshotBudget = 0;
+	roomThreads = 0;
+	shards = 0;
+}
+
+static bool ParseIntOption(const char* arg, const char* name, int& value)
+{
+	size_t length = strlen(name);
+	if (strncmp(arg, name, length) != 0 || arg[length] != '=')
+		return false;
+
+	value = atoi(arg + length + 1);
+	return true;
+}
+
+bool ServerConfig::ParseArgs(int argc, char* argv[])
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		const char* arg = argv[i];
+		if (ParseIntOption(arg, "--port", port)) continue;
+		if (ParseIntOption(arg, "--backlog", backlog)) continue;
+		if (ParseIntOption(arg, "--accepts", outstandingAccepts)) continue;
+		if (ParseIntOption(arg, "--shards", shards)) continue;
+		if (ParseIntOption(arg, "--max-message", maxMessageSize)) continue;
+		if (ParseIntOption(arg, "--send-soft", sendSoftBytes)) continue;
+		if (ParseIntOption(arg, "--send-hard", sendHardBytes)) continue;
+		if (ParseIntOption(arg, "--send-soft-frames", sendSoftFrames)) continue;
+		if (ParseIntOption(arg, "--send-hard-frames", sendHardFrames)) continue;
+		if (ParseIntOption(arg, "--idle-timeout", idleTimeout)) continue;
+		if (ParseIntOption(arg, "--ping-interval", pingInterval)) continue;
+		if (ParseIntOption(arg, "--batch", dequeueBatch)) continue;
+		if (ParseIntOption(arg, "--workers", workers)) continue;
+		if (ParseIntOption(arg, "--min-workers", minWorkers)) continue;
+		if (ParseIntOption(arg, "--max-workers", maxWorkers)) continue;
+		if (ParseIntOption(arg, "--affinity", affinity)) continue;
+		if (ParseIntOption(arg, "--numa", numa)) continue;
+		if (ParseIntOption(arg, "--room-threads", roomThreads)) continue;
+		if (ParseIntOption(arg, "--tick-rate", tickRate)) continue;
+		if (ParseIntOption(arg, "--compact-transform", compactTransform)) continue;
+		if (ParseIntOption(arg, "--world-bound", worldBound)) continue;
+		if (ParseIntOption(arg, "--interest-radius", interestRadius)) continue;
+		if (ParseIntOption(arg, "--snapshot-budget", snapshotBudget)) continue;
+
+		fprintf(stderr, "Unknown option: %s\n", arg);
+		return false;
+	}
+
+	Resolve();
+	return true;
+}
+
+void ServerConfig::Resolve()
+{
+	if (outstandingAccepts < 1)
+		outstandingAccepts = 1;
+	if (dequeueBatch < 1)
+		dequeueBatch = 1;
+	if (dequeueBatch > MAX_DEQUEUE_BATCH)
+		dequeueBatch = MAX_DEQUEUE_BATCH;
+	if (shards < 0)
+		shards = GetNumberOfProcessors();
+
+	// a shard is single-threaded unless asked otherwise; the shared pool starts at one
+	// worker per processor and may grow up to the old fixed size when workers block
+	int processors = GetNumberOfProcessors();
+	if (workers <= 0)
+		workers = (shards > 0) ? 1 : processors;
+	if (minWorkers <= 0)
+		minWorkers = (shards > 0) ? workers : (workers + 1) / 2;
+	if (maxWorkers <= 0)
+		maxWorkers = (shards > 0) ? workers : processors * 2 + 2;
+	if (minWorkers > workers)
+		minWorkers = workers;
+	if (maxWorkers < workers)
+		maxWorkers = workers;
+	if (roomThreads <= 0)
+		roomThreads = processors;
+	if (tickRate < 1)
+		tickRate = 1;
+	if (tickRate > 1000)
+		tickRate = 1000;
+	if (worldBound < 1)
+		worldBound = 1;
+	if (interestRadius < 0)
+		interestRadius = 0;
+	if (snapshotBudget < 0)
+		snapshotBudget = 0;
+}
+
+void ServerConfig::PrintUsage(const char* program)
+{
+	printf("Usage: %s [options]\n", program);
+	printf("  --port=N              listening port (default %d)\n", PORT);
+	printf("  --backlog=N           listen backlog (default SOMAXCONN)\n");
+	printf("  --accepts=N           accepts kept outstanding (default 64)\n");
+	printf("  --max-message=N       largest inbound frame in bytes (default %d)\n", DEFAULT_MAX_MESSAGE_SIZE);
+	printf("  --send-soft=N         outbound bytes queued before state frames are conflated (default 65536)\n");
+	printf("  --send-hard=N         outbound bytes queued before a client is dropped (default 1048576)\n");
+	printf("  --send-soft-frames=N  frame count soft mark (default 128)\n");
+	printf("  --send-hard-frames=N  frame count hard mark (default 2048)\n");
+	printf("  --idle-timeout=S      seconds without input before a client is closed, 0 = never (default 60)\n");
+	printf("  --ping-interval=S     seconds between heartbeat pings, 0 = off (default 15)\n");
+	printf("  --batch=N             completions taken per wait, up to %d (default 64)\n", MAX_DEQUEUE_BATCH);
+	printf("  --workers=N           worker threads per event loop at start (default: processors, 1 per shard)\n");
+	printf("  --min-workers=N       fewest workers the adaptive pool shrinks to (default: half of --workers)\n");
+	printf("  --max-workers=N       most workers the adaptive pool grows to (default: 2 * processors + 2)\n");
+	printf("  --affinity=1          pin each worker to one processor\n");
+	printf("  --numa=1              keep each event loop's workers on one NUMA node (implies --affinity)\n");
+	printf("  --room-threads=N      threads running rooms, however many rooms are open (default: processors)\n");
+	printf("  --tick-rate=HZ        room ticks per second in game, e.g. 20, 30 or 60 (default 30)\n");
+	printf("  --compact-transform=1 quantized positions and rotations in snapshots, see PlayState.proto\n");
+	printf("  --world-bound=M       largest coordinate a compact position holds (default 1024)\n");
+	printf("  --interest-radius=M   send each player only teammates and others within M, 0 = everyone (default 0)\n");
+	printf("  --snapshot-budget=N   bytes of snapshot per client per tick, most urgent players first, 0 = no limit (default 0)\n");
+	printf("  --shards=N            one event loop and listener per shard, -1 for one per core (default 0: shared pool)\n");
+}
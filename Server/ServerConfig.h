@@ -0,0 +1,36 @@
+#pragma once
+
+#include "def.h"
+
+// Runtime settings, filled from the command line in ServMain.
+struct ServerConfig {
+	int port;
+	int backlog;              // listen() backlog
+	int outstandingAccepts;   // accepts kept posted on the listener at all times
+	int maxMessageSize;       // largest inbound frame, header included
+	int sendSoftBytes;        // per-connection outbound marks, see IOInfo::SetSendLimits
+	int sendHardBytes;
+	int sendSoftFrames;
+	int sendHardFrames;
+	int idleTimeout;          // seconds without input before a client is closed, 0 = never
+	int pingInterval;         // seconds between heartbeat pings, 0 = no pings
+	int dequeueBatch;         // completions a worker takes per wait, 1..MAX_DEQUEUE_BATCH
+	int workers;              // worker threads each event loop starts with, 0 = auto
+	int minWorkers;           // bounds for the adaptive pool, 0 = auto; equal bounds fix the size
+	int maxWorkers;
+	int affinity;             // nonzero: pin each worker to one processor
+	int numa;                 // nonzero: keep each event loop's workers on one NUMA node
+	int tickRate;             // room ticks per second once a game starts
+	int compactTransform;     // nonzero: snapshots carry CompactTransform instead of TransformProto
+	int worldBound;           // CompactTransform positions cover -worldBound..worldBound on each axis
+	int interestRadius;       // players farther apart than this on the ground are not sent to each other, 0 = off
+	int snapshotBudget;       // bytes a client may be sent in one tick's snapshot, 0 = no limit
+	int roomThreads;          // threads of the shared room executor, 0 = one per processor
+	int shards;               // 0: one listener shared by the pool, N: N event loops with SO_REUSEPORT listeners
+
+	ServerConfig();
+	bool ParseArgs(int argc, char* argv[]);
+	// Turns the 0 = auto fields into counts and clamps the rest; running it again changes nothing.
+	void Resolve();
+	static void PrintUsage(const char* program);
+};
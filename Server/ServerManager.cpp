@@ -1,10 +1,13 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cassert>
-#include <process.h>
 #include <string>
+#include <iostream>
+#include <atomic>
+#include <algorithm>
 #include "ServerManager.h"
 #include "ErrorHandle.h"
+#include "Metrics.h"
 #include "def.h"
 #include "Packet.h"
 
@@ -15,65 +18,126 @@ ServerManager::ServerManager()
 	//freopen("output_log.txt", "w", stdout);
 
 	roomIdStatus = 100;
-	hCompPort = NULL; 
-	servSock = INVALID_SOCKET;
-	hMutexObj = CreateMutex(NULL, FALSE, NULL);
+	listenPerLoop = false;
+	nextEventLoop = 0;
 	InitializeCriticalSection(&csForRoomList);
 	InitializeCriticalSection(&csForServerRoomList);
 	InitializeCriticalSection(&csForRoomTable);
 	InitializeCriticalSection(&csForClientLocationTable);
+	InitializeCriticalSection(&csForCloseClient);
+	InitializeCriticalSection(&csForIdleAccepts);
 }
 
 ServerManager::~ServerManager() 
 { 
-	if (hCompPort != NULL)
-		CloseHandle(hCompPort);
-	if (servSock != INVALID_SOCKET)
-		closesocket(servSock);
-	if (hMutexObj != NULL)
-		CloseHandle(hMutexObj);
+	for (EventLoop* lpEventLoop : eventLoops)
+	{
+		lpEventLoop->compPort.Close();
+		if (lpEventLoop->servSock != INVALID_SOCKET)
+			closesocket(lpEventLoop->servSock);
+		delete[] lpEventLoop->acceptRequests;
+		delete lpEventLoop;
+	}
 
 	DeleteCriticalSection(&csForRoomList);
 	DeleteCriticalSection(&csForServerRoomList);
 	DeleteCriticalSection(&csForRoomTable);
 	DeleteCriticalSection(&csForClientLocationTable);
+	DeleteCriticalSection(&csForCloseClient);
+	DeleteCriticalSection(&csForIdleAccepts);
 
+#ifdef _WIN32
 	WSACleanup();
+#endif
 }
 
-void ServerManager::Start(int port)
+void ServerManager::Start(const ServerConfig& startConfig)
 {
-	InitSocket(port);
-	InitCompletionPort();
-	CreateThreadPool();
-	AcceptClient();
+	// a config built in code still has its 0 = auto fields unresolved
+	config = startConfig;
+	config.Resolve();
+	Packet::SetMaxMessageSize(config.maxMessageSize);
+	IOInfo::SetSendLimits(config.sendSoftBytes, config.sendHardBytes, config.sendSoftFrames, config.sendHardFrames);
+	SnapshotBuilder::SetTransformEncoding(config.compactTransform != 0, (float)config.worldBound);
+	InitNetwork();
+	if (!InitEventLoops())
+		return;
+	if (!roomExecutor.Start(config.roomThreads))
+		return;
+
+	for (EventLoop* lpEventLoop : eventLoops)
+	{
+		if (lpEventLoop->servSock == INVALID_SOCKET)
+			continue;
+
+		// the listener completes on the loop's workers like any other socket
+		if (!lpEventLoop->compPort.Associate(lpEventLoop->servSock, ACCEPT_KEY)) {
+			ErrorHandling(WSAGetLastError());
+			return;
+		}
+
+		lpEventLoop->acceptRequests = new AcceptRequest[config.outstandingAccepts];
+		for (int i = 0; i < config.outstandingAccepts; ++i)
+			PostAccept(lpEventLoop, &lpEventLoop->acceptRequests[i]);
+	}
+
+	LOG("Accept Process Start");
+	MonitorServer();
 }
 
 void ServerManager::Stop() 
 {
 	ShutdownThreads();
-	CloseHandle(hCompPort);
-	closesocket(servSock);
-	CloseHandle(hMutexObj);
-
-	hCompPort = NULL;
-	servSock = INVALID_SOCKET;
-	hMutexObj = NULL;
+	roomExecutor.Stop();
+	for (EventLoop* lpEventLoop : eventLoops)
+	{
+		lpEventLoop->compPort.Close();
+		if (lpEventLoop->servSock != INVALID_SOCKET)
+			closesocket(lpEventLoop->servSock);
+		lpEventLoop->servSock = INVALID_SOCKET;
+	}
 }
 
-void ServerManager::InitSocket(int port, int prime, int sub)
+void ServerManager::InitNetwork(int prime, int sub)
 {
+#ifdef _WIN32
 	if (WSAStartup(MAKEWORD(prime, sub), &wsaData) != 0) {
 		ErrorHandling(WSAGetLastError());
 		return;
 	}
+#else
+	// the Winsock version; sockets need no setup elsewhere
+	(void)prime;
+	(void)sub;
+#endif
+}
 
-	servSock = WSASocket(AF_INET, SOCK_STREAM, 0, NULL, 0, WSA_FLAG_OVERLAPPED);
+SOCKET ServerManager::InitSocket(int port, int backlog, bool reusePort)
+{
+#ifdef _WIN32
+	SOCKET servSock = WSASocket(AF_INET, SOCK_STREAM, 0, NULL, 0, WSA_FLAG_OVERLAPPED);
+#else
+	SOCKET servSock = socket(AF_INET, SOCK_STREAM, 0);
+#endif
 	if (servSock == INVALID_SOCKET) {
 		ErrorHandling(WSAGetLastError());
-		return;
+		return INVALID_SOCKET;
 	}
 
+#ifndef _WIN32
+	// lets a restarted server rebind while old connections sit in TIME_WAIT
+	int reuse = 1;
+	setsockopt(servSock, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+#endif
+#ifdef SO_REUSEPORT
+	// every shard binds the same port and the kernel spreads incoming connections across them
+	if (reusePort && setsockopt(servSock, SOL_SOCKET, SO_REUSEPORT, (char*)&reuse, sizeof(reuse)) == SOCKET_ERROR) {
+		ErrorHandling(WSAGetLastError());
+		closesocket(servSock);
+		return INVALID_SOCKET;
+	}
+#endif
+
 	SOCKADDR_IN servAdr;
 	memset(&servAdr, 0, sizeof(servAdr));
 	servAdr.sin_family = AF_INET;
@@ -83,88 +147,223 @@ void ServerManager::InitSocket(int port, int prime, int sub)
 	if (bind(servSock, (SOCKADDR*)&servAdr, sizeof(servAdr)) == SOCKET_ERROR) {
 		ErrorHandling(WSAGetLastError());
 		closesocket(servSock);
-		servSock = NULL;
-		return;
+		return INVALID_SOCKET;
 	}
 
-	if (listen(servSock, SOMAXCONN) == SOCKET_ERROR) {
+	if (listen(servSock, backlog) == SOCKET_ERROR) {
 		ErrorHandling(WSAGetLastError());
 		closesocket(servSock);
-		servSock = NULL;
-		return;
+		return INVALID_SOCKET;
 	}
 
 	LOG("Server Socket Initiation Success!!");
+	return servSock;
 }
 
-void ServerManager::InitCompletionPort(int maxNumberOfThreads)
+void ServerManager::InitCompletionPort(EventLoop* lpEventLoop, int maxNumberOfThreads)
 {
-	hCompPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, maxNumberOfThreads);
-	if (hCompPort == NULL) {
+	if (!lpEventLoop->compPort.Create(maxNumberOfThreads)) {
 		ErrorHandling(WSAGetLastError());
 		return;
 	}
 
-	LOG("IOCP Kernel Object Created!!");
+	LOG("Completion Port Created!!");
 }
 
-void ServerManager::AcceptClient()
+bool ServerManager::InitEventLoops()
 {
-	SocketInfo* lpSocketInfo;
-	SOCKET clntSock;
-	SOCKADDR_IN clntAdr;
-	int clntAdrSz = sizeof(SOCKADDR_IN);
-
-	LOG("Accept Process Start");
+	int numOfLoops = (config.shards > 0) ? config.shards : 1;
+#ifdef SO_REUSEPORT
+	listenPerLoop = config.shards > 0;
+#endif
 
-	while (true)
+	for (int i = 0; i < numOfLoops; ++i)
 	{
-		__try
+		EventLoop* lpEventLoop = new EventLoop();
+		lpEventLoop->id = i;
+		lpEventLoop->owner = this;
+		eventLoops.push_back(lpEventLoop);
+
+		if (i == 0 || listenPerLoop)
 		{
-			clntSock = accept(servSock, (SOCKADDR*)&clntAdr, &clntAdrSz);
-			if (clntSock == INVALID_SOCKET)
-			{
-				int errCode = WSAGetLastError();
-				if (errCode == WSAEINTR)
-				{
-					return;
-				}
-				ErrorHandling(errCode, false);
-				__leave;
-			}
+			lpEventLoop->servSock = InitSocket(config.port, config.backlog, listenPerLoop);
+			if (lpEventLoop->servSock == INVALID_SOCKET)
+				return false;
+		}
 
-			printf("Client %d (%s::%d) connected\n", clntSock, inet_ntoa(clntAdr.sin_addr), ntohs(clntAdr.sin_port));
+		// the port lets as many workers run at once as the loop starts with, so a single-threaded
+		// shard never wakes more than one; workers the pool adds later run while others block
+		AssignProcessors(lpEventLoop, numOfLoops);
+		int processors = lpEventLoop->processors.empty() ? GetNumberOfProcessors() : (int)lpEventLoop->processors.size();
+		InitCompletionPort(lpEventLoop, config.workers < processors ? config.workers : processors);
+		CreateThreadPool(lpEventLoop, config.workers);
+	}
 
-			// socket context 생성(Completion Key로 넘김)
-			lpSocketInfo = SocketInfo::AllocateSocketInfo(clntSock);
-			if (lpSocketInfo == NULL)
-			{
-				ErrorHandling("Socket Info Object Allocation Failed...", false);
-				continue;
-			}
+	if (config.shards > 0)
+		printf("[Log]: %d event loops, %s\n", numOfLoops,
+			listenPerLoop ? "one SO_REUSEPORT listener each" : "connections handed out by loop #0");
+	return true;
+}
 
-			// IOCP와 clnt socket 연결
-			if (CreateIoCompletionPort((HANDLE)clntSock, hCompPort, (ULONG_PTR)lpSocketInfo, 0)
-				== NULL) {
-				ErrorHandling(WSAGetLastError(), false);
-				continue;
-			}
-			SendInitData(lpSocketInfo);
-		}
-		__finally
-		{
-			if (AbnormalTermination())
-			{
-				// CloseClient
-				CloseClient(lpSocketInfo);
-			}
-		}
+void ServerManager::PostAccept(EventLoop* lpEventLoop, AcceptRequest* lpAcceptRequest)
+{
+	if (!CompletionPort::PostAccept(lpEventLoop->servSock, lpAcceptRequest))
+	{
+		ErrorHandling("Posting Accept Failed...", WSAGetLastError(), false);
+		EnterCriticalSection(&csForIdleAccepts);
+		idleAccepts.push_back(std::make_pair(lpEventLoop, lpAcceptRequest));
+		LeaveCriticalSection(&csForIdleAccepts);
+	}
+}
+
+void ServerManager::HandleAcceptEvent(EventLoop* lpEventLoop, AcceptRequest* lpAcceptRequest, bool success)
+{
+	SOCKET clntSock = lpAcceptRequest->acceptSocket;
+	if (success && CompletionPort::CompleteAccept(lpEventLoop->servSock, lpAcceptRequest))
+	{
+		Metrics::accepted++;
+
+		EventLoop* lpOwner = listenPerLoop ? lpEventLoop
+			: eventLoops[nextEventLoop++ % eventLoops.size()];
+		AcceptClient(lpOwner, clntSock, lpAcceptRequest->clntAdr);
+	}
+	else
+	{
+		Metrics::acceptFailed++;
+		if (clntSock != INVALID_SOCKET)
+			closesocket(clntSock);
+	}
+
+	lpAcceptRequest->acceptSocket = INVALID_SOCKET;
+	PostAccept(lpEventLoop, lpAcceptRequest);
+}
+
+void ServerManager::AcceptClient(EventLoop* lpEventLoop, SOCKET clntSock, const SOCKADDR_IN& clntAdr)
+{
+	printf("Client %d (%s::%d) connected\n", (int)clntSock, inet_ntoa(clntAdr.sin_addr), ntohs(clntAdr.sin_port));
+
+	// socket context 생성(Completion Key로 넘김)
+	SocketInfo* lpSocketInfo = SocketInfo::AllocateSocketInfo(clntSock);
+	if (lpSocketInfo == NULL)
+	{
+		ErrorHandling("Socket Info Object Allocation Failed...", false);
+		closesocket(clntSock);
+		return;
+	}
+
+	// Completion Port와 clnt socket 연결
+	lpSocketInfo->compPort = &lpEventLoop->compPort;
+	lpSocketInfo->timers = &lpEventLoop->timers;
+	// completions carry the slot; each holds a reference, so the slot is not reused under them
+	if (!lpSocketInfo->compPort->Associate(clntSock, lpSocketInfo->CompletionKey())) {
+		ErrorHandling(WSAGetLastError(), false);
+		CloseClient(lpSocketInfo);
+		return;
+	}
+	SendInitData(lpSocketInfo);
+	ArmHeartbeat(lpSocketInfo);
+}
+
+void ServerManager::ArmHeartbeat(SocketInfo* lpSocketInfo)
+{
+	int period = config.pingInterval;
+	if (period <= 0 || (config.idleTimeout > 0 && config.idleTimeout < period))
+		period = config.idleTimeout;
+	if (period <= 0)
+		return;
+
+	lpSocketInfo->heartbeat.callback = ServerManager::OnHeartbeat;
+	lpSocketInfo->timers->Schedule(&lpSocketInfo->heartbeat, period * 1000);
+}
+
+void ServerManager::OnHeartbeat(TimerWheel* wheel, Timer* timer)
+{
+	SocketInfo* lpSocketInfo = (SocketInfo*)timer->context;
+	const ServerConfig& config = self->config;
+	ULONGLONG now = GetTickCount64();
+
+	if (config.idleTimeout > 0 && now - lpSocketInfo->lastReceived >= (ULONGLONG)config.idleTimeout * 1000)
+	{
+		fprintf(stderr, "[Log]: Client %d idle, closing\n", (int)lpSocketInfo->socket);
+		if (self->DisconnectClient(lpSocketInfo))
+			Metrics::idleClosed++;
+		return;
+	}
+
+	// one ping at a time; a client that never answers is left to the idle timeout
+	ULONGLONG noPing = 0;
+	if (config.pingInterval > 0 && lpSocketInfo->pingSentAt.compare_exchange_strong(noPing, now))
+	{
+		MessageContext msgContext;
+		msgContext.header.type = MessageType::PING;
+		if (!self->SendPacket(lpSocketInfo, &msgContext))
+			return;
+	}
+	self->ArmHeartbeat(lpSocketInfo);
+}
+
+void ServerManager::HandlePong(SocketInfo* lpSocketInfo)
+{
+	ULONGLONG sentAt = lpSocketInfo->pingSentAt.exchange(0);
+	if (sentAt == 0)
+		return;
+
+	DWORD rtt = (DWORD)(GetTickCount64() - sentAt);
+	lpSocketInfo->rtt = rtt;
+	Metrics::pongs++;
+	Metrics::rttTotal += rtt;
+}
+
+void ServerManager::ScheduleRoomCleanup(Room* pRoom)
+{
+	pRoom->cleanupTimer.callback = ServerManager::OnRoomCleanup;
+	ScheduleRoomTimer(&pRoom->cleanupTimer, ROOM_CLEANUP_DELAY_MS);
+}
+
+void ServerManager::ScheduleRoomTimer(Timer* timer, DWORD delayMs)
+{
+	// rooms run on executor threads, so any loop's workers can fire their timers
+	eventLoops.front()->timers.Schedule(timer, delayMs);
+}
+
+void ServerManager::CancelRoomTimer(Timer* timer)
+{
+	eventLoops.front()->timers.Cancel(timer);
+}
+
+void ServerManager::OnRoomCleanup(TimerWheel* wheel, Timer* timer)
+{
+	Room* pRoom = (Room*)timer->context;
+	// broadcasts queued before it closed are still being sent
+	if (pRoom->HasPendingTasks())
+	{
+		wheel->Schedule(timer, ROOM_CLEANUP_DELAY_MS);
+		return;
+	}
+	delete pRoom; // Room* 해제 여기서
+}
+
+void ServerManager::MonitorServer()
+{
+	while (true)
+	{
+		Sleep(1000);
+		Metrics::Report();
+		for (EventLoop* lpEventLoop : eventLoops)
+			SampleWorkers(lpEventLoop);
+
+		std::vector<std::pair<EventLoop*, AcceptRequest*>> retry;
+		EnterCriticalSection(&csForIdleAccepts);
+		retry.swap(idleAccepts);
+		LeaveCriticalSection(&csForIdleAccepts);
+		for (auto& idle : retry)
+			PostAccept(idle.first, idle.second);
 	}
 }
 
 void ServerManager::CloseClient(SocketInfo* lpSocketInfo, bool graceful)
 {
-	WaitForSingleObject(hMutexObj, INFINITE);
+	EnterCriticalSection(&csForCloseClient);
 	if (lpSocketInfo != NULL && lpSocketInfo->socket != INVALID_SOCKET)
 	{
 		if (!graceful)
@@ -175,180 +374,441 @@ void ServerManager::CloseClient(SocketInfo* lpSocketInfo, bool graceful)
 			if (SOCKET_ERROR == setsockopt(lpSocketInfo->socket, SOL_SOCKET, SO_LINGER,
 				(char*)&LingerStruct, sizeof(LingerStruct))) {
 				fprintf(stderr, "Invalid socket.... %d\n", WSAGetLastError());
-				ReleaseMutex(hMutexObj);
+				LeaveCriticalSection(&csForCloseClient);
 				return;
 			}
 		}
-		closesocket(lpSocketInfo->socket);
+		if (lpSocketInfo->timers != NULL)
+			lpSocketInfo->timers->Cancel(&lpSocketInfo->heartbeat);
+		SOCKET sock = lpSocketInfo->socket;
+		CompletionPort* compPort = lpSocketInfo->compPort;
 
+		// nothing is posted on the socket past this, so its number may be reused
 		SocketInfo::DeallocateSocketInfo(lpSocketInfo);
+		compPort->Dissociate(sock);
+		closesocket(sock);
 	}
-	ReleaseMutex(hMutexObj);
+	LeaveCriticalSection(&csForCloseClient);
 }
 
-void ServerManager::CreateThreadPool(int numOfThreads)
+void ServerManager::CreateThreadPool(EventLoop* lpEventLoop, int numOfThreads)
 {
-	if (numOfThreads == 0)
+	for (int i = 0; i < numOfThreads; ++i)
+		StartWorker(lpEventLoop);
+}
+
+void ServerManager::AssignProcessors(EventLoop* lpEventLoop, int numOfLoops)
+{
+	if (!config.affinity && !config.numa)
+		return;
+
+	int processors = GetNumberOfProcessors();
+	if (config.numa)
+	{	// loops are dealt out over the nodes, and a loop's workers stay on its node
+		std::vector<int> nodes;
+		for (int p = 0; p < processors; ++p)
+		{
+			int node = GetNumaNodeOfProcessor(p);
+			if (std::find(nodes.begin(), nodes.end(), node) == nodes.end())
+				nodes.push_back(node);
+		}
+		int node = nodes[lpEventLoop->id % nodes.size()];
+		for (int p = 0; p < processors; ++p)
+		{
+			if (GetNumaNodeOfProcessor(p) == node)
+				lpEventLoop->processors.push_back(p);
+		}
+		printf("[Log]: event loop #%d on NUMA node %d, %d processors\n",
+			lpEventLoop->id, node, (int)lpEventLoop->processors.size());
+		return;
+	}
+
+	// loops get disjoint processors while there are enough to go round
+	if (numOfLoops >= processors)
 	{
-		SYSTEM_INFO sysinfo;
-		GetSystemInfo(&sysinfo);
+		lpEventLoop->processors.push_back(lpEventLoop->id % processors);
+		return;
+	}
+	for (int p = lpEventLoop->id; p < processors; p += numOfLoops)
+		lpEventLoop->processors.push_back(p);
+}
 
-		threadPoolSize = sysinfo.dwNumberOfProcessors * 2 + 2;
+bool ServerManager::StartWorker(EventLoop* lpEventLoop)
+{
+	// a worker that has exited leaves its slot, and with it its processor, to the next one
+	size_t slot = 0;
+	while (slot < lpEventLoop->workers.size() && lpEventLoop->workers[slot]->running)
+		++slot;
+	if (slot == lpEventLoop->workers.size())
+	{
+		Worker* lpNewWorker = new Worker();
+		lpNewWorker->loop = lpEventLoop;
+		lpEventLoop->workers.push_back(lpNewWorker);
 	}
-	else
+
+	Worker* lpWorker = lpEventLoop->workers[slot];
+	lpWorker->processor = lpEventLoop->processors.empty() ? -1
+		: lpEventLoop->processors[slot % lpEventLoop->processors.size()];
+	lpWorker->running = true;
+	lpEventLoop->numOfThreads++;
+	if (!StartThread(ServerManager::ThreadMain, lpWorker))
 	{
-		threadPoolSize = numOfThreads;
+		lpWorker->running = false;
+		lpEventLoop->numOfThreads--;
+		ErrorHandling("Worker Thread Creation Failed...", false);
+		return false;
 	}
+	return true;
+}
 
-	for (int i = 0; i < threadPoolSize; ++i)
+void ServerManager::RetireWorker(EventLoop* lpEventLoop)
+{
+	// whichever worker dequeues it exits
+	lpEventLoop->numOfThreads--;
+	lpEventLoop->compPort.Post(0, KILL_THREAD);
+}
+
+// Once a second: reports how the loop's workers spent their time and resizes the pool.
+void ServerManager::SampleWorkers(EventLoop* lpEventLoop)
+{
+	ULONGLONG idle = 0, run = 0, blocked = 0;
+	for (Worker* lpWorker : lpEventLoop->workers)
 	{
-		DWORD dwThreadId = 0;
-		HANDLE hThread = BEGINTHREADEX(NULL, 0, ServerManager::ThreadMain, this, 0, &dwThreadId);
-		CloseHandle(hThread);
+		idle += lpWorker->idleMicros.exchange(0);
+		run += lpWorker->runMicros.exchange(0);
+		blocked += lpWorker->blockedMicros.exchange(0);
+	}
+
+	// a probe not picked up yet has been waiting at least this long
+	ULONGLONG now = GetMicroseconds();
+	ULONGLONG postedAt = lpEventLoop->probePostedAt;
+	ULONGLONG delay = (postedAt != 0) ? now - postedAt : lpEventLoop->queueDelayMicros.load();
+	if (postedAt == 0)
+	{
+		lpEventLoop->probePostedAt = now;
+		lpEventLoop->compPort.Post(0, PROBE_KEY);
+	}
+
+	int numOfThreads = lpEventLoop->numOfThreads;
+	ULONGLONG total = idle + run + blocked;
+	if (total > 0 && (run + blocked) * 100 >= total)
+		printf("[Metrics] loop #%d: %d workers, running %d%%, blocked %d%%, idle %d%%, queue delay %llu us\n",
+			lpEventLoop->id, numOfThreads, (int)(run * 100 / total), (int)(blocked * 100 / total),
+			(int)(idle * 100 / total), (unsigned long long)delay);
+
+	if (config.minWorkers == config.maxWorkers)
+		return;
+
+	// more threads than processors only help while workers are blocked rather than running
+	int processors = lpEventLoop->processors.empty() ? GetNumberOfProcessors() : (int)lpEventLoop->processors.size();
+	if (delay > WORKER_GROW_DELAY_US && numOfThreads < config.maxWorkers
+		&& (numOfThreads < processors || blocked > run))
+	{
+		if (StartWorker(lpEventLoop))
+			printf("[Log]: event loop #%d grew to %d workers (queue delay %llu us)\n",
+				lpEventLoop->id, numOfThreads + 1, (unsigned long long)delay);
+	}
+	else if (delay < WORKER_SHRINK_DELAY_US && idle > total / 2 && numOfThreads > config.minWorkers)
+	{
+		RetireWorker(lpEventLoop);
+		printf("[Log]: event loop #%d shrank to %d workers\n", lpEventLoop->id, numOfThreads - 1);
 	}
 }
 
 void ServerManager::ShutdownThreads()
 {
-	for (int i = 0; i < threadPoolSize; ++i)
+	for (EventLoop* lpEventLoop : eventLoops)
 	{
-		PostQueuedCompletionStatus(hCompPort, 0, KILL_THREAD, NULL);
+		for (int i = 0; i < lpEventLoop->numOfThreads; ++i)
+			lpEventLoop->compPort.Post(0, KILL_THREAD);
 	}
 }
 
 unsigned __stdcall ServerManager::ThreadMain(void * pVoid)
 {
-	ServerManager* self = (ServerManager*)pVoid; 
-	SocketInfo* lpSocketInfo;
-	IOInfo* lpIOInfo;
-	DWORD dwBytesTransferred = 0;
+	Worker* lpWorker = (Worker*)pVoid;
+	EventLoop* lpEventLoop = lpWorker->loop;
+	ServerManager* self = lpEventLoop->owner;
+	CompletionEntry entries[MAX_DEQUEUE_BATCH];
+
+	if (lpWorker->processor >= 0 && !SetCurrentThreadAffinity(lpWorker->processor))
+		ErrorHandling("Setting Worker Affinity Failed...", false);
 
+	ULONGLONG busyStart = GetMicroseconds();
+	ULONGLONG cpuStart = GetCurrentThreadCpuMicros();
 	while (true)
 	{
-		lpSocketInfo = NULL;
-		lpIOInfo = NULL;
-
-		bool rtn = GetQueuedCompletionStatus(self->hCompPort, &dwBytesTransferred,
-			reinterpret_cast<ULONG_PTR*>(&lpSocketInfo), reinterpret_cast<LPOVERLAPPED*>(&lpIOInfo), INFINITE);
-		if (rtn)
+		lpEventLoop->timers.Advance();
+
+		// since the last wait ended the worker was handling completions and timers;
+		// the part of that it was not on a processor it was blocked
+		ULONGLONG waitStart = GetMicroseconds();
+		ULONGLONG busy = waitStart - busyStart;
+		ULONGLONG run = GetCurrentThreadCpuMicros() - cpuStart;
+		if (run > busy)
+			run = busy;
+		lpWorker->runMicros += run;
+		lpWorker->blockedMicros += busy - run;
+
+		int count = lpEventLoop->compPort.DequeueBatch(entries, self->config.dequeueBatch,
+			lpEventLoop->timers.MillisecondsUntilNextTick());
+		busyStart = GetMicroseconds();
+		cpuStart = GetCurrentThreadCpuMicros();
+		lpWorker->idleMicros += busyStart - waitStart;
+		if (count == 0)
+			continue;	// timed out, timers are due
+		Metrics::RecordBatch(Metrics::loopBatchSizes, count);
+
+		// completions of one connection are handled back to back
+		std::stable_sort(entries, entries + count, [](const CompletionEntry& a, const CompletionEntry& b) {
+			return a.completionKey < b.completionKey;
+		});
+
+		// sends produced by the whole batch go out together at its end
+		int kills = 0;
+		IOInfo::BeginSendBatch();
+		for (int i = 0; i < count; ++i)
 		{
-			if (((DWORD)lpSocketInfo) == KILL_THREAD) break;
-
-			if (lpIOInfo == NULL) {
-				ErrorHandling("#1 Getting IO Information Failed...", WSAGetLastError(), false);
-				continue;
+			if (entries[i].success && entries[i].completionKey == KILL_THREAD)
+				kills++;
+			else if (entries[i].success && entries[i].completionKey == PROBE_KEY)
+			{
+				lpEventLoop->queueDelayMicros = GetMicroseconds() - lpEventLoop->probePostedAt;
+				lpEventLoop->probePostedAt = 0;
 			}
+			else
+				self->HandleCompletion(lpEventLoop, entries[i]);
+		}
+		IOInfo::FlushSendBatch();
+
+		if (kills > 0)
+		{	// every worker gets one; pass on the ones this batch took for others
+			for (int i = 1; i < kills; ++i)
+				lpEventLoop->compPort.Post(0, KILL_THREAD);
+			break;
+		}
+	}
+
+	lpWorker->running = false;
+	return 0;
+}
+
+void ServerManager::HandleCompletion(EventLoop* lpEventLoop, const CompletionEntry& entry)
+{
+	if (entry.completionKey == ACCEPT_KEY)
+	{
+		HandleAcceptEvent(lpEventLoop, reinterpret_cast<AcceptRequest*>(entry.lpRequest), entry.success);
+		return;
+	}
+	IOInfo* lpIOInfo = reinterpret_cast<IOInfo*>(entry.lpRequest);
+	SocketInfo* lpSocketInfo = SocketInfo::FromCompletionKey(entry.completionKey);
+	if (lpSocketInfo == NULL)
+		return;
+
+	// a completion still in flight when its session closed only gives back its send's frames
+	if (lpSocketInfo->handle == INVALID_SESSION)
+	{
+		if (lpIOInfo == lpSocketInfo->sendBuf)
+			lpIOInfo->HandleSend();
+	}
+	else
+	{
+		HandleSessionCompletion(lpSocketInfo, entry);
+	}
+	lpSocketInfo->Release();
+}
+
+void ServerManager::HandleSessionCompletion(SocketInfo* lpSocketInfo, const CompletionEntry& entry)
+{
+	IOInfo* lpIOInfo = reinterpret_cast<IOInfo*>(entry.lpRequest);
+	DWORD dwBytesTransferred = entry.dwBytesTransferred;
+	if (entry.success)
+	{
+		if (lpIOInfo == NULL) {
+			ErrorHandling("#1 Getting IO Information Failed...", WSAGetLastError(), false);
+			return;
+		}
+	}
+	else
+	{
+		if (lpIOInfo == NULL) {
+			ErrorHandling("#2 Getting IO Information Failed...", WSAGetLastError(), false);
 		}
 		else
 		{
-			if (lpIOInfo == NULL) {
-				ErrorHandling("#2 Getting IO Information Failed...", WSAGetLastError(), false);
-			}
-			else
+			if (dwBytesTransferred == 0)
 			{
-				if (dwBytesTransferred == 0)
-				{
-					fprintf(stderr, "[Current Thread #%d] => ", GetCurrentThreadId());
-					fprintf(stderr, "#%d will close: %d\n", lpSocketInfo->socket, WSAGetLastError());
-					self->ProcessDisconnection(lpSocketInfo);
-					self->CloseClient(lpSocketInfo);
-				}
+				fprintf(stderr, "[Current Thread #%d] => ", GetCurrentThreadId());
+				fprintf(stderr, "#%d will close: %d\n", (int)lpSocketInfo->socket, WSAGetLastError());
+				ProcessDisconnection(lpSocketInfo);
+				CloseClient(lpSocketInfo);
 			}
-			continue;
+			// the frames of a failed send are released all the same
+			if (lpIOInfo == lpSocketInfo->sendBuf)
+				lpIOInfo->HandleSend();
 		}
+		return;
+	}
 
-		try
+	try
+	{
+		//fprintf(stderr, "[Current Thread #%d] => ", GetCurrentThreadId());
+		if (dwBytesTransferred == 0)
 		{
-			//fprintf(stderr, "[Current Thread #%d] => ", GetCurrentThreadId());
-			if (dwBytesTransferred == 0)
-			{
-				ErrorHandling("dwBytesTransferred == 0...", WSAGetLastError(), false);
-				fprintf(stderr, "[Log]: Client %d Connection Closed....\n", (HANDLE)lpSocketInfo->socket);
-				//클라이언트 접속이 끊어지는 부분
-				self->ProcessDisconnection(lpSocketInfo);
-				throw "[Cause]: dwBytesTransferr == 0";
-			}
+			ErrorHandling("dwBytesTransferred == 0...", WSAGetLastError(), false);
+			fprintf(stderr, "[Log]: Client %d Connection Closed....\n", (int)lpSocketInfo->socket);
+			//클라이언트 접속이 끊어지는 부분
+			ProcessDisconnection(lpSocketInfo);
+			throw "[Cause]: dwBytesTransferr == 0";
+		}
 
-			if (lpIOInfo == lpSocketInfo->recvBuf)
+		if (lpIOInfo == lpSocketInfo->recvBuf)
+		{
+			//LOG("Complete Receiving Message!!");
+			if (!(HandleRecvEvent(lpSocketInfo, dwBytesTransferred)))
 			{
-				//LOG("Complete Receiving Message!!");
-				if (!(self->HandleRecvEvent(lpSocketInfo, dwBytesTransferred)))
-				{
-					throw "[Cause]: RecvEvent Handling Error!!";
-				}
+				throw "[Cause]: RecvEvent Handling Error!!";
 			}
-			else if (lpIOInfo == lpSocketInfo->sendBuf)
-			{
-				//LOG("Complete Sending Message!!");
-				if (!(self->HandleSendEvent(lpSocketInfo, dwBytesTransferred)))
-				{
-					throw "[Cause]: SendEvent Handling Error!!";
-				}
-			}
-			else
+		}
+		else if (lpIOInfo == lpSocketInfo->sendBuf)
+		{
+			//LOG("Complete Sending Message!!");
+			if (!(HandleSendEvent(lpSocketInfo, dwBytesTransferred)))
 			{
-				throw "[Cause]: UnknownEvent Exception...";
+				throw "[Cause]: SendEvent Handling Error!!";
 			}
 		}
-		catch (const char* msg)
+		else
 		{
-			ErrorHandling(msg, WSAGetLastError(), false);
-			self->CloseClient(lpSocketInfo);
+			throw "[Cause]: UnknownEvent Exception...";
 		}
 	}
-
-	return 0;
+	catch (const char* msg)
+	{
+		ErrorHandling(msg, WSAGetLastError(), false);
+		CloseClient(lpSocketInfo);
+	}
 }
 
 bool ServerManager::SendPacket(SocketInfo* lpSocketInfo, const MessageContext* msgContext)
 {
-	return lpSocketInfo->sendBuf->Send(lpSocketInfo->socket, msgContext);
+	return SendPacket(lpSocketInfo->handle, msgContext);
+}
+
+bool ServerManager::SendPacket(SessionHandle session, const MessageContext* msgContext)
+{
+	SocketInfo* lpSocketInfo = SocketInfo::FromHandle(session);
+	if (lpSocketInfo == NULL)
+		return false;
+	if (lpSocketInfo->sendBuf->Send(session, msgContext))
+		return true;
+	if (DisconnectClient(lpSocketInfo))
+		Metrics::slowConsumerKicks++;
+	return false;
+}
+
+bool ServerManager::SendSharedFrame(SessionHandle session, SendFrame* frame)
+{
+	SocketInfo* lpSocketInfo = SocketInfo::FromHandle(session);
+	if (lpSocketInfo == NULL)
+		return true;
+	if (lpSocketInfo->sendBuf->Send(session, frame))
+		return true;
+	if (DisconnectClient(lpSocketInfo))
+		Metrics::slowConsumerKicks++;
+	return false;
+}
+
+bool ServerManager::DisconnectClient(SocketInfo* lpSocketInfo)
+{
+	SessionHandle session = lpSocketInfo->handle;
+	if (session == INVALID_SESSION || lpSocketInfo->closing.exchange(true))
+		return false;
+
+	// the caller may be a room thread, so the close runs on the loop owning the connection:
+	// a zero-byte receive completion takes the usual disconnection path
+	lpSocketInfo->AddRef();
+	if (!lpSocketInfo->compPort->Post(0, lpSocketInfo->CompletionKey(),
+		reinterpret_cast<IoRequest*>(lpSocketInfo->recvBuf)))
+		lpSocketInfo->Release();
+	return true;
 }
 
 bool ServerManager::RecvPacket(SocketInfo* lpSocketInfo)
 {
-	return lpSocketInfo->recvBuf->Receive(lpSocketInfo->socket);
+	return lpSocketInfo->recvBuf->Receive();
 }
 
 bool ServerManager::HandleSendEvent(SocketInfo * lpSocketInfo, DWORD dwBytesTransferred)
 {
-	lpSocketInfo->sendBuf->HandleSend(lpSocketInfo->socket);
-	return true;
+	return lpSocketInfo->sendBuf->HandleSend();
 }
 
 bool ServerManager::HandleRecvEvent(SocketInfo* lpSocketInfo, DWORD dwBytesTransferred)
 {
-	EnterCriticalSection(&csForClientLocationTable);
-	Client* pClient = clientLocationTable[lpSocketInfo];
-	LeaveCriticalSection(&csForClientLocationTable);
+	int roomId = GetClientLocation(lpSocketInfo->handle);
+	lpSocketInfo->lastReceived = GetTickCount64();
 
+	// held while relaying so the room cannot be closed and freed under the loop
 	EnterCriticalSection(&csForServerRoomList);
-	if (pClient != nullptr && serverRoomList[pClient->clntid()]->HasGameStarted())
+	auto location = serverRoomList.find(roomId);
+	Room* pRoom = (location != serverRoomList.end()) ? location->second : nullptr;
+	if (pRoom != nullptr && pRoom->HasGameStarted())
 	{
-		char* rawBuf = new char[dwBytesTransferred];
-		lpSocketInfo->recvBuf->CopyBufferToRaw(rawBuf, dwBytesTransferred);
-		//printf("BoradCast!\n");
-		serverRoomList[pClient->clntid()]->InsertDataIntoBroadcastQueue(
-			dwBytesTransferred, reinterpret_cast<ULONG_PTR>(rawBuf));
+		// split into frames: player state is simulated by the room, anything else relayed as is
+		bool rtn = lpSocketInfo->recvBuf->HandleReceive(dwBytesTransferred, true);
+		while (lpSocketInfo->recvBuf->HasMessage()) {
+			MessageContext* msgContext = lpSocketInfo->recvBuf->NextMessage();
+			SendFrame* frame = msgContext->frame;
+			if (frame->type == MessageType::PONG)
+			{	// heartbeat replies stop here
+				HandlePong(lpSocketInfo);
+				frame->Release();
+				MessageContext::DeallocateMessageContext(msgContext);
+				continue;
+			}
+			if (frame->type == MessageType::SNAPSHOT_ACK)
+			{	// the acknowledged tick becomes the base of this client's deltas
+				uint32_t tick;
+				if (SnapshotBuilder::ParseAck(frame->data + HEADER_SIZE, frame->length - HEADER_SIZE, tick) && tick != 0)
+					pRoom->Post(RoomCommand::ROOM_ACK, lpSocketInfo->handle, tick);
+				frame->Release();
+				MessageContext::DeallocateMessageContext(msgContext);
+				continue;
+			}
+			// player state goes into the room's simulation and out with its next tick
+			if (frame->type == MessageType::WORLD_STATE || frame->type == MessageType::WORLD_STATE_BITS
+				|| frame->type == MessageType::PLAY_STATE)
+				pRoom->Post(RoomCommand::ROOM_STATE, lpSocketInfo->handle, reinterpret_cast<ULONG_PTR>(frame));
+			else
+				pRoom->InsertDataIntoBroadcastQueue(BroadcastType::SHARED_FRAME, reinterpret_cast<ULONG_PTR>(frame));
+			MessageContext::DeallocateMessageContext(msgContext);
+		}
 		LeaveCriticalSection(&csForServerRoomList);
+		if (!rtn)
+			return false;
 	}
 	else 
 	{
 		LeaveCriticalSection(&csForServerRoomList);
 
-		lpSocketInfo->recvBuf->HandleReceive(dwBytesTransferred);
-		MessageContext* msgContext;
-		
+		if (!lpSocketInfo->recvBuf->HandleReceive(dwBytesTransferred))
+			return false;
+		bool rtn = true;
 		while (lpSocketInfo->recvBuf->HasMessage()) {
-			msgContext = lpSocketInfo->recvBuf->NextMessage();
-			bool rtn = (msgContext->header.length == 0) 
-				? HandleWithoutBody(lpSocketInfo, msgContext->header.type)
-				: HandleWithBody(lpSocketInfo, msgContext->message, msgContext->header.type);
-			if (!rtn) {
-				return false;
+			MessageContext* msgContext = lpSocketInfo->recvBuf->NextMessage();
+			// after a failure the rest of the batch is only released
+			if (rtn) {
+				rtn = (msgContext->header.length == 0)
+					? HandleWithoutBody(lpSocketInfo, msgContext->header.type)
+					: HandleWithBody(lpSocketInfo, msgContext->message, msgContext->header.type);
 			}
+			MessageContext::DeallocateMessageContext(msgContext);
+		}
+		Packet::ResetDecodeArena();
+		if (!rtn) {
+			return false;
 		}
-		delete msgContext;
 	}
 	
 	lpSocketInfo->recvBuf->called = false;
@@ -364,6 +824,8 @@ bool ServerManager::HandleWithoutBody(SocketInfo* lpSocketInfo, int& type)
 	MessageContext msgContext;
 	if (type == MessageType::REFRESH)
 	{ 
+		// rooms publish their info from the executor threads
+		EnterCriticalSection(&csForRoomList);
 		if(roomList.rooms_size() == 0) 
 		{
 			msgContext.header.type = MessageType::EMPTY_ROOMLIST;
@@ -374,73 +836,37 @@ bool ServerManager::HandleWithoutBody(SocketInfo* lpSocketInfo, int& type)
 			msgContext.message = &roomList;
 		}
 
-		if (!SendPacket(lpSocketInfo, &msgContext))
+		bool rtn = SendPacket(lpSocketInfo, &msgContext);
+		LeaveCriticalSection(&csForRoomList);
+		if (!rtn)
 			return false;
 	}
-	else if (type == MessageType::SEEK_MYPOSITION)
+	else if (type == MessageType::PONG)
 	{
-		Data response;
-		(*response.mutable_datamap())["contentType"] = "CLIENT_POSITION";
-		(*response.mutable_datamap())["position"] = std::to_string(clientLocationTable[lpSocketInfo]->position());
-		msgContext.header.type = MessageType::DATA;
-		msgContext.message = &response;
-
-		if (!SendPacket(lpSocketInfo, &msgContext))
-			return false;
+		HandlePong(lpSocketInfo);
 	}
 	else
-	{
-		EnterCriticalSection(&csForClientLocationTable);
-		Client* messageFrom = clientLocationTable[lpSocketInfo];
-		LeaveCriticalSection(&csForClientLocationTable);
+	{	// everything else is a request to the client's room, answered by the room itself
+		int roomId = GetClientLocation(lpSocketInfo->handle);
+		if (roomId == NO_ROOM)
+			return true;
 
-		int roomId = messageFrom->clntid();
-		EnterCriticalSection(&csForServerRoomList);
-		Room* pRoom = serverRoomList[roomId];
-		RoomInfo& rInfo = (*roomList.mutable_rooms())[roomId];
 		switch (type)
 		{
+			case MessageType::SEEK_MYPOSITION:
+				PostToRoom(roomId, RoomCommand::ROOM_SEEK_POSITION, lpSocketInfo->handle);
+				break;
 			case MessageType::READY_EVENT:
-				pRoom->ProcessReadyEvent(messageFrom);
+				PostToRoom(roomId, RoomCommand::ROOM_READY, lpSocketInfo->handle);
 				break;
 			case MessageType::TEAM_CHANGE:
-			{
-				Client* newPosition = pRoom->ProcessTeamChangeEvent(messageFrom);
-				if (newPosition != nullptr)
-				{
-					EnterCriticalSection(&csForClientLocationTable);
-					clientLocationTable[lpSocketInfo] = newPosition;
-					LeaveCriticalSection(&csForClientLocationTable);
-				}
+				PostToRoom(roomId, RoomCommand::ROOM_TEAM_CHANGE, lpSocketInfo->handle);
 				break;
-			}
 			case MessageType::LEAVE_GAMEROOM:
-				std::cout << "leave gameroom called" << std::endl;
-
-				bool isClosed = pRoom->ProcessLeaveGameroomEvent(messageFrom, lpSocketInfo);
-				EnterCriticalSection(&csForClientLocationTable);
-				clientLocationTable[lpSocketInfo] = nullptr;
-				LeaveCriticalSection(&csForClientLocationTable);
-
-				if (isClosed)
-				{ //방이 사라진 경우, 리소스 정리해야함
-					serverRoomList.erase(roomId); // Room* 서버 방 리스트에서 제거 (해제 아님)
-					EnterCriticalSection(&csForRoomTable);
-					roomTable.erase(rInfo.name()); // Map<방이름, roomId> 에서 제거
-					LeaveCriticalSection(&csForRoomTable);
-					EnterCriticalSection(&csForRoomList);
-					(*roomList.mutable_rooms()).erase(roomId); // RoomInfo* 전송용 리스트에서 제거 (자동으로 해제됨)
-					LeaveCriticalSection(&csForRoomList);
-					//JS TEST
-					pRoom->InsertDataIntoBroadcastQueue(0, KILL_THREAD);
-					delete pRoom; // Room* 해제 여기서
-					LeaveCriticalSection(&csForServerRoomList);
-					return true;
-				}
+				SetClientLocation(lpSocketInfo->handle, NO_ROOM);
+				PostToRoom(roomId, RoomCommand::ROOM_LEAVE, lpSocketInfo->handle);
 				break;
 		}
-		pRoom->InsertDataIntoBroadcastQueue(BroadcastType::NON_DISPOSABLE, reinterpret_cast<ULONG_PTR>(&rInfo));
-		LeaveCriticalSection(&csForServerRoomList);
 	}
 
 	return true;
@@ -458,33 +884,48 @@ bool ServerManager::HandleWithBody(SocketInfo* lpSocketInfo, MessageLite* messag
 		{
 			string roomName = dataMap["roomName"];
 			string userName = dataMap["userName"];
-			int limits = stoi(dataMap["limits"]);
+			int limits = atoi(dataMap["limits"].c_str());	// 0, and so rejected, if it is not a number
 
 			std::cout << "RoomName: " << roomName << ", " << "Limits: " << limits << "Username: " << userName << std::endl;
-			EnterCriticalSection(&csForRoomTable);
-			if (roomTable.find(roomName) != roomTable.end()) 
-			{   // Room Name duplicated!!
-				LeaveCriticalSection(&csForRoomTable);
+			if (limits < 1 || limits > MAX_ROOM_SLOTS)
+			{	// each player is a slot, red team 0..7 and blue team 8..15
 				Data response;
 				(*response.mutable_datamap())["contentType"] = "REJECT_CREATE_ROOM";
 				(*response.mutable_datamap())["errorCode"] = "400";
-				(*response.mutable_datamap())["errorMessage"] = "Duplicated Room Name";
+				(*response.mutable_datamap())["errorMessage"] = "Limits must be between 1 and " + std::to_string(MAX_ROOM_SLOTS);
 				msgContext.header.type = MessageType::DATA;
 				msgContext.message = &response;
 
 				if (!SendPacket(lpSocketInfo, &msgContext))
 					return false;
 			}
-			else 
-			{  // 정상적으로 생성이 가능한 상황
-				RoomInfo* newRoomInfo = new RoomInfo();
-				InitRoom(newRoomInfo, lpSocketInfo, roomName, limits, userName);
-				LeaveCriticalSection(&csForRoomTable);
-				msgContext.header.type = MessageType::ROOM;
-				msgContext.message = newRoomInfo;
+			else
+			{
+				EnterCriticalSection(&csForRoomTable);
+				if (roomTable.find(roomName) != roomTable.end()) 
+				{   // Room Name duplicated!!
+					LeaveCriticalSection(&csForRoomTable);
+					Data response;
+					(*response.mutable_datamap())["contentType"] = "REJECT_CREATE_ROOM";
+					(*response.mutable_datamap())["errorCode"] = "400";
+					(*response.mutable_datamap())["errorMessage"] = "Duplicated Room Name";
+					msgContext.header.type = MessageType::DATA;
+					msgContext.message = &response;
+
+					if (!SendPacket(lpSocketInfo, &msgContext))
+						return false;
+				}
+				else 
+				{  // 정상적으로 생성이 가능한 상황
+					RoomInfo newRoomInfo;
+					InitRoom(&newRoomInfo, lpSocketInfo, roomName, limits, userName);
+					LeaveCriticalSection(&csForRoomTable);
+					msgContext.header.type = MessageType::ROOM;
+					msgContext.message = &newRoomInfo;
 				
-				if (!SendPacket(lpSocketInfo, &msgContext))
-					return false;
+					if (!SendPacket(lpSocketInfo, &msgContext))
+						return false;
+				}
 			}
 			
 		}
@@ -492,13 +933,14 @@ bool ServerManager::HandleWithBody(SocketInfo* lpSocketInfo, MessageLite* messag
 		{ // 입장하려는 시점에 방이 존재하지 않는 경우
 			string roomName = dataMap["roomName"];
 			EnterCriticalSection(&csForRoomTable);
-			int roomIdToEnter = roomTable[roomName];
+			auto found = roomTable.find(roomName);
+			int roomIdToEnter = (found != roomTable.end()) ? found->second : NO_ROOM;
 			LeaveCriticalSection(&csForRoomTable);
 
-			EnterCriticalSection(&csForRoomList);
-			if (roomList.rooms().find(roomIdToEnter) == roomList.rooms().end()) 
+			// started and full rooms are turned away by the room itself
+			if (roomIdToEnter == NO_ROOM ||
+				!PostToRoom(roomIdToEnter, RoomCommand::ROOM_ENTER, lpSocketInfo->handle, 0, dataMap["userName"]))
 			{
-				LeaveCriticalSection(&csForRoomList);
 				Data response;
 				(*response.mutable_datamap())["contentType"] = "REJECT_ENTER_ROOM";
 				(*response.mutable_datamap())["errorCode"] = "401";
@@ -509,112 +951,26 @@ bool ServerManager::HandleWithBody(SocketInfo* lpSocketInfo, MessageLite* messag
 				if (!SendPacket(lpSocketInfo, &msgContext))
 					return false;
 			}
-			else 
-			{ //입장하고자 하는 방이 존재하는 상황.
-				EnterCriticalSection(&csForServerRoomList);
-				Room* pRoom = serverRoomList[roomIdToEnter];
-				LeaveCriticalSection(&csForServerRoomList);
-				RoomInfo& roomInfo = (*roomList.mutable_rooms())[roomIdToEnter];
-				
-				if (pRoom->HasGameStarted())
-				{ //게임이 시작했을 때. 인게임에도 접속이 가능하게 하려면 아래 else if하고 순서를 바꾸는게 좋을듯.
-					LeaveCriticalSection(&csForRoomList);
-					Data response;
-					(*response.mutable_datamap())["contentType"] = "REJECT_ENTER_ROOM";
-					(*response.mutable_datamap())["errorCode"] = "401";
-					(*response.mutable_datamap())["errorMessage"] = "The game has already started!";
-					msgContext.header.type = MessageType::DATA;
-					msgContext.message = &response;
-
-					if (!SendPacket(lpSocketInfo, &msgContext))
-						return false;
-				}
-				else if (roomInfo.current() == roomInfo.limit())
-				{ // 인원수 꽉찬경우.
-					LeaveCriticalSection(&csForRoomList);
-					Data response;
-					(*response.mutable_datamap())["contentType"] = "REJECT_ENTER_ROOM";
-					(*response.mutable_datamap())["errorCode"] = "401";
-					(*response.mutable_datamap())["errorMessage"] = "The room is already full!";
-					msgContext.header.type = MessageType::DATA;
-					msgContext.message = &response;
-
-					if (!SendPacket(lpSocketInfo, &msgContext))
-						return false;
-				}
-				else
-				{ // 방 입장 처리
-					Client* clnt;
-					string userName = dataMap["userName"];
-
-					if (roomInfo.redteam_size() > roomInfo.blueteam_size()) {
-						clnt = roomInfo.add_blueteam();
-						clnt->set_position(roomInfo.blueteam_size() + 7);
-					}
-					else {
-						clnt = roomInfo.add_redteam();
-						clnt->set_position(roomInfo.redteam_size() - 1);
-					}
-					clnt->set_clntid(roomInfo.roomid());
-					clnt->set_name(userName);
-					clnt->set_ready(false);
-					clientLocationTable[lpSocketInfo] = clnt;
-					roomInfo.set_current(roomInfo.current() + 1);
-
-					EnterCriticalSection(&csForServerRoomList);
-					Room* room = serverRoomList[roomIdToEnter];
-					room->AddClientInfo(lpSocketInfo, userName);
-					room->InsertDataIntoBroadcastQueue(BroadcastType::NON_DISPOSABLE,
-						reinterpret_cast<ULONG_PTR>(&roomInfo));
-					LeaveCriticalSection(&csForRoomList);
-					LeaveCriticalSection(&csForServerRoomList);
-				}
-			}
 		}
 		else if (contentType == "CHAT_MESSAGE") 
 		{
 			int roomId = stoi(dataMap["roomId"]);
-			EnterCriticalSection(&csForServerRoomList);
-			Room* room = serverRoomList[roomId];
-			LeaveCriticalSection(&csForServerRoomList);
-			room->InsertDataIntoBroadcastQueue(BroadcastType::DISPOSABLE, reinterpret_cast<ULONG_PTR>(message));
+			// the message belongs to this worker's decode arena, so the room gets it serialized
+			SendFrame* frame = SendFrame::Create(-1, message);
+			if (!PostToRoom(roomId, BroadcastType::SHARED_FRAME, INVALID_SESSION, reinterpret_cast<ULONG_PTR>(frame)))
+				frame->Release();
 			return true;
 		}
 		else if (contentType == "START_GAME") 
 		{
-			std::cout << "start game called" << std::endl;
 			int roomId = stoi(dataMap["roomId"]);
-
-			//WaitForSingleObject(hMutexObj, INFINITE);
-			EnterCriticalSection(&csForServerRoomList);
-			Room*& _room = serverRoomList[roomId];
-			string errorMessage;
-			if (_room->CanStart(errorMessage))
-			{
-				_room->SetGameStartFlag(true);
-				int* type = new int(START_GAME);
-				_room->InsertDataIntoBroadcastQueue(BroadcastType::TYPEWITHOUTBODY, reinterpret_cast<ULONG_PTR>(type));
-				LeaveCriticalSection(&csForServerRoomList);
-			}
-			else
-			{
-				LeaveCriticalSection(&csForServerRoomList);
-				Data response;
-				(*response.mutable_datamap())["contentType"] = "REJECT_START_GAME";
-				(*response.mutable_datamap())["errorCode"] = "402";
-				(*response.mutable_datamap())["errorMessage"] = errorMessage;
-				msgContext.header.type = MessageType::DATA;
-				msgContext.message = &response;
-
-				if (!SendPacket(lpSocketInfo, &msgContext))
-					return false;
-			}
-			//ReleaseMutex(hMutexObj);
+			PostToRoom(roomId, RoomCommand::ROOM_START_GAME, lpSocketInfo->handle);
 		}
 
-		delete message;
 		return true;
 	}
+
+	return true;
 }
 
 void ServerManager::InitRoom(RoomInfo* pRoomInfo, SocketInfo* lpSocketInfo, string& roomName, int& limits, string& userName)
@@ -632,20 +988,16 @@ void ServerManager::InitRoom(RoomInfo* pRoomInfo, SocketInfo* lpSocketInfo, stri
 	client->set_position(0);
 	client->set_ready(false);
 
-	EnterCriticalSection(&csForClientLocationTable);
-	clientLocationTable[lpSocketInfo] = client;
-	LeaveCriticalSection(&csForClientLocationTable);
+	SetClientLocation(lpSocketInfo->handle, roomIdStatus);
 
 	roomTable.insert(std::make_pair(roomName, roomIdStatus));
 
 	EnterCriticalSection(&csForRoomList);
 	(*roomList.mutable_rooms())[roomIdStatus] = *pRoomInfo;
-	Room* room = new Room(&((*roomList.mutable_rooms())[roomIdStatus]));
-	room->InitCompletionPort();
-	room->CreateThreadPool();
 	LeaveCriticalSection(&csForRoomList);
 
-	room->AddClientInfo(lpSocketInfo, userName);
+	// the room keeps its own copy, roomList only shows what it last published
+	Room* room = new Room(*pRoomInfo, lpSocketInfo->handle, &roomExecutor);
 
 	EnterCriticalSection(&csForServerRoomList);
 	serverRoomList[roomIdStatus++] = room;
@@ -653,7 +1005,7 @@ void ServerManager::InitRoom(RoomInfo* pRoomInfo, SocketInfo* lpSocketInfo, stri
 }
 
 void ServerManager::SendInitData(SocketInfo* lpSocketInfo) {
-	static int indicator = 1;
+	static std::atomic<int> indicator(1);
 	MessageContext msgContext;
 
 	// Serialize Room List;
@@ -666,14 +1018,13 @@ void ServerManager::SendInitData(SocketInfo* lpSocketInfo) {
 	//indicator에도 동기화가 필요하지만 서버에서 유저네임을 alloc하는 방법을 확정한게 아니니 일단 놔둠
 	Data data;
 	(*data.mutable_datamap())["contentType"] = "ASSIGN_USERNAME";
-	(*data.mutable_datamap())["userName"] = "TempUser" + std::to_string(indicator);
-	indicator++;
+	(*data.mutable_datamap())["userName"] = "TempUser" + std::to_string(indicator++);
 	msgContext.header.type = MessageType::DATA;
 	msgContext.message = &data;
 	SendPacket(lpSocketInfo, &msgContext);
 
 	EnterCriticalSection(&csForClientLocationTable);
-	clientLocationTable.insert(std::make_pair(lpSocketInfo, nullptr));
+	clientLocationTable.insert(std::make_pair(lpSocketInfo->handle.load(), NO_ROOM));
 	LeaveCriticalSection(&csForClientLocationTable);
 
 	// 초기 Recv Call
@@ -681,39 +1032,81 @@ void ServerManager::SendInitData(SocketInfo* lpSocketInfo) {
 }
 
 void ServerManager::ProcessDisconnection(SocketInfo * lpSocketInfo)
-{   //상당히 많은 부분이 LEAVE_GAMEROOM 부분과 겹치기 때문에 중복을 어케 처리할 필요가 있을듯
+{
 	EnterCriticalSection(&csForClientLocationTable);
-	Client* clientInstance = clientLocationTable[lpSocketInfo];
-	if (clientInstance != nullptr)
-	{
-		int roomId = clientInstance->clntid();
-		EnterCriticalSection(&csForServerRoomList);
-		Room* currentLocation = serverRoomList[roomId];
+	auto location = clientLocationTable.find(lpSocketInfo->handle);
+	int roomId = (location != clientLocationTable.end()) ? location->second : NO_ROOM;
+	if (location != clientLocationTable.end())
+		clientLocationTable.erase(location);
+	LeaveCriticalSection(&csForClientLocationTable);
 
-		RoomInfo& roomInfo = (*roomList.mutable_rooms())[roomId];
-		bool isClosed = currentLocation->ProcessLeaveGameroomEvent(clientInstance, lpSocketInfo);
-	
-		if (isClosed)
-		{ //방이 사라진 경우, 리소스 정리해야함
-			serverRoomList.erase(roomId); // Room* 서버 방 리스트에서 제거 (해제 아님)
-			EnterCriticalSection(&csForRoomTable);
-			roomTable.erase(roomInfo.name()); // Map<방이름, roomId> 에서 제거
-			LeaveCriticalSection(&csForRoomTable);
-			EnterCriticalSection(&csForRoomList);
-			(*roomList.mutable_rooms()).erase(roomId); // RoomInfo* 전송용 리스트에서 제거 (자동으로 해제됨)
-			LeaveCriticalSection(&csForRoomList);
-			//JS TEST
-			currentLocation->InsertDataIntoBroadcastQueue(0, KILL_THREAD);
-			delete currentLocation; // Room* 해제 여기서
-		}
-		else
-		{
-			currentLocation->InsertDataIntoBroadcastQueue(
-				BroadcastType::NON_DISPOSABLE, reinterpret_cast<ULONG_PTR>(&roomInfo));
-		}
+	// the room treats it like LEAVE_GAMEROOM
+	if (roomId != NO_ROOM)
+		PostToRoom(roomId, RoomCommand::ROOM_LEAVE, lpSocketInfo->handle);
+}
 
-		LeaveCriticalSection(&csForServerRoomList);
+int ServerManager::GetClientLocation(SessionHandle session)
+{
+	EnterCriticalSection(&csForClientLocationTable);
+	auto location = clientLocationTable.find(session);
+	int roomId = (location != clientLocationTable.end()) ? location->second : NO_ROOM;
+	LeaveCriticalSection(&csForClientLocationTable);
+	return roomId;
+}
+
+void ServerManager::SetClientLocation(SessionHandle session, int roomId)
+{
+	EnterCriticalSection(&csForClientLocationTable);
+	auto location = clientLocationTable.find(session);
+	if (location != clientLocationTable.end())
+		location->second = roomId;
+	LeaveCriticalSection(&csForClientLocationTable);
+}
+
+bool ServerManager::ClaimClientLocation(SessionHandle session, int roomId)
+{
+	bool claimed = false;
+	EnterCriticalSection(&csForClientLocationTable);
+	auto location = clientLocationTable.find(session);
+	if (location != clientLocationTable.end() && location->second == NO_ROOM)
+	{
+		location->second = roomId;
+		claimed = true;
 	}
-	clientLocationTable.erase(lpSocketInfo);
 	LeaveCriticalSection(&csForClientLocationTable);
+	return claimed;
+}
+
+bool ServerManager::PostToRoom(int roomId, DWORD type, SessionHandle session, ULONG_PTR message, const string& userName)
+{
+	// posting under the lock keeps CloseRoom from arming the cleanup before the task is counted
+	EnterCriticalSection(&csForServerRoomList);
+	auto found = serverRoomList.find(roomId);
+	bool posted = found != serverRoomList.end();
+	if (posted)
+		found->second->Post(type, session, message, userName);
+	LeaveCriticalSection(&csForServerRoomList);
+	return posted;
+}
+
+void ServerManager::PublishRoomInfo(const RoomInfo& roomInfo)
+{
+	EnterCriticalSection(&csForRoomList);
+	(*roomList.mutable_rooms())[roomInfo.roomid()] = roomInfo;
+	LeaveCriticalSection(&csForRoomList);
+}
+
+void ServerManager::CloseRoom(Room* pRoom, const RoomInfo& roomInfo)
+{	// the tables are released one at a time, workers take them in other orders
+	EnterCriticalSection(&csForServerRoomList);
+	serverRoomList.erase(roomInfo.roomid()); // Room* 서버 방 리스트에서 제거 (해제 아님)
+	LeaveCriticalSection(&csForServerRoomList);
+	EnterCriticalSection(&csForRoomTable);
+	roomTable.erase(roomInfo.name()); // Map<방이름, roomId> 에서 제거
+	LeaveCriticalSection(&csForRoomTable);
+	EnterCriticalSection(&csForRoomList);
+	(*roomList.mutable_rooms()).erase(roomInfo.roomid()); // RoomInfo* 전송용 리스트에서 제거 (자동으로 해제됨)
+	LeaveCriticalSection(&csForRoomList);
+
+	ScheduleRoomCleanup(pRoom);
 }
@@ -1,23 +1,90 @@
 #pragma once
+#ifdef _WIN32
 #pragma comment(lib, "ws2_32.lib")
+#endif
 
-#include <WinSock2.h>
-#include <Windows.h>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+#include <atomic>
 #include "def.h"
+#include "ServerConfig.h"
+#include "CompletionPort.h"
+#include "TimerWheel.h"
 #include "SocketInfo.h"
 #include "protobuf/room.pb.h"
 #include "protobuf/data.pb.h"
 #include "Room.h"
+#include "RoomExecutor.h"
+
+class ServerManager;
+struct EventLoop;
+
+// One thread serving an event loop. The times are in microseconds since the last sample.
+struct Worker {
+	EventLoop* loop;
+	int processor;							// pinned to, -1 if not
+	std::atomic<bool> running;
+	std::atomic<ULONGLONG> idleMicros;		// waiting for completions
+	std::atomic<ULONGLONG> runMicros;		// handling them, on a processor
+	std::atomic<ULONGLONG> blockedMicros;	// handling them, but off processor: locks, I/O, preemption
+
+	Worker() : loop(nullptr), processor(-1), running(false), idleMicros(0), runMicros(0), blockedMicros(0) {}
+};
+
+// A completion port with its own listener and worker threads. Without sharding there is a
+// single loop shared by the whole pool; with sharding each loop has its own workers and keeps
+// every connection it accepted, so a SocketInfo never migrates between loops.
+struct EventLoop {
+	int id;
+	ServerManager* owner;
+	CompletionPort compPort;
+	SOCKET servSock;
+	AcceptRequest* acceptRequests;
+	// timers of the loop's connections, advanced by its workers between completions
+	TimerWheel timers;
+
+	// workers started and not yet told to exit; only the starting thread and MonitorServer
+	// change the pool, so workers itself needs no lock
+	std::atomic<int> numOfThreads;
+	std::vector<Worker*> workers;
+	std::vector<int> processors;	// processors the workers are pinned to, empty if not pinned
+
+	// a probe posted once a second measures how long completions wait for a worker
+	std::atomic<ULONGLONG> probePostedAt;
+	std::atomic<ULONGLONG> queueDelayMicros;
+
+	EventLoop() : id(0), owner(nullptr), servSock(INVALID_SOCKET), acceptRequests(nullptr), numOfThreads(0),
+		probePostedAt(0), queueDelayMicros(0) {}
+};
 
 class ServerManager {
 public:
-	void Start(int port=PORT);
+	void Start(const ServerConfig& startConfig = ServerConfig());
 	void Stop();
 
 	bool SendPacket(SocketInfo* lpSocketInfo, const MessageContext* msgContext);
+	// session is the handle the caller resolved, so a send never reaches a later session
+	// reusing the slot; a closed session is skipped
+	bool SendPacket(SessionHandle session, const MessageContext* msgContext);
+	bool SendSharedFrame(SessionHandle session, SendFrame* frame);
+	// Queues a close of the connection on its own event loop, from any thread.
+	// Returns false if a close was already queued.
+	bool DisconnectClient(SocketInfo* lpSocketInfo);
 	bool RecvPacket(SocketInfo* lpSocketInfo);
+	int DequeueBatchSize() const { return config.dequeueBatch; }
+	int TickRate() const { return config.tickRate; }
+	int InterestRadius() const { return config.interestRadius; }
+	int SnapshotBudget() const { return config.snapshotBudget; }
+
+	// Lobby bookkeeping, called by a room from its own executor turn.
+	// ClaimClientLocation fails unless the client is still connected and in the lobby.
+	bool ClaimClientLocation(SessionHandle session, int roomId);
+	void PublishRoomInfo(const RoomInfo& roomInfo);
+	void CloseRoom(Room* pRoom, const RoomInfo& roomInfo);
+	// Room timers run on the first event loop's wheel, whichever thread arms them.
+	void ScheduleRoomTimer(Timer* timer, DWORD delayMs);
+	void CancelRoomTimer(Timer* timer);
 
 	static ServerManager& getInstance() {
 		if (self == nullptr) {
@@ -29,17 +96,33 @@ public:
 private:
 	static ServerManager* self;
 	static unsigned __stdcall ThreadMain(void* pVoid);
+	static void OnHeartbeat(TimerWheel* wheel, Timer* timer);
+	static void OnRoomCleanup(TimerWheel* wheel, Timer* timer);
 
 private:
 	ServerManager();
 	~ServerManager();
 
-	void InitSocket(int port, int prime = 2, int sub = 2);
-	void InitCompletionPort(int maxNumberOfThreads = 0);
-	void AcceptClient();
+	void InitNetwork(int prime = 2, int sub = 2);
+	SOCKET InitSocket(int port, int backlog, bool reusePort);
+	void InitCompletionPort(EventLoop* lpEventLoop, int maxNumberOfThreads = 0);
+	bool InitEventLoops();
+	void PostAccept(EventLoop* lpEventLoop, AcceptRequest* lpAcceptRequest);
+	void HandleAcceptEvent(EventLoop* lpEventLoop, AcceptRequest* lpAcceptRequest, bool success);
+	void AcceptClient(EventLoop* lpEventLoop, SOCKET clntSock, const SOCKADDR_IN& clntAdr);
+	void MonitorServer();
 	void CloseClient(SocketInfo* lpSocketInfo, bool graceful = false);
-	void CreateThreadPool(int numOfThreads = 0);
+	void ArmHeartbeat(SocketInfo* lpSocketInfo);
+	void HandlePong(SocketInfo* lpSocketInfo);
+	void ScheduleRoomCleanup(Room* pRoom);
+	void CreateThreadPool(EventLoop* lpEventLoop, int numOfThreads);
+	void AssignProcessors(EventLoop* lpEventLoop, int numOfLoops);
+	bool StartWorker(EventLoop* lpEventLoop);
+	void RetireWorker(EventLoop* lpEventLoop);
+	void SampleWorkers(EventLoop* lpEventLoop);
 	void ShutdownThreads();
+	void HandleCompletion(EventLoop* lpEventLoop, const CompletionEntry& entry);
+	void HandleSessionCompletion(SocketInfo* lpSocketInfo, const CompletionEntry& entry);
 
 	bool HandleSendEvent(SocketInfo* lpSocketInfo, DWORD dwBytesTransferred);
 	bool HandleRecvEvent(SocketInfo* lpSocketInfo, DWORD dwBytesTransferred);
@@ -50,23 +133,34 @@ private:
 	void InitRoom(RoomInfo* pRoom, SocketInfo* lpSocketInfo, string& roomName, int& limits, string& userName);
 	void SendInitData(SocketInfo*);
 	void ProcessDisconnection(SocketInfo* lpSocketInfo);
+	int GetClientLocation(SessionHandle session);
+	void SetClientLocation(SessionHandle session, int roomId);
+	// Queues a task on the room if it is still open. Returns false if it is not.
+	bool PostToRoom(int roomId, DWORD type, SessionHandle session, ULONG_PTR message = 0, const string& userName = string());
 
 private:
+#ifdef _WIN32
 	WSAData wsaData;
-	HANDLE hCompPort;
-	SOCKET servSock;
+#endif
+	ServerConfig config;
+	std::vector<EventLoop*> eventLoops;
+	// without SO_REUSEPORT only the first loop listens and hands connections out in turn
+	bool listenPerLoop;
+	std::atomic<unsigned> nextEventLoop;
 
-	int threadPoolSize;
-	HANDLE hMutexObj;
+	// accepts that could not be re-posted; MonitorServer retries them
+	std::vector<std::pair<EventLoop*, AcceptRequest*>> idleAccepts;
 
 	int roomIdStatus;
 	RoomList roomList;
+	// every room's broadcasts run here instead of on a thread of its own
+	RoomExecutor roomExecutor;
 	// <RoomId, RoomContext> 
 	std::unordered_map<int, Room*> serverRoomList;
 	// <RoomName, RoomId> 
 	std::unordered_map<string, int> roomTable;
-	// <SocketInfo, Client>
-	std::unordered_map<SocketInfo*, Client*> clientLocationTable;
+	// <Session, RoomId>, NO_ROOM while the client is in the lobby
+	std::unordered_map<SessionHandle, int> clientLocationTable;
 
 	std::unordered_map<int, int> checkCall;
   
@@ -74,4 +168,6 @@ private:
 	CRITICAL_SECTION csForServerRoomList;
 	CRITICAL_SECTION csForRoomTable;
 	CRITICAL_SECTION csForClientLocationTable;
+	CRITICAL_SECTION csForCloseClient;
+	CRITICAL_SECTION csForIdleAccepts;
 };
@@ -0,0 +1,433 @@
+#include <cassert>
+#include <cmath>
+#include <google/protobuf/wire_format_lite.h>
+#include "Snapshot.h"
+#include "Quantize.h"
+#include "Packet.h"
+#include "def.h"
+
+using google::protobuf::internal::WireFormatLite;
+
+// RoomSnapshot and StateDelta are written field by field rather than built as messages: each
+// state is then serialized once and its bytes copied, where a RoomSnapshot would deep-copy every
+// WorldState into itself first.
+#define SNAPSHOT_ROOM_ID state::RoomSnapshot::kRoomIdFieldNumber
+#define SNAPSHOT_TICK state::RoomSnapshot::kTickFieldNumber
+#define SNAPSHOT_STATES state::RoomSnapshot::kStatesFieldNumber
+#define SNAPSHOT_BASE_TICK state::RoomSnapshot::kBaseTickFieldNumber
+#define SNAPSHOT_DELTAS state::RoomSnapshot::kDeltasFieldNumber
+#define SNAPSHOT_VISIBLE state::RoomSnapshot::kVisibleFieldNumber
+#define DELTA_ENTITY state::StateDelta::kEntityFieldNumber
+#define DELTA_CHANGED state::StateDelta::kChangedFieldNumber
+#define DELTA_STATE state::StateDelta::kStateFieldNumber
+#define STATE_COMPACT_TRANSFORM state::WorldState::kCompactTransformFieldNumber
+
+bool SnapshotBuilder::compactTransform = false;
+float SnapshotBuilder::worldBound = 1024.0f;
+
+void SnapshotBuilder::SetTransformEncoding(bool compact, float bound)
+{
+	compactTransform = compact;
+	worldBound = bound;
+}
+
+void SnapshotBuilder::SerializeState(state::WorldState& state)
+{
+	if (!compactTransform || !state.has_transform())
+	{
+		state.SerializeToString(&scratch);
+		return;
+	}
+
+	// the transform is taken out for the serialization and put back, and CompactTransform is
+	// appended after the other fields; parsers take fields in any order
+	state::TransformProto* transform = state.release_transform();
+	state.SerializeToString(&scratch);
+	state.set_allocated_transform(transform);
+
+	PackTransform(*transform, worldBound, &compact);
+	uint32 compactSize = (uint32)compact.ByteSizeLong();
+	StringOutputStream sos(&scratch);
+	CodedOutputStream cos(&sos);
+	cos.WriteTag(WireFormatLite::MakeTag(STATE_COMPACT_TRANSFORM, WireFormatLite::WIRETYPE_LENGTH_DELIMITED));
+	cos.WriteVarint32(compactSize);
+	compact.SerializeWithCachedSizes(&cos);
+}
+
+void SnapshotBuilder::Begin(int roomId, uint32_t tick, bool packed, uint32_t visible)
+{
+	BeginDelta(roomId, tick, 0, packed, visible);
+}
+
+void SnapshotBuilder::BeginDelta(int roomId, uint32_t tick, uint32_t baseTick, bool packed, uint32_t visible)
+{
+	this->packed = packed;
+	stateCount = 0;
+	if (packed)
+	{
+		bits.Clear();
+		bits.WriteSignedVarint(roomId);
+		bits.WriteBits(tick, 32);
+		bits.WriteBool(baseTick != 0);
+		if (baseTick != 0)
+			bits.WriteBits(baseTick, 32);
+		bits.WriteBool(visible != ALL_VISIBLE);
+		if (visible != ALL_VISIBLE)
+			bits.WriteBits(visible, MAX_ROOM_SLOTS);
+		return;
+	}
+
+	body.clear();
+	StringOutputStream sos(&body);
+	CodedOutputStream cos(&sos);
+	cos.WriteTag(WireFormatLite::MakeTag(SNAPSHOT_ROOM_ID, WireFormatLite::WIRETYPE_VARINT));
+	cos.WriteVarint32SignExtended(roomId);
+	cos.WriteTag(WireFormatLite::MakeTag(SNAPSHOT_TICK, WireFormatLite::WIRETYPE_VARINT));
+	cos.WriteVarint32(tick);
+	if (baseTick != 0)
+	{
+		cos.WriteTag(WireFormatLite::MakeTag(SNAPSHOT_BASE_TICK, WireFormatLite::WIRETYPE_VARINT));
+		cos.WriteVarint32(baseTick);
+	}
+	if (visible != ALL_VISIBLE)
+	{
+		cos.WriteTag(WireFormatLite::MakeTag(SNAPSHOT_VISIBLE, WireFormatLite::WIRETYPE_VARINT));
+		cos.WriteVarint32(visible);
+	}
+}
+
+void SnapshotBuilder::AddState(int entity, state::WorldState& state)
+{
+	if (packed)
+	{
+		bits.WriteBool(true);
+		bits.WriteRanged(entity, 0, PACKED_MAX_ENTITY);
+		WritePacked(bits, PresentFields(state), state);
+		++stateCount;
+		return;
+	}
+
+	// the room keeps WorldState.slot set to the player's position
+	assert(state.slot() == entity);
+	SerializeState(state);
+
+	StringOutputStream sos(&body);
+	CodedOutputStream cos(&sos);
+	cos.WriteTag(WireFormatLite::MakeTag(SNAPSHOT_STATES, WireFormatLite::WIRETYPE_LENGTH_DELIMITED));
+	cos.WriteVarint32((uint32)scratch.size());
+	cos.WriteRaw(scratch.data(), (int)scratch.size());
+	++stateCount;
+}
+
+void SnapshotBuilder::AddDelta(int entity, uint32_t changed, state::WorldState& changedFields)
+{
+	if (packed)
+	{
+		bits.WriteBool(true);
+		bits.WriteRanged(entity, 0, PACKED_MAX_ENTITY);
+		WritePacked(bits, changed, changedFields);
+		++stateCount;
+		return;
+	}
+
+	SerializeState(changedFields);
+
+	// the StateDelta is small, its length is worked out instead of serializing it twice
+	size_t length = 1 + CodedOutputStream::VarintSize32SignExtended(entity)
+		+ 1 + CodedOutputStream::VarintSize32(changed);
+	if (!scratch.empty())
+		length += 1 + CodedOutputStream::VarintSize32((uint32)scratch.size()) + scratch.size();
+
+	StringOutputStream sos(&body);
+	CodedOutputStream cos(&sos);
+	cos.WriteTag(WireFormatLite::MakeTag(SNAPSHOT_DELTAS, WireFormatLite::WIRETYPE_LENGTH_DELIMITED));
+	cos.WriteVarint32((uint32)length);
+	cos.WriteTag(WireFormatLite::MakeTag(DELTA_ENTITY, WireFormatLite::WIRETYPE_VARINT));
+	cos.WriteVarint32SignExtended(entity);
+	cos.WriteTag(WireFormatLite::MakeTag(DELTA_CHANGED, WireFormatLite::WIRETYPE_VARINT));
+	cos.WriteVarint32(changed);
+	if (!scratch.empty())
+	{
+		cos.WriteTag(WireFormatLite::MakeTag(DELTA_STATE, WireFormatLite::WIRETYPE_LENGTH_DELIMITED));
+		cos.WriteVarint32((uint32)scratch.size());
+		cos.WriteRaw(scratch.data(), (int)scratch.size());
+	}
+	++stateCount;
+}
+
+size_t SnapshotBuilder::Size() const
+{	// a packed list still needs its end bit
+	return packed ? (bits.BitPosition() + 8) / 8 : body.size();
+}
+
+size_t SnapshotBuilder::Mark() const
+{
+	return packed ? bits.BitPosition() : body.size();
+}
+
+void SnapshotBuilder::Rewind(size_t mark)
+{
+	if (packed)
+		bits.Rewind(mark);
+	else
+		body.resize(mark);
+	--stateCount;
+}
+
+SendFrame* SnapshotBuilder::Finish()
+{
+	if (packed)
+	{
+		bits.WriteBool(false);
+		bits.Flush();
+		return SendFrame::Create(MessageType::ROOM_SNAPSHOT_BITS, bits.Data(), (DWORD)bits.Size());
+	}
+	return SendFrame::Create(MessageType::ROOM_SNAPSHOT, body.data(), (DWORD)body.size());
+}
+
+static bool SameVector(const state::Vector3Proto& a, const state::Vector3Proto& b)
+{
+	return a.x() == b.x() && a.y() == b.y() && a.z() == b.z();
+}
+
+static bool SameHit(const state::HitState& a, const state::HitState& b)
+{
+	return a.damage() == b.damage() && a.from() == b.from() && a.to() == b.to()
+		&& a.fromslot() == b.fromslot() && a.toslot() == b.toslot();
+}
+
+uint32_t SnapshotBuilder::Diff(const state::WorldState& base, const state::WorldState& current, state::WorldState& changedFields)
+{
+	uint32_t changed = 0;
+	changedFields.Clear();
+
+	if (base.roomid() != current.roomid())
+	{
+		changed |= FIELD_ROOM_ID;
+		changedFields.set_roomid(current.roomid());
+	}
+	if (base.clntname() != current.clntname())
+	{
+		changed |= FIELD_NAME;
+		changedFields.set_clntname(current.clntname());
+	}
+	if (!SameVector(base.transform().position(), current.transform().position()))
+	{
+		changed |= FIELD_POSITION;
+		*changedFields.mutable_transform()->mutable_position() = current.transform().position();
+	}
+	if (!SameVector(base.transform().rotation(), current.transform().rotation()))
+	{
+		changed |= FIELD_ROTATION;
+		*changedFields.mutable_transform()->mutable_rotation() = current.transform().rotation();
+	}
+	if (!SameVector(base.transform().scale(), current.transform().scale()))
+	{
+		changed |= FIELD_SCALE;
+		*changedFields.mutable_transform()->mutable_scale() = current.transform().scale();
+	}
+	if (base.fired() != current.fired())
+	{
+		changed |= FIELD_FIRED;
+		changedFields.set_fired(current.fired());
+	}
+	if (base.health() != current.health())
+	{
+		changed |= FIELD_HEALTH;
+		changedFields.set_health(current.health());
+	}
+	if (base.hit() != current.hit())
+	{
+		changed |= FIELD_HIT;
+		changedFields.set_hit(current.hit());
+	}
+	if (!SameHit(base.hitstate(), current.hitstate()))
+	{
+		changed |= FIELD_HIT_STATE;
+		// left out when the hit was cleared, so it is not read as a hit of 0 on slot 0
+		if (current.has_hitstate())
+			*changedFields.mutable_hitstate() = current.hitstate();
+	}
+	if (base.killpoint() != current.killpoint())
+	{
+		changed |= FIELD_KILL_POINT;
+		changedFields.set_killpoint(current.killpoint());
+	}
+	if (base.deathpoint() != current.deathpoint())
+	{
+		changed |= FIELD_DEATH_POINT;
+		changedFields.set_deathpoint(current.deathpoint());
+	}
+	if (base.animstate() != current.animstate())
+	{
+		changed |= FIELD_ANIM_STATE;
+		changedFields.set_animstate(current.animstate());
+	}
+	return changed;
+}
+
+bool SnapshotBuilder::ParseAck(const char* body, int size, uint32_t& tick)
+{
+	state::SnapshotAck ack;
+	if (!ack.ParseFromArray(body, size))
+		return false;
+	tick = ack.tick();
+	return true;
+}
+
+uint32_t SnapshotBuilder::PresentFields(const state::WorldState& state)
+{
+	uint32_t fields = 0;
+	if (state.roomid() != 0)
+		fields |= FIELD_ROOM_ID;
+	if (!state.clntname().empty())
+		fields |= FIELD_NAME;
+	if (state.transform().has_position())
+		fields |= FIELD_POSITION;
+	if (state.transform().has_rotation())
+		fields |= FIELD_ROTATION;
+	if (state.transform().has_scale() && !IsUnitScale(state.transform().scale()))
+		fields |= FIELD_SCALE;
+	if (state.fired())
+		fields |= FIELD_FIRED;
+	if (state.health() != 0)
+		fields |= FIELD_HEALTH;
+	if (state.hit())
+		fields |= FIELD_HIT;
+	if (state.has_hitstate())
+		fields |= FIELD_HIT_STATE;
+	if (state.killpoint() != 0)
+		fields |= FIELD_KILL_POINT;
+	if (state.deathpoint() != 0)
+		fields |= FIELD_DEATH_POINT;
+	if (state.animstate() != 0)
+		fields |= FIELD_ANIM_STATE;
+	return fields;
+}
+
+static float NormalizeAngle(float degrees)
+{
+	float angle = fmodf(degrees, 360.0f);
+	return angle < 0.0f ? angle + 360.0f : angle;
+}
+
+void SnapshotBuilder::WritePacked(BitWriter& writer, uint32_t fields, const state::WorldState& state)
+{
+	writer.WriteBits(fields, STATE_FIELD_COUNT);
+	if (fields & FIELD_ROOM_ID)
+		writer.WriteSignedVarint(state.roomid());
+	if (fields & FIELD_NAME)
+		writer.WriteString(state.clntname(), PACKED_STRING_MAX);
+	if (fields & FIELD_POSITION)
+	{
+		const state::Vector3Proto& position = state.transform().position();
+		writer.WriteQuantized(position.x(), -worldBound, worldBound, QUANT_POSITION_BITS);
+		writer.WriteQuantized(position.y(), -worldBound, worldBound, QUANT_POSITION_BITS);
+		writer.WriteQuantized(position.z(), -worldBound, worldBound, QUANT_POSITION_BITS);
+	}
+	if (fields & FIELD_ROTATION)
+	{
+		const state::Vector3Proto& rotation = state.transform().rotation();
+		writer.WriteQuantized(NormalizeAngle(rotation.x()), 0.0f, 360.0f, PACKED_ANGLE_BITS);
+		writer.WriteQuantized(NormalizeAngle(rotation.y()), 0.0f, 360.0f, PACKED_ANGLE_BITS);
+		writer.WriteQuantized(NormalizeAngle(rotation.z()), 0.0f, 360.0f, PACKED_ANGLE_BITS);
+	}
+	if (fields & FIELD_SCALE)
+	{
+		const state::Vector3Proto& scale = state.transform().scale();
+		writer.WriteFloat(scale.x());
+		writer.WriteFloat(scale.y());
+		writer.WriteFloat(scale.z());
+	}
+	if (fields & FIELD_FIRED)
+		writer.WriteBool(state.fired());
+	if (fields & FIELD_HEALTH)
+		writer.WriteSignedVarint(state.health());
+	if (fields & FIELD_HIT)
+		writer.WriteBool(state.hit());
+	if (fields & FIELD_HIT_STATE)
+	{	// a clear bit is a hit that was cleared
+		writer.WriteBool(state.has_hitstate());
+		if (state.has_hitstate())
+		{
+			writer.WriteRanged(state.hitstate().fromslot(), 0, PACKED_MAX_ENTITY);
+			writer.WriteRanged(state.hitstate().toslot(), 0, PACKED_MAX_ENTITY);
+			writer.WriteSignedVarint(state.hitstate().damage());
+		}
+	}
+	if (fields & FIELD_KILL_POINT)
+		writer.WriteSignedVarint(state.killpoint());
+	if (fields & FIELD_DEATH_POINT)
+		writer.WriteSignedVarint(state.deathpoint());
+	if (fields & FIELD_ANIM_STATE)
+		writer.WriteSignedVarint(state.animstate());
+}
+
+bool SnapshotBuilder::ReadPacked(BitReader& reader, state::WorldState& state)
+{
+	uint32_t fields = reader.ReadBits(STATE_FIELD_COUNT);
+	if (fields & FIELD_ROOM_ID)
+		state.set_roomid(reader.ReadSignedVarint());
+	if (fields & FIELD_NAME)
+		reader.ReadString(*state.mutable_clntname(), PACKED_STRING_MAX);
+	if (fields & FIELD_POSITION)
+	{
+		state::Vector3Proto* position = state.mutable_transform()->mutable_position();
+		position->set_x(reader.ReadQuantized(-worldBound, worldBound, QUANT_POSITION_BITS));
+		position->set_y(reader.ReadQuantized(-worldBound, worldBound, QUANT_POSITION_BITS));
+		position->set_z(reader.ReadQuantized(-worldBound, worldBound, QUANT_POSITION_BITS));
+	}
+	if (fields & FIELD_ROTATION)
+	{
+		state::Vector3Proto* rotation = state.mutable_transform()->mutable_rotation();
+		rotation->set_x(reader.ReadQuantized(0.0f, 360.0f, PACKED_ANGLE_BITS));
+		rotation->set_y(reader.ReadQuantized(0.0f, 360.0f, PACKED_ANGLE_BITS));
+		rotation->set_z(reader.ReadQuantized(0.0f, 360.0f, PACKED_ANGLE_BITS));
+	}
+	state::Vector3Proto* scale = state.mutable_transform()->mutable_scale();
+	if (fields & FIELD_SCALE)
+	{
+		scale->set_x(reader.ReadFloat());
+		scale->set_y(reader.ReadFloat());
+		scale->set_z(reader.ReadFloat());
+	}
+	else
+	{
+		scale->set_x(1.0f);
+		scale->set_y(1.0f);
+		scale->set_z(1.0f);
+	}
+	if (fields & FIELD_FIRED)
+		state.set_fired(reader.ReadBool());
+	if (fields & FIELD_HEALTH)
+		state.set_health(reader.ReadSignedVarint());
+	if (fields & FIELD_HIT)
+		state.set_hit(reader.ReadBool());
+	if (fields & FIELD_HIT_STATE)
+	{
+		if (reader.ReadBool())
+		{
+			state::HitState* hitState = state.mutable_hitstate();
+			hitState->set_fromslot(reader.ReadRanged(0, PACKED_MAX_ENTITY));
+			hitState->set_toslot(reader.ReadRanged(0, PACKED_MAX_ENTITY));
+			hitState->set_damage(reader.ReadSignedVarint());
+		}
+		else
+			state.clear_hitstate();
+	}
+	if (fields & FIELD_KILL_POINT)
+		state.set_killpoint(reader.ReadSignedVarint());
+	if (fields & FIELD_DEATH_POINT)
+		state.set_deathpoint(reader.ReadSignedVarint());
+	if (fields & FIELD_ANIM_STATE)
+		state.set_animstate(reader.ReadSignedVarint());
+	return !reader.Failed();
+}
+
+bool SnapshotBuilder::ParsePackedState(const char* body, int size, state::WorldState& state)
+{
+	BitReader reader(body, (size_t)size);
+	state.Clear();
+	// only the padding of the last byte may be left over
+	return ReadPacked(reader, state) && reader.BitsLeft() < 8;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include "SendFrame.h"
+#include "BitStream.h"
+#include "def.h"
+#include "protobuf/PlayState.pb.h"
+
+// ticks a client's acknowledgement may lag before it is sent full snapshots again
+#define SNAPSHOT_HISTORY 32
+
+// StateDelta.changed bits, one per WorldState field and one per transform vector
+enum StateField {
+	FIELD_ROOM_ID = 1 << 0,
+	FIELD_NAME = 1 << 1,
+	FIELD_POSITION = 1 << 2,
+	FIELD_ROTATION = 1 << 3,
+	FIELD_SCALE = 1 << 4,
+	FIELD_FIRED = 1 << 5,
+	FIELD_HEALTH = 1 << 6,
+	FIELD_HIT = 1 << 7,
+	FIELD_HIT_STATE = 1 << 8,
+	FIELD_KILL_POINT = 1 << 9,
+	FIELD_DEATH_POINT = 1 << 10,
+	FIELD_ANIM_STATE = 1 << 11,
+	ALL_FIELDS = (1 << 12) - 1
+};
+#define STATE_FIELD_COUNT 12
+
+// Begin's visible when every player is sent
+#define ALL_VISIBLE 0xFFFFFFFFu
+
+// The bit-packed codec (BitStream.h) of WORLD_STATE_BITS and ROOM_SNAPSHOT_BITS.
+// A packed state is a STATE_FIELD_COUNT-bit StateField mask followed by the fields it flags,
+// in bit order:
+//   roomId, killPoint, deathPoint, health, animState    signed varint
+//   clntName     string of up to PACKED_STRING_MAX bytes, never sent by the server
+//   position     x, y, z quantized to QUANT_POSITION_BITS over +-bound (--world-bound)
+//   rotation     x, y, z in degrees quantized to PACKED_ANGLE_BITS over 0..360
+//   scale        x, y, z as floats
+//   fired, hit   one bit
+//   hitState     a bit, clear when the hit was cleared; when set, fromSlot and toSlot as
+//                WriteRanged(0, PACKED_MAX_ENTITY), then damage as a signed varint
+// A state the client sends flags its non-default fields; a missing scale means (1, 1, 1).
+// A snapshot is roomId (signed varint), tick (32 bits), a delta bit and, when it is set,
+// baseTick (32 bits), then a bit set when RoomSnapshot.visible follows in MAX_ROOM_SLOTS bits.
+// Then, behind a set bit each, the players: Client.position as WriteRanged(0, PACKED_MAX_ENTITY)
+// and a packed state, whose mask is either the changed fields (delta) or the non-default ones
+// (full). A clear bit ends the list.
+#define PACKED_STRING_MAX 63
+#define PACKED_ANGLE_BITS 12
+#define PACKED_MAX_ENTITY (MAX_ROOM_SLOTS - 1)
+
+// Writes ROOM_SNAPSHOT frames: the RoomSnapshot message of PlayState.proto, laid out field by
+// field, so each player's state is serialized once per snapshot and only copied into the frame.
+// A full snapshot carries every player's state; a delta one only what changed since a tick the
+// recipient acknowledged.
+class SnapshotBuilder {
+public:
+	SnapshotBuilder() : stateCount(0), packed(false) {}
+
+	// packed: a ROOM_SNAPSHOT_BITS frame instead of a ROOM_SNAPSHOT one
+	// visible: RoomSnapshot.visible, ALL_VISIBLE to leave it out
+	void Begin(int roomId, uint32_t tick, bool packed = false, uint32_t visible = ALL_VISIBLE);
+	void BeginDelta(int roomId, uint32_t tick, uint32_t baseTick, bool packed = false, uint32_t visible = ALL_VISIBLE);
+	// entity: the player's slot, Client.position
+	// state is left as it was, but its transform is moved out and back while it is serialized.
+	void AddState(int entity, state::WorldState& state);
+	// changedFields holds only the fields flagged in changed.
+	void AddDelta(int entity, uint32_t changed, state::WorldState& changedFields);
+	int StateCount() const { return stateCount; }
+	// Bytes the frame body would have if finished now.
+	size_t Size() const;
+	// Mark before adding a state and Rewind to it to take that state back out.
+	size_t Mark() const;
+	void Rewind(size_t mark);
+	// One framed ROOM_SNAPSHOT holding everything added since Begin.
+	SendFrame* Finish();
+
+	// The StateField bits where current differs from base, with those fields copied into changedFields.
+	static uint32_t Diff(const state::WorldState& base, const state::WorldState& current, state::WorldState& changedFields);
+	// Reads a SNAPSHOT_ACK body. Returns false if it is malformed.
+	static bool ParseAck(const char* body, int size, uint32_t& tick);
+	// Reads a WORLD_STATE_BITS body. Returns false if it is malformed.
+	static bool ParsePackedState(const char* body, int size, state::WorldState& state);
+	// compact: states go out with CompactTransform, positions clamped to +-bound.
+	static void SetTransformEncoding(bool compact, float bound);
+
+private:
+	std::string body;	// kept between snapshots, so its buffer is reused
+	std::string scratch;
+	state::CompactTransform compact;
+	BitWriter bits;
+	int stateCount;
+	bool packed;
+
+	static bool compactTransform;
+	static float worldBound;
+
+	// state's WorldState message into scratch
+	void SerializeState(state::WorldState& state);
+	static uint32_t PresentFields(const state::WorldState& state);
+	static void WritePacked(BitWriter& writer, uint32_t fields, const state::WorldState& state);
+	static bool ReadPacked(BitReader& reader, state::WorldState& state);
+};
@@ -2,24 +2,83 @@
 #include "ErrorHandle.h"
 #include <cassert>
 
+static std::atomic<SocketInfo*> sessionChunks[MAX_SESSIONS / SESSION_CHUNK_SIZE];
+static int numOfChunks = 0;
+static SocketInfo* freeSessions = nullptr;
+static CRITICAL_SECTION csForSessions;
+
+static struct SessionSlabInit {
+	SessionSlabInit() { InitializeCriticalSection(&csForSessions); }
+} sessionSlabInit;
+
 SocketInfo::SocketInfo() 
 {
+	handle = INVALID_SESSION;
 	socket = INVALID_SOCKET;
-	recvBuf = NULL;
-	sendBuf = NULL;
+	compPort = NULL;
+	closing = false;
+	timers = NULL;
+	heartbeat.context = this;
+	lastReceived = 0;
+	pingSentAt = 0;
+	rtt = 0;
+	slotIndex = 0;
+	generation = 0;
+	nextFree = NULL;
+	refCount = 0;
+	recvBuf = IOInfo::AllocateIoInfo(this, true);
+	sendBuf = IOInfo::AllocateIoInfo(this, false);
 }
 
 SocketInfo::~SocketInfo() 
 {
+	IOInfo::DeallocateIoInfo(recvBuf);
+	IOInfo::DeallocateIoInfo(sendBuf);
 }
 
 SocketInfo* SocketInfo::AllocateSocketInfo(const SOCKET& socket)
 {
-	SocketInfo* lpSocketInfo = new SocketInfo();
-	assert(lpSocketInfo != NULL);
+	EnterCriticalSection(&csForSessions);
+	if (freeSessions == NULL)
+	{
+		if (numOfChunks == MAX_SESSIONS / SESSION_CHUNK_SIZE)
+		{
+			LeaveCriticalSection(&csForSessions);
+			return NULL;
+		}
+
+		SocketInfo* chunk = new SocketInfo[SESSION_CHUNK_SIZE];
+		for (int i = SESSION_CHUNK_SIZE - 1; i >= 0; --i)
+		{
+			chunk[i].slotIndex = numOfChunks * SESSION_CHUNK_SIZE + i;
+			chunk[i].nextFree = freeSessions;
+			freeSessions = &chunk[i];
+		}
+		sessionChunks[numOfChunks++].store(chunk, std::memory_order_release);
+	}
+
+	SocketInfo* lpSocketInfo = freeSessions;
+	freeSessions = lpSocketInfo->nextFree;
+	LeaveCriticalSection(&csForSessions);
+
+	// generation 0 is never handed out, so no live handle equals INVALID_SESSION
+	lpSocketInfo->generation = (lpSocketInfo->generation + 1) & ((1ull << (64 - SESSION_INDEX_BITS)) - 1);
+	if (lpSocketInfo->generation == 0)
+		lpSocketInfo->generation = 1;
+
+	lpSocketInfo->nextFree = NULL;
 	lpSocketInfo->socket = socket;
-	lpSocketInfo->recvBuf = IOInfo::AllocateIoInfo();
-	lpSocketInfo->sendBuf = IOInfo::AllocateIoInfo();
+	lpSocketInfo->compPort = NULL;
+	lpSocketInfo->closing = false;
+	lpSocketInfo->timers = NULL;
+	lpSocketInfo->lastReceived = GetTickCount64();
+	lpSocketInfo->pingSentAt = 0;
+	lpSocketInfo->rtt = 0;
+	lpSocketInfo->refCount = 1;
+	SessionHandle handle = (lpSocketInfo->generation << SESSION_INDEX_BITS) | lpSocketInfo->slotIndex;
+	lpSocketInfo->recvBuf->Bind(socket, handle);
+	lpSocketInfo->sendBuf->Bind(socket, handle);
+	lpSocketInfo->handle = handle;
 
 	return lpSocketInfo;
 }
@@ -27,10 +86,51 @@ SocketInfo* SocketInfo::AllocateSocketInfo(const SOCKET& socket)
 void SocketInfo::DeallocateSocketInfo(SocketInfo* lpSocketInfo)
 {
 	assert(lpSocketInfo != NULL);
-	if (lpSocketInfo->recvBuf != NULL) 
-		IOInfo::DeallocateIoInfo(lpSocketInfo->recvBuf);
-	if (lpSocketInfo->sendBuf != NULL)
-		IOInfo::DeallocateIoInfo(lpSocketInfo->sendBuf);
+	// every handle to this session goes stale here, and a sender that resolved it just
+	// before finds its buffers detached, so the socket can be closed and its number reused
+	lpSocketInfo->handle = INVALID_SESSION;
+	lpSocketInfo->recvBuf->Detach();
+	lpSocketInfo->sendBuf->Detach();
 	lpSocketInfo->socket = INVALID_SOCKET;
-	delete lpSocketInfo;
+	lpSocketInfo->Release();
+}
+
+void SocketInfo::AddRef()
+{
+	refCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SocketInfo::Release()
+{
+	if (refCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		return;
+
+	// no request is outstanding, so the kernel holds none of the buffers any more
+	recvBuf->Reset();
+	sendBuf->Reset();
+
+	EnterCriticalSection(&csForSessions);
+	nextFree = freeSessions;
+	freeSessions = this;
+	LeaveCriticalSection(&csForSessions);
+}
+
+SocketInfo* SocketInfo::FromHandle(SessionHandle handle)
+{
+	uint32_t index = (uint32_t)(handle & (MAX_SESSIONS - 1));
+	SocketInfo* chunk = sessionChunks[index / SESSION_CHUNK_SIZE].load(std::memory_order_acquire);
+	if (handle == INVALID_SESSION || chunk == NULL)
+		return NULL;
+
+	SocketInfo* lpSocketInfo = &chunk[index % SESSION_CHUNK_SIZE];
+	return lpSocketInfo->handle == handle ? lpSocketInfo : NULL;
+}
+
+SocketInfo* SocketInfo::FromCompletionKey(ULONG_PTR completionKey)
+{
+	if (completionKey < SESSION_KEY_BASE || completionKey - SESSION_KEY_BASE >= MAX_SESSIONS)
+		return NULL;
+	uint32_t index = (uint32_t)(completionKey - SESSION_KEY_BASE);
+	SocketInfo* chunk = sessionChunks[index / SESSION_CHUNK_SIZE].load(std::memory_order_acquire);
+	return chunk != NULL ? &chunk[index % SESSION_CHUNK_SIZE] : NULL;
 }
@@ -1,8 +1,20 @@
 #pragma once
 
-#include <WinSock2.h>
-#include <WS2tcpip.h>
+#include <atomic>
+#include <cstdint>
+#include "Platform.h"
 #include "IOInfo.h"
+#include "CompletionPort.h"
+#include "TimerWheel.h"
+
+#define SESSION_INDEX_BITS 20
+#define MAX_SESSIONS (1 << SESSION_INDEX_BITS)
+#define SESSION_CHUNK_SIZE 256
+// A handle is the slot index with the slot's generation above it. The generation has the
+// 44 bits left, so a stale handle would match again only after 2^44 reuses of its slot.
+// Completion keys are the slot index from SESSION_KEY_BASE up, clear of KILL_THREAD and the
+// other fixed keys, so they fit a 32-bit ULONG_PTR as well.
+#define SESSION_KEY_BASE 0x1000
 
 class SocketInfo {
 public:
@@ -10,11 +22,44 @@ public:
 	~SocketInfo();
 
 public:
+	// Sessions live in a slab that only ever grows; a freed slot is reused by the next
+	// connection with its generation bumped, so its buffers are never returned to the heap.
 	static SocketInfo* AllocateSocketInfo(const SOCKET& socket);
+	// Closes the session: its handle goes stale and nothing more is posted on its socket.
+	// The slot is reused once the requests still outstanding have completed.
 	static void DeallocateSocketInfo(SocketInfo* lpSocketInfo);
+	// nullptr once the session behind the handle has been closed
+	static SocketInfo* FromHandle(SessionHandle handle);
+	// The session a completion was queued for, closed or not; the completion's reference
+	// keeps the slot from being reused. nullptr if the key is not a session's.
+	static SocketInfo* FromCompletionKey(ULONG_PTR completionKey);
+	ULONG_PTR CompletionKey() const { return SESSION_KEY_BASE + slotIndex; }
+
+	// The open session holds one reference, and every request posted on its socket or
+	// completion queued for it holds another, dropped once the completion has been handled.
+	void AddRef();
+	void Release();
 
 public:
+	std::atomic<SessionHandle> handle;
 	SOCKET socket;
+	// port of the event loop that owns this connection for its whole lifetime
+	CompletionPort* compPort;
 	IOInfo* recvBuf;
 	IOInfo* sendBuf;
+	// set once a close has been queued for this session, see ServerManager::DisconnectClient
+	std::atomic<bool> closing;
+
+	// wheel of the owning event loop; heartbeat pings the client and reaps it once idle
+	TimerWheel* timers;
+	Timer heartbeat;
+	std::atomic<ULONGLONG> lastReceived;
+	std::atomic<ULONGLONG> pingSentAt;	// 0 while no ping is outstanding
+	std::atomic<DWORD> rtt;				// last measured round trip in ms
+
+private:
+	uint32_t slotIndex;
+	uint64_t generation;
+	SocketInfo* nextFree;
+	std::atomic<int> refCount;
 };
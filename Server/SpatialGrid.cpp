@@ -0,0 +1,114 @@
+#include <cmath>
+#include "SpatialGrid.h"
+
+SpatialGrid::SpatialGrid() : cellSize(1.0f)
+{
+	Clear();
+}
+
+void SpatialGrid::Clear()
+{
+	cells.clear();
+	for (int i = 0; i < MAX_ROOM_SLOTS; ++i)
+		entries[i].placed = false;
+}
+
+void SpatialGrid::SetCellSize(float size)
+{
+	if (size == cellSize)
+		return;
+
+	// every player is bucketed again where it stands
+	cellSize = size;
+	cells.clear();
+	for (int i = 0; i < MAX_ROOM_SLOTS; ++i)
+	{
+		if (entries[i].placed)
+		{
+			entries[i].placed = false;
+			Update(i, entries[i].x, entries[i].z);
+		}
+	}
+}
+
+bool SpatialGrid::InRange(float x, float z) const
+{	// cell coordinates have to fit an int32_t; this also turns away NaN
+	return fabsf(x / cellSize) < 2e9f && fabsf(z / cellSize) < 2e9f;
+}
+
+uint64_t SpatialGrid::CellOf(float x, float z) const
+{
+	return MakeCell((int32_t)floorf(x / cellSize), (int32_t)floorf(z / cellSize));
+}
+
+void SpatialGrid::Update(int slot, float x, float z)
+{
+	if (slot < 0 || slot >= MAX_ROOM_SLOTS)
+		return;
+	// a position no cell holds takes the player off the grid
+	if (!InRange(x, z))
+	{
+		Remove(slot);
+		return;
+	}
+
+	Entry& entry = entries[slot];
+	uint64_t cell = CellOf(x, z);
+	entry.x = x;
+	entry.z = z;
+	if (entry.placed && entry.cell == cell)
+		return;
+
+	Remove(slot);
+	entry.placed = true;
+	entry.cell = cell;
+	cells[cell] |= 1u << slot;
+}
+
+void SpatialGrid::Remove(int slot)
+{
+	if (slot < 0 || slot >= MAX_ROOM_SLOTS || !entries[slot].placed)
+		return;
+
+	Entry& entry = entries[slot];
+	auto bucket = cells.find(entry.cell);
+	if (bucket != cells.end())
+	{
+		bucket->second &= ~(1u << slot);
+		if (bucket->second == 0)
+			cells.erase(bucket);
+	}
+	entry.placed = false;
+}
+
+uint32_t SpatialGrid::Query(float x, float z, float radius) const
+{
+	if (!InRange(x, z))
+		return 0;
+	int32_t cx = (int32_t)floorf(x / cellSize);
+	int32_t cz = (int32_t)floorf(z / cellSize);
+	float radiusSquared = radius * radius;
+
+	uint32_t found = 0;
+	for (int32_t dx = -1; dx <= 1; ++dx)
+	{
+		for (int32_t dz = -1; dz <= 1; ++dz)
+		{
+			auto bucket = cells.find(MakeCell(cx + dx, cz + dz));
+			if (bucket == cells.end())
+				continue;
+
+			for (uint32_t candidates = bucket->second; candidates != 0; candidates &= candidates - 1)
+			{
+				int slot = 0;
+				while (((candidates >> slot) & 1) == 0)
+					++slot;
+				float ox = entries[slot].x - x;
+				float oz = entries[slot].z - z;
+				if (ox * ox + oz * oz <= radiusSquared)
+					found |= 1u << slot;
+			}
+		}
+	}
+	return found;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include "def.h"
+
+// The players of one room bucketed by where they stand on the ground plane (x, z), in square
+// cells as wide as the interest radius, so everyone within the radius of a point is in the 3x3
+// cells around it. Players are room slots; a set of them is a bitmask.
+class SpatialGrid {
+public:
+	SpatialGrid();
+
+	void Clear();
+	void SetCellSize(float size);
+	// Moves slot to (x, z). The buckets are only touched when it changes cell.
+	void Update(int slot, float x, float z);
+	void Remove(int slot);
+	// slots within radius of (x, z); radius must not exceed the cell size
+	uint32_t Query(float x, float z, float radius) const;
+
+private:
+	struct Entry {
+		bool placed;
+		uint64_t cell;
+		float x, z;
+	};
+
+	float cellSize;
+	std::unordered_map<uint64_t, uint32_t> cells;	// cell -> slots in it, empty cells erased
+	Entry entries[MAX_ROOM_SLOTS];
+
+	bool InRange(float x, float z) const;
+	uint64_t CellOf(float x, float z) const;
+	static uint64_t MakeCell(int32_t cx, int32_t cz) { return ((uint64_t)(uint32_t)cx << 32) | (uint32_t)cz; }
+};
@@ -0,0 +1,148 @@
+#include "TimerWheel.h"
+
+static void LinkTimer(Timer** head, Timer* timer)
+{
+	timer->next = *head;
+	if (*head != nullptr)
+		(*head)->pprev = &timer->next;
+	timer->pprev = head;
+	*head = timer;
+}
+
+static void UnlinkTimer(Timer* timer)
+{
+	*timer->pprev = timer->next;
+	if (timer->next != nullptr)
+		timer->next->pprev = timer->pprev;
+	timer->next = nullptr;
+	timer->pprev = nullptr;
+}
+
+// Takes the whole list of a slot so the slot can be refilled while it is walked.
+static void MoveList(Timer** from, Timer** to)
+{
+	*to = *from;
+	*from = nullptr;
+	if (*to != nullptr)
+		(*to)->pprev = to;
+}
+
+TimerWheel::TimerWheel()
+{
+	ZeroMemory(slots, sizeof(slots));
+	startTime = GetTickCount64();
+	currentTick = 0;
+	InitializeCriticalSection(&csForWheel);
+}
+
+TimerWheel::~TimerWheel()
+{
+	DeleteCriticalSection(&csForWheel);
+}
+
+void TimerWheel::Schedule(Timer* timer, DWORD delayMs)
+{
+	DWORD ticks = (delayMs + TIMER_TICK_MS - 1) / TIMER_TICK_MS;
+	if (ticks > TIMER_MAX_TICKS)
+		ticks = TIMER_MAX_TICKS;
+
+	EnterCriticalSection(&csForWheel);
+	if (timer->IsArmed())
+		UnlinkTimer(timer);
+	// counted from the real time, the wheel may not have been advanced for a while
+	uint32_t now = ElapsedTicks();
+	timer->expires = ((int32_t)(now - currentTick) > 0 ? now : currentTick) + ticks;
+	Place(timer);
+	LeaveCriticalSection(&csForWheel);
+}
+
+void TimerWheel::Cancel(Timer* timer)
+{
+	EnterCriticalSection(&csForWheel);
+	if (timer->IsArmed())
+		UnlinkTimer(timer);
+	LeaveCriticalSection(&csForWheel);
+}
+
+void TimerWheel::Place(Timer* timer)
+{
+	int32_t delta = (int32_t)(timer->expires - currentTick);
+	if (delta < 0)
+	{	// already due, e.g. while being cascaded late
+		LinkTimer(&slots[0][currentTick & TIMER_SLOT_MASK], timer);
+		return;
+	}
+
+	int level = 0;
+	while (level < TIMER_LEVELS - 1 && (uint32_t)delta >= (1u << (TIMER_SLOT_BITS * (level + 1))))
+		++level;
+	LinkTimer(&slots[level][(timer->expires >> (TIMER_SLOT_BITS * level)) & TIMER_SLOT_MASK], timer);
+}
+
+void TimerWheel::Cascade(int level)
+{
+	Timer* pending;
+	MoveList(&slots[level][(currentTick >> (TIMER_SLOT_BITS * level)) & TIMER_SLOT_MASK], &pending);
+	while (pending != nullptr)
+	{
+		Timer* timer = pending;
+		UnlinkTimer(timer);
+		Place(timer);
+	}
+}
+
+uint32_t TimerWheel::ElapsedTicks() const
+{
+	return (uint32_t)((GetTickCount64() - startTime) / TIMER_TICK_MS);
+}
+
+void TimerWheel::Advance()
+{
+	EnterCriticalSection(&csForWheel);
+	uint32_t target = ElapsedTicks();
+	while ((int32_t)(target - currentTick) >= 0)
+	{
+		if ((currentTick & TIMER_SLOT_MASK) == 0)
+		{
+			for (int level = 1; level < TIMER_LEVELS; ++level)
+			{
+				Cascade(level);
+				if (((currentTick >> (TIMER_SLOT_BITS * level)) & TIMER_SLOT_MASK) != 0)
+					break;
+			}
+		}
+
+		Timer* expired;
+		MoveList(&slots[0][currentTick & TIMER_SLOT_MASK], &expired);
+		// a timer re-armed by its own callback lands on a later tick
+		++currentTick;
+		while (expired != nullptr)
+		{
+			Timer* timer = expired;
+			UnlinkTimer(timer);
+			timer->callback(this, timer);
+		}
+	}
+	LeaveCriticalSection(&csForWheel);
+}
+
+DWORD TimerWheel::MillisecondsUntilNextTick()
+{
+	EnterCriticalSection(&csForWheel);
+	// nothing can come due before the next cascade that is not already on the finest wheel
+	uint32_t next = currentTick;
+	if ((currentTick & TIMER_SLOT_MASK) != 0)
+	{
+		uint32_t boundary = (currentTick | TIMER_SLOT_MASK) + 1;
+		for (next = currentTick; next != boundary; ++next)
+		{
+			if (slots[0][next & TIMER_SLOT_MASK] != nullptr)
+				break;
+		}
+	}
+	LeaveCriticalSection(&csForWheel);
+
+	ULONGLONG due = startTime + (ULONGLONG)next * TIMER_TICK_MS;
+	ULONGLONG now = GetTickCount64();
+	return (due > now) ? (DWORD)(due - now) : 0;
+}
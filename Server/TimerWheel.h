@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include "Platform.h"
+
+// fine enough for room ticks at 60 Hz; an idle wheel still only wakes once per level-0 turn
+#define TIMER_TICK_MS 1
+#define TIMER_SLOT_BITS 6
+#define TIMER_SLOTS (1 << TIMER_SLOT_BITS)
+#define TIMER_SLOT_MASK (TIMER_SLOTS - 1)
+#define TIMER_LEVELS 4
+// 2^24 ticks, about 4.6 hours; longer delays are clamped
+#define TIMER_MAX_TICKS ((1u << (TIMER_SLOT_BITS * TIMER_LEVELS)) - 1)
+
+struct Timer;
+class TimerWheel;
+typedef void (*TimerCallback)(TimerWheel* wheel, Timer* timer);
+
+// Embedded in whatever it times, so arming one never allocates.
+struct Timer {
+	Timer* next;
+	Timer** pprev;		// nullptr while the timer is not armed
+	TimerCallback callback;
+	void* context;
+	uint32_t expires;	// in ticks of the wheel it is armed on
+
+	Timer() : next(nullptr), pprev(nullptr), callback(nullptr), context(nullptr), expires(0) {}
+	bool IsArmed() const { return pprev != nullptr; }
+};
+
+// Hashed hierarchical timing wheel: TIMER_LEVELS wheels of TIMER_SLOTS slots, each level
+// TIMER_SLOTS times coarser than the one below. Schedule and Cancel are O(1); a timer is
+// moved down a level each time its slot on the coarser wheel comes due.
+// Each event loop owns one, advanced by its workers between completions.
+class TimerWheel {
+public:
+	TimerWheel();
+	~TimerWheel();
+
+	// (Re)arms timer to call callback(this, timer) after delayMs, rounded up to the next tick.
+	void Schedule(Timer* timer, DWORD delayMs);
+	void Cancel(Timer* timer);
+
+	// Fires every timer that has come due. Callbacks run with the wheel locked, so they may
+	// re-arm or cancel timers but must not block.
+	void Advance();
+	// How long a worker may wait for completions before the wheel needs advancing again.
+	DWORD MillisecondsUntilNextTick();
+
+private:
+	Timer* slots[TIMER_LEVELS][TIMER_SLOTS];
+	ULONGLONG startTime;
+	uint32_t currentTick;	// next tick to be processed
+	CRITICAL_SECTION csForWheel;
+
+	void Place(Timer* timer);
+	void Cascade(int level);
+	uint32_t ElapsedTicks() const;
+};
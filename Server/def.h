@@ -1,23 +1,26 @@
 #pragma once
 
-typedef unsigned (__stdcall *PTHREAD_START) (void *);
-
-#define BEGINTHREADEX(psa, cbStack, pfnStartAddr, \
-   pvParam, fdwCreate, pdwThreadId)                 \
-      ((HANDLE)_beginthreadex(                      \
-         (void *)        (psa),                     \
-         (unsigned)      (cbStack),                 \
-         (PTHREAD_START) (pfnStartAddr),            \
-         (void *)        (pvParam),                 \
-         (unsigned)      (fdwCreate),               \
-         (unsigned *)    (pdwThreadId)))
-
+#include "Platform.h"
 
 #define LOG(s) printf("[Log]: %s\n", s);
 
 #define KILL_THREAD 9
+#define ACCEPT_KEY 10
+#define PROBE_KEY 11
+
+// how long a closed room waits for its thread to drain before it is freed
+#define ROOM_CLEANUP_DELAY_MS 1000
+// room id of a client in the lobby
+#define NO_ROOM (-1)
+// slots of a room, one per Client.position: red team from 0, blue team from 8
+#define MAX_ROOM_SLOTS 16
+
+// queueing delay above which an event loop gets another worker, and below which it may lose one
+#define WORKER_GROW_DELAY_US 2000
+#define WORKER_SHRINK_DELAY_US 200
 
 #define PORT 9910
+#define DEFAULT_MAX_MESSAGE_SIZE (1 << 20)
 #define IP "10.10.10.10"
 
 enum MessageType {
@@ -32,6 +35,8 @@ enum MessageType {
 	READY_EVENT,
 	LEAVE_GAMEROOM,
 	START_GAME,
+	PING,	// server -> client, answered with PONG; neither has a body
+	PONG,
 
 	DATA = 100,
 	ROOMLIST,
@@ -40,5 +45,9 @@ enum MessageType {
 	PLAY_STATE,
 	TRANSFORM,
 	VECTOR_3,
-	WORLD_STATE
+	WORLD_STATE,
+	ROOM_SNAPSHOT,	// server -> client, once per room tick
+	SNAPSHOT_ACK,	// client -> server, the tick of the newest snapshot applied
+	WORLD_STATE_BITS,	// WORLD_STATE bit-packed, see Snapshot.h; its sender gets ROOM_SNAPSHOT_BITS
+	ROOM_SNAPSHOT_BITS	// ROOM_SNAPSHOT bit-packed
 };
\ No newline at end of file
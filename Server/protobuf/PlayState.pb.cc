@@ -5,457 +5,517 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace protobuf_PlayState_2eproto {
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_PlayState_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_HitState;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_PlayState_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_Vector3Proto;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_PlayState_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_TransformProto;
-}  // namespace protobuf_PlayState_2eproto
-namespace state {
-class Vector3ProtoDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Vector3Proto>
-      _instance;
-} _Vector3Proto_default_instance_;
-class TransformProtoDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<TransformProto>
-      _instance;
-} _TransformProto_default_instance_;
-class PlayStateDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<PlayState>
-      _instance;
-} _PlayState_default_instance_;
-class HitStateDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<HitState>
-      _instance;
-} _HitState_default_instance_;
-class WorldStateDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<WorldState>
-      _instance;
-} _WorldState_default_instance_;
-}  // namespace state
-namespace protobuf_PlayState_2eproto {
-static void InitDefaultsVector3Proto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::state::_Vector3Proto_default_instance_;
-    new (ptr) ::state::Vector3Proto();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::state::Vector3Proto::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_Vector3Proto =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsVector3Proto}, {}};
-
-static void InitDefaultsTransformProto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::state::_TransformProto_default_instance_;
-    new (ptr) ::state::TransformProto();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::state::TransformProto::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_TransformProto =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsTransformProto}, {
-      &protobuf_PlayState_2eproto::scc_info_Vector3Proto.base,}};
+PROTOBUF_PRAGMA_INIT_SEG
 
-static void InitDefaultsPlayState() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::state::_PlayState_default_instance_;
-    new (ptr) ::state::PlayState();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::state::PlayState::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_PlayState =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsPlayState}, {
-      &protobuf_PlayState_2eproto::scc_info_TransformProto.base,}};
-
-static void InitDefaultsHitState() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::state::_HitState_default_instance_;
-    new (ptr) ::state::HitState();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::state::HitState::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_HitState =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsHitState}, {}};
-
-static void InitDefaultsWorldState() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::state::_WorldState_default_instance_;
-    new (ptr) ::state::WorldState();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::state::WorldState::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<2> scc_info_WorldState =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 2, InitDefaultsWorldState}, {
-      &protobuf_PlayState_2eproto::scc_info_TransformProto.base,
-      &protobuf_PlayState_2eproto::scc_info_HitState.base,}};
-
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_Vector3Proto.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_TransformProto.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_PlayState.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_HitState.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_WorldState.base);
-}
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-::google::protobuf::Metadata file_level_metadata[5];
+namespace state {
+PROTOBUF_CONSTEXPR Vector3Proto::Vector3Proto(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0
+  , /*decltype(_impl_.z_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct Vector3ProtoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Vector3ProtoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Vector3ProtoDefaultTypeInternal() {}
+  union {
+    Vector3Proto _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Vector3ProtoDefaultTypeInternal _Vector3Proto_default_instance_;
+PROTOBUF_CONSTEXPR TransformProto::TransformProto(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.position_)*/nullptr
+  , /*decltype(_impl_.rotation_)*/nullptr
+  , /*decltype(_impl_.scale_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TransformProtoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TransformProtoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TransformProtoDefaultTypeInternal() {}
+  union {
+    TransformProto _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransformProtoDefaultTypeInternal _TransformProto_default_instance_;
+PROTOBUF_CONSTEXPR PlayState::PlayState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.clntname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.transform_)*/nullptr
+  , /*decltype(_impl_.animstate_)*/0
+  , /*decltype(_impl_.health_)*/0
+  , /*decltype(_impl_.killcount_)*/0
+  , /*decltype(_impl_.deathcount_)*/0
+  , /*decltype(_impl_.roomid_)*/0
+  , /*decltype(_impl_.slot_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PlayStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayStateDefaultTypeInternal() {}
+  union {
+    PlayState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayStateDefaultTypeInternal _PlayState_default_instance_;
+PROTOBUF_CONSTEXPR HitState::HitState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.from_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.to_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.damage_)*/0
+  , /*decltype(_impl_.fromslot_)*/0
+  , /*decltype(_impl_.toslot_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HitStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HitStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HitStateDefaultTypeInternal() {}
+  union {
+    HitState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HitStateDefaultTypeInternal _HitState_default_instance_;
+PROTOBUF_CONSTEXPR WorldState::WorldState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.clntname_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.transform_)*/nullptr
+  , /*decltype(_impl_.hitstate_)*/nullptr
+  , /*decltype(_impl_.compacttransform_)*/nullptr
+  , /*decltype(_impl_.roomid_)*/0
+  , /*decltype(_impl_.health_)*/0
+  , /*decltype(_impl_.fired_)*/false
+  , /*decltype(_impl_.hit_)*/false
+  , /*decltype(_impl_.killpoint_)*/0
+  , /*decltype(_impl_.deathpoint_)*/0
+  , /*decltype(_impl_.animstate_)*/0
+  , /*decltype(_impl_.slot_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WorldStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WorldStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WorldStateDefaultTypeInternal() {}
+  union {
+    WorldState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WorldStateDefaultTypeInternal _WorldState_default_instance_;
+PROTOBUF_CONSTEXPR CompactTransform::CompactTransform(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.scale_)*/nullptr
+  , /*decltype(_impl_.position_)*/uint64_t{0u}
+  , /*decltype(_impl_.rotation_)*/0u} {}
+struct CompactTransformDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CompactTransformDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CompactTransformDefaultTypeInternal() {}
+  union {
+    CompactTransform _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CompactTransformDefaultTypeInternal _CompactTransform_default_instance_;
+PROTOBUF_CONSTEXPR StateDelta::StateDelta(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.state_)*/nullptr
+  , /*decltype(_impl_.entity_)*/0
+  , /*decltype(_impl_.changed_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StateDeltaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StateDeltaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StateDeltaDefaultTypeInternal() {}
+  union {
+    StateDelta _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StateDeltaDefaultTypeInternal _StateDelta_default_instance_;
+PROTOBUF_CONSTEXPR RoomSnapshot::RoomSnapshot(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.states_)*/{}
+  , /*decltype(_impl_.deltas_)*/{}
+  , /*decltype(_impl_.roomid_)*/0
+  , /*decltype(_impl_.tick_)*/0u
+  , /*decltype(_impl_.basetick_)*/0u
+  , /*decltype(_impl_.visible_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoomSnapshotDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomSnapshotDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomSnapshotDefaultTypeInternal() {}
+  union {
+    RoomSnapshot _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomSnapshotDefaultTypeInternal _RoomSnapshot_default_instance_;
+PROTOBUF_CONSTEXPR SnapshotAck::SnapshotAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.tick_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SnapshotAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SnapshotAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SnapshotAckDefaultTypeInternal() {}
+  union {
+    SnapshotAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SnapshotAckDefaultTypeInternal _SnapshotAck_default_instance_;
+}  // namespace state
+static ::_pb::Metadata file_level_metadata_PlayState_2eproto[9];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_PlayState_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_PlayState_2eproto = nullptr;
 
-const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_PlayState_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::state::Vector3Proto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::state::Vector3Proto, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::state::Vector3Proto, _impl_.y_),
+  PROTOBUF_FIELD_OFFSET(::state::Vector3Proto, _impl_.z_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::state::TransformProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::state::TransformProto, _impl_.position_),
+  PROTOBUF_FIELD_OFFSET(::state::TransformProto, _impl_.rotation_),
+  PROTOBUF_FIELD_OFFSET(::state::TransformProto, _impl_.scale_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::state::PlayState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::state::PlayState, _impl_.transform_),
+  PROTOBUF_FIELD_OFFSET(::state::PlayState, _impl_.animstate_),
+  PROTOBUF_FIELD_OFFSET(::state::PlayState, _impl_.health_),
+  PROTOBUF_FIELD_OFFSET(::state::PlayState, _impl_.killcount_),
+  PROTOBUF_FIELD_OFFSET(::state::PlayState, _impl_.deathcount_),
+  PROTOBUF_FIELD_OFFSET(::state::PlayState, _impl_.roomid_),
+  PROTOBUF_FIELD_OFFSET(::state::PlayState, _impl_.clntname_),
+  PROTOBUF_FIELD_OFFSET(::state::PlayState, _impl_.slot_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::Vector3Proto, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::state::HitState, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::Vector3Proto, x_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::Vector3Proto, y_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::Vector3Proto, z_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::state::HitState, _impl_.from_),
+  PROTOBUF_FIELD_OFFSET(::state::HitState, _impl_.to_),
+  PROTOBUF_FIELD_OFFSET(::state::HitState, _impl_.damage_),
+  PROTOBUF_FIELD_OFFSET(::state::HitState, _impl_.fromslot_),
+  PROTOBUF_FIELD_OFFSET(::state::HitState, _impl_.toslot_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::TransformProto, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::state::WorldState, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::TransformProto, position_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::TransformProto, rotation_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::TransformProto, scale_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::state::WorldState, _impl_.roomid_),
+  PROTOBUF_FIELD_OFFSET(::state::WorldState, _impl_.clntname_),
+  PROTOBUF_FIELD_OFFSET(::state::WorldState, _impl_.transform_),
+  PROTOBUF_FIELD_OFFSET(::state::WorldState, _impl_.fired_),
+  PROTOBUF_FIELD_OFFSET(::state::WorldState, _impl_.health_),
+  PROTOBUF_FIELD_OFFSET(::state::WorldState, _impl_.hit_),
+  PROTOBUF_FIELD_OFFSET(::state::WorldState, _impl_.hitstate_),
+  PROTOBUF_FIELD_OFFSET(::state::WorldState, _impl_.killpoint_),
+  PROTOBUF_FIELD_OFFSET(::state::WorldState, _impl_.deathpoint_),
+  PROTOBUF_FIELD_OFFSET(::state::WorldState, _impl_.animstate_),
+  PROTOBUF_FIELD_OFFSET(::state::WorldState, _impl_.compacttransform_),
+  PROTOBUF_FIELD_OFFSET(::state::WorldState, _impl_.slot_),
+  PROTOBUF_FIELD_OFFSET(::state::CompactTransform, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::state::CompactTransform, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::state::CompactTransform, _impl_.position_),
+  PROTOBUF_FIELD_OFFSET(::state::CompactTransform, _impl_.rotation_),
+  PROTOBUF_FIELD_OFFSET(::state::CompactTransform, _impl_.scale_),
+  0,
+  1,
+  ~0u,
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::PlayState, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::state::StateDelta, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::PlayState, transform_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::PlayState, animstate_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::PlayState, health_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::PlayState, killcount_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::PlayState, deathcount_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::PlayState, roomid_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::PlayState, clntname_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::state::StateDelta, _impl_.entity_),
+  PROTOBUF_FIELD_OFFSET(::state::StateDelta, _impl_.changed_),
+  PROTOBUF_FIELD_OFFSET(::state::StateDelta, _impl_.state_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::HitState, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::state::RoomSnapshot, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::HitState, from_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::HitState, to_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::HitState, damage_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::state::RoomSnapshot, _impl_.roomid_),
+  PROTOBUF_FIELD_OFFSET(::state::RoomSnapshot, _impl_.tick_),
+  PROTOBUF_FIELD_OFFSET(::state::RoomSnapshot, _impl_.states_),
+  PROTOBUF_FIELD_OFFSET(::state::RoomSnapshot, _impl_.basetick_),
+  PROTOBUF_FIELD_OFFSET(::state::RoomSnapshot, _impl_.deltas_),
+  PROTOBUF_FIELD_OFFSET(::state::RoomSnapshot, _impl_.visible_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::WorldState, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::state::SnapshotAck, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::WorldState, roomid_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::WorldState, clntname_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::WorldState, transform_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::WorldState, fired_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::WorldState, health_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::WorldState, hit_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::WorldState, hitstate_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::WorldState, killpoint_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::WorldState, deathpoint_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::state::WorldState, animstate_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::state::SnapshotAck, _impl_.tick_),
 };
-static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::state::Vector3Proto)},
-  { 8, -1, sizeof(::state::TransformProto)},
-  { 16, -1, sizeof(::state::PlayState)},
-  { 28, -1, sizeof(::state::HitState)},
-  { 36, -1, sizeof(::state::WorldState)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::state::Vector3Proto)},
+  { 9, -1, -1, sizeof(::state::TransformProto)},
+  { 18, -1, -1, sizeof(::state::PlayState)},
+  { 32, -1, -1, sizeof(::state::HitState)},
+  { 43, -1, -1, sizeof(::state::WorldState)},
+  { 61, 70, -1, sizeof(::state::CompactTransform)},
+  { 73, -1, -1, sizeof(::state::StateDelta)},
+  { 82, -1, -1, sizeof(::state::RoomSnapshot)},
+  { 94, -1, -1, sizeof(::state::SnapshotAck)},
 };
 
-static ::google::protobuf::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::google::protobuf::Message*>(&::state::_Vector3Proto_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::state::_TransformProto_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::state::_PlayState_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::state::_HitState_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::state::_WorldState_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::state::_Vector3Proto_default_instance_._instance,
+  &::state::_TransformProto_default_instance_._instance,
+  &::state::_PlayState_default_instance_._instance,
+  &::state::_HitState_default_instance_._instance,
+  &::state::_WorldState_default_instance_._instance,
+  &::state::_CompactTransform_default_instance_._instance,
+  &::state::_StateDelta_default_instance_._instance,
+  &::state::_RoomSnapshot_default_instance_._instance,
+  &::state::_SnapshotAck_default_instance_._instance,
 };
 
-void protobuf_AssignDescriptors() {
-  AddDescriptors();
-  AssignDescriptors(
-      "PlayState.proto", schemas, file_default_instances, TableStruct::offsets,
-      file_level_metadata, NULL, NULL);
-}
-
-void protobuf_AssignDescriptorsOnce() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, protobuf_AssignDescriptors);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 5);
-}
-
-void AddDescriptorsImpl() {
-  InitDefaults();
-  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\017PlayState.proto\022\005state\"/\n\014Vector3Proto"
-      "\022\t\n\001x\030\001 \001(\002\022\t\n\001y\030\002 \001(\002\022\t\n\001z\030\003 \001(\002\"\202\001\n\016Tr"
-      "ansformProto\022%\n\010position\030\001 \001(\0132\023.state.V"
-      "ector3Proto\022%\n\010rotation\030\002 \001(\0132\023.state.Ve"
-      "ctor3Proto\022\"\n\005scale\030\003 \001(\0132\023.state.Vector"
-      "3Proto\"\241\001\n\tPlayState\022(\n\ttransform\030\001 \001(\0132"
-      "\025.state.TransformProto\022\021\n\tanimState\030\002 \001("
-      "\005\022\016\n\006health\030\003 \001(\005\022\021\n\tkillCount\030\004 \001(\005\022\022\n\n"
-      "deathCount\030\005 \001(\005\022\016\n\006roomId\030\006 \001(\005\022\020\n\010clnt"
-      "Name\030\007 \001(\t\"4\n\010HitState\022\014\n\004from\030\001 \001(\t\022\n\n\002"
-      "to\030\002 \001(\t\022\016\n\006damage\030\003 \001(\005\"\341\001\n\nWorldState\022"
-      "\016\n\006roomId\030\001 \001(\005\022\020\n\010clntName\030\002 \001(\t\022(\n\ttra"
-      "nsform\030\003 \001(\0132\025.state.TransformProto\022\r\n\005f"
-      "ired\030\004 \001(\010\022\016\n\006health\030\005 \001(\005\022\013\n\003hit\030\006 \001(\010\022"
-      "!\n\010hitState\030\007 \001(\0132\017.state.HitState\022\021\n\tki"
-      "llPoint\030\010 \001(\005\022\022\n\ndeathPoint\030\t \001(\005\022\021\n\tani"
-      "mState\030\n \001(\005B\030\252\002\025Google.Protobuf.Stateb\006"
-      "proto3"
-  };
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 686);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "PlayState.proto", &protobuf_RegisterTypes);
+const char descriptor_table_protodef_PlayState_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\017PlayState.proto\022\005state\"/\n\014Vector3Proto"
+  "\022\t\n\001x\030\001 \001(\002\022\t\n\001y\030\002 \001(\002\022\t\n\001z\030\003 \001(\002\"\202\001\n\016Tr"
+  "ansformProto\022%\n\010position\030\001 \001(\0132\023.state.V"
+  "ector3Proto\022%\n\010rotation\030\002 \001(\0132\023.state.Ve"
+  "ctor3Proto\022\"\n\005scale\030\003 \001(\0132\023.state.Vector"
+  "3Proto\"\257\001\n\tPlayState\022(\n\ttransform\030\001 \001(\0132"
+  "\025.state.TransformProto\022\021\n\tanimState\030\002 \001("
+  "\005\022\016\n\006health\030\003 \001(\005\022\021\n\tkillCount\030\004 \001(\005\022\022\n\n"
+  "deathCount\030\005 \001(\005\022\016\n\006roomId\030\006 \001(\005\022\020\n\010clnt"
+  "Name\030\007 \001(\t\022\014\n\004slot\030\010 \001(\005\"V\n\010HitState\022\014\n\004"
+  "from\030\001 \001(\t\022\n\n\002to\030\002 \001(\t\022\016\n\006damage\030\003 \001(\005\022\020"
+  "\n\010fromSlot\030\004 \001(\005\022\016\n\006toSlot\030\005 \001(\005\"\242\002\n\nWor"
+  "ldState\022\016\n\006roomId\030\001 \001(\005\022\020\n\010clntName\030\002 \001("
+  "\t\022(\n\ttransform\030\003 \001(\0132\025.state.TransformPr"
+  "oto\022\r\n\005fired\030\004 \001(\010\022\016\n\006health\030\005 \001(\005\022\013\n\003hi"
+  "t\030\006 \001(\010\022!\n\010hitState\030\007 \001(\0132\017.state.HitSta"
+  "te\022\021\n\tkillPoint\030\010 \001(\005\022\022\n\ndeathPoint\030\t \001("
+  "\005\022\021\n\tanimState\030\n \001(\005\0221\n\020compactTransform"
+  "\030\013 \001(\0132\027.state.CompactTransform\022\014\n\004slot\030"
+  "\014 \001(\005\"~\n\020CompactTransform\022\025\n\010position\030\001 "
+  "\001(\006H\000\210\001\001\022\025\n\010rotation\030\002 \001(\007H\001\210\001\001\022\"\n\005scale"
+  "\030\003 \001(\0132\023.state.Vector3ProtoB\013\n\t_position"
+  "B\013\n\t_rotation\"O\n\nStateDelta\022\016\n\006entity\030\001 "
+  "\001(\005\022\017\n\007changed\030\002 \001(\r\022 \n\005state\030\003 \001(\0132\021.st"
+  "ate.WorldState\"\225\001\n\014RoomSnapshot\022\016\n\006roomI"
+  "d\030\001 \001(\005\022\014\n\004tick\030\002 \001(\r\022!\n\006states\030\003 \003(\0132\021."
+  "state.WorldState\022\020\n\010baseTick\030\004 \001(\r\022!\n\006de"
+  "ltas\030\005 \003(\0132\021.state.StateDelta\022\017\n\007visible"
+  "\030\006 \001(\r\"\033\n\013SnapshotAck\022\014\n\004tick\030\001 \001(\rB\030\252\002\025"
+  "Google.Protobuf.Stateb\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_PlayState_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_PlayState_2eproto = {
+    false, false, 1189, descriptor_table_protodef_PlayState_2eproto,
+    "PlayState.proto",
+    &descriptor_table_PlayState_2eproto_once, nullptr, 0, 9,
+    schemas, file_default_instances, TableStruct_PlayState_2eproto::offsets,
+    file_level_metadata_PlayState_2eproto, file_level_enum_descriptors_PlayState_2eproto,
+    file_level_service_descriptors_PlayState_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_PlayState_2eproto_getter() {
+  return &descriptor_table_PlayState_2eproto;
 }
 
-void AddDescriptors() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, AddDescriptorsImpl);
-}
-// Force AddDescriptors() to be called at dynamic initialization time.
-struct StaticDescriptorInitializer {
-  StaticDescriptorInitializer() {
-    AddDescriptors();
-  }
-} static_descriptor_initializer;
-}  // namespace protobuf_PlayState_2eproto
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_PlayState_2eproto(&descriptor_table_PlayState_2eproto);
 namespace state {
 
 // ===================================================================
 
-void Vector3Proto::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Vector3Proto::kXFieldNumber;
-const int Vector3Proto::kYFieldNumber;
-const int Vector3Proto::kZFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Vector3Proto::_Internal {
+ public:
+};
 
-Vector3Proto::Vector3Proto()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_PlayState_2eproto::scc_info_Vector3Proto.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:state.Vector3Proto)
+Vector3Proto::Vector3Proto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:state.Vector3Proto)
 }
 Vector3Proto::Vector3Proto(const Vector3Proto& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&x_, &from.x_,
-    static_cast<size_t>(reinterpret_cast<char*>(&z_) -
-    reinterpret_cast<char*>(&x_)) + sizeof(z_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Vector3Proto* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}
+    , decltype(_impl_.z_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.z_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.z_));
   // @@protoc_insertion_point(copy_constructor:state.Vector3Proto)
 }
 
-void Vector3Proto::SharedCtor() {
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&z_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(z_));
+inline void Vector3Proto::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+    , decltype(_impl_.z_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Vector3Proto::~Vector3Proto() {
   // @@protoc_insertion_point(destructor:state.Vector3Proto)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Vector3Proto::SharedDtor() {
+inline void Vector3Proto::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void Vector3Proto::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* Vector3Proto::descriptor() {
-  ::protobuf_PlayState_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_PlayState_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Vector3Proto& Vector3Proto::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_PlayState_2eproto::scc_info_Vector3Proto.base);
-  return *internal_default_instance();
-}
-
 
 void Vector3Proto::Clear() {
 // @@protoc_insertion_point(message_clear_start:state.Vector3Proto)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&x_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&z_) -
-      reinterpret_cast<char*>(&x_)) + sizeof(z_));
-  _internal_metadata_.Clear();
-}
-
-bool Vector3Proto::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:state.Vector3Proto)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  ::memset(&_impl_.x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.z_) -
+      reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.z_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Vector3Proto::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // float x = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(13u /* 13 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &x_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float y = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(21u /* 21 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &y_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // float z = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(29u /* 29 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &z_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:state.Vector3Proto)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:state.Vector3Proto)
-  return false;
-#undef DO_
-}
-
-void Vector3Proto::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:state.Vector3Proto)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // float x = 1;
-  if (this->x() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->x(), output);
-  }
-
-  // float y = 2;
-  if (this->y() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->y(), output);
-  }
-
-  // float z = 3;
-  if (this->z() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->z(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:state.Vector3Proto)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* Vector3Proto::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* Vector3Proto::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:state.Vector3Proto)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // float x = 1;
-  if (this->x() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->x(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = this->_internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_x(), target);
   }
 
   // float y = 2;
-  if (this->y() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->y(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = this->_internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_y(), target);
   }
 
   // float z = 3;
-  if (this->z() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->z(), target);
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = this->_internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_z(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:state.Vector3Proto)
   return target;
@@ -465,69 +525,77 @@ size_t Vector3Proto::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:state.Vector3Proto)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // float x = 1;
-  if (this->x() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = this->_internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
     total_size += 1 + 4;
   }
 
   // float y = 2;
-  if (this->y() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = this->_internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
     total_size += 1 + 4;
   }
 
   // float z = 3;
-  if (this->z() != 0) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = this->_internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
     total_size += 1 + 4;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Vector3Proto::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:state.Vector3Proto)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Vector3Proto* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Vector3Proto>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:state.Vector3Proto)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:state.Vector3Proto)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Vector3Proto::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Vector3Proto::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Vector3Proto::GetClassData() const { return &_class_data_; }
 
-void Vector3Proto::MergeFrom(const Vector3Proto& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:state.Vector3Proto)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void Vector3Proto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Vector3Proto*>(&to_msg);
+  auto& from = static_cast<const Vector3Proto&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:state.Vector3Proto)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.x() != 0) {
-    set_x(from.x());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_x = from._internal_x();
+  uint32_t raw_x;
+  memcpy(&raw_x, &tmp_x, sizeof(tmp_x));
+  if (raw_x != 0) {
+    _this->_internal_set_x(from._internal_x());
   }
-  if (from.y() != 0) {
-    set_y(from.y());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_y = from._internal_y();
+  uint32_t raw_y;
+  memcpy(&raw_y, &tmp_y, sizeof(tmp_y));
+  if (raw_y != 0) {
+    _this->_internal_set_y(from._internal_y());
   }
-  if (from.z() != 0) {
-    set_z(from.z());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_z = from._internal_z();
+  uint32_t raw_z;
+  memcpy(&raw_z, &tmp_z, sizeof(tmp_z));
+  if (raw_z != 0) {
+    _this->_internal_set_z(from._internal_z());
   }
-}
-
-void Vector3Proto::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:state.Vector3Proto)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Vector3Proto::CopyFrom(const Vector3Proto& from) {
@@ -541,249 +609,208 @@ bool Vector3Proto::IsInitialized() const {
   return true;
 }
 
-void Vector3Proto::Swap(Vector3Proto* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Vector3Proto::InternalSwap(Vector3Proto* other) {
   using std::swap;
-  swap(x_, other->x_);
-  swap(y_, other->y_);
-  swap(z_, other->z_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Vector3Proto, _impl_.z_)
+      + sizeof(Vector3Proto::_impl_.z_)
+      - PROTOBUF_FIELD_OFFSET(Vector3Proto, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
 }
 
-::google::protobuf::Metadata Vector3Proto::GetMetadata() const {
-  protobuf_PlayState_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_PlayState_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata Vector3Proto::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_PlayState_2eproto_getter, &descriptor_table_PlayState_2eproto_once,
+      file_level_metadata_PlayState_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void TransformProto::InitAsDefaultInstance() {
-  ::state::_TransformProto_default_instance_._instance.get_mutable()->position_ = const_cast< ::state::Vector3Proto*>(
-      ::state::Vector3Proto::internal_default_instance());
-  ::state::_TransformProto_default_instance_._instance.get_mutable()->rotation_ = const_cast< ::state::Vector3Proto*>(
-      ::state::Vector3Proto::internal_default_instance());
-  ::state::_TransformProto_default_instance_._instance.get_mutable()->scale_ = const_cast< ::state::Vector3Proto*>(
-      ::state::Vector3Proto::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int TransformProto::kPositionFieldNumber;
-const int TransformProto::kRotationFieldNumber;
-const int TransformProto::kScaleFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-TransformProto::TransformProto()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_PlayState_2eproto::scc_info_TransformProto.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:state.TransformProto)
+class TransformProto::_Internal {
+ public:
+  static const ::state::Vector3Proto& position(const TransformProto* msg);
+  static const ::state::Vector3Proto& rotation(const TransformProto* msg);
+  static const ::state::Vector3Proto& scale(const TransformProto* msg);
+};
+
+const ::state::Vector3Proto&
+TransformProto::_Internal::position(const TransformProto* msg) {
+  return *msg->_impl_.position_;
+}
+const ::state::Vector3Proto&
+TransformProto::_Internal::rotation(const TransformProto* msg) {
+  return *msg->_impl_.rotation_;
+}
+const ::state::Vector3Proto&
+TransformProto::_Internal::scale(const TransformProto* msg) {
+  return *msg->_impl_.scale_;
+}
+TransformProto::TransformProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:state.TransformProto)
 }
 TransformProto::TransformProto(const TransformProto& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  if (from.has_position()) {
-    position_ = new ::state::Vector3Proto(*from.position_);
-  } else {
-    position_ = NULL;
-  }
-  if (from.has_rotation()) {
-    rotation_ = new ::state::Vector3Proto(*from.rotation_);
-  } else {
-    rotation_ = NULL;
-  }
-  if (from.has_scale()) {
-    scale_ = new ::state::Vector3Proto(*from.scale_);
-  } else {
-    scale_ = NULL;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TransformProto* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.rotation_){nullptr}
+    , decltype(_impl_.scale_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_position()) {
+    _this->_impl_.position_ = new ::state::Vector3Proto(*from._impl_.position_);
+  }
+  if (from._internal_has_rotation()) {
+    _this->_impl_.rotation_ = new ::state::Vector3Proto(*from._impl_.rotation_);
+  }
+  if (from._internal_has_scale()) {
+    _this->_impl_.scale_ = new ::state::Vector3Proto(*from._impl_.scale_);
   }
   // @@protoc_insertion_point(copy_constructor:state.TransformProto)
 }
 
-void TransformProto::SharedCtor() {
-  ::memset(&position_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&scale_) -
-      reinterpret_cast<char*>(&position_)) + sizeof(scale_));
+inline void TransformProto::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.position_){nullptr}
+    , decltype(_impl_.rotation_){nullptr}
+    , decltype(_impl_.scale_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 TransformProto::~TransformProto() {
   // @@protoc_insertion_point(destructor:state.TransformProto)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void TransformProto::SharedDtor() {
-  if (this != internal_default_instance()) delete position_;
-  if (this != internal_default_instance()) delete rotation_;
-  if (this != internal_default_instance()) delete scale_;
+inline void TransformProto::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.position_;
+  if (this != internal_default_instance()) delete _impl_.rotation_;
+  if (this != internal_default_instance()) delete _impl_.scale_;
 }
 
 void TransformProto::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* TransformProto::descriptor() {
-  ::protobuf_PlayState_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_PlayState_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const TransformProto& TransformProto::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_PlayState_2eproto::scc_info_TransformProto.base);
-  return *internal_default_instance();
-}
-
-
 void TransformProto::Clear() {
 // @@protoc_insertion_point(message_clear_start:state.TransformProto)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaNoVirtual() == NULL && position_ != NULL) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = NULL;
-  if (GetArenaNoVirtual() == NULL && rotation_ != NULL) {
-    delete rotation_;
+  _impl_.position_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.rotation_ != nullptr) {
+    delete _impl_.rotation_;
   }
-  rotation_ = NULL;
-  if (GetArenaNoVirtual() == NULL && scale_ != NULL) {
-    delete scale_;
+  _impl_.rotation_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.scale_ != nullptr) {
+    delete _impl_.scale_;
   }
-  scale_ = NULL;
-  _internal_metadata_.Clear();
+  _impl_.scale_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool TransformProto::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:state.TransformProto)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* TransformProto::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .state.Vector3Proto position = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_position()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_position(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .state.Vector3Proto rotation = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_rotation()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rotation(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .state.Vector3Proto scale = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_scale()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_scale(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:state.TransformProto)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:state.TransformProto)
-  return false;
-#undef DO_
-}
-
-void TransformProto::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:state.TransformProto)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .state.Vector3Proto position = 1;
-  if (this->has_position()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->_internal_position(), output);
-  }
-
-  // .state.Vector3Proto rotation = 2;
-  if (this->has_rotation()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->_internal_rotation(), output);
-  }
-
-  // .state.Vector3Proto scale = 3;
-  if (this->has_scale()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->_internal_scale(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:state.TransformProto)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* TransformProto::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* TransformProto::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:state.TransformProto)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .state.Vector3Proto position = 1;
-  if (this->has_position()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->_internal_position(), deterministic, target);
+  if (this->_internal_has_position()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::position(this),
+        _Internal::position(this).GetCachedSize(), target, stream);
   }
 
   // .state.Vector3Proto rotation = 2;
-  if (this->has_rotation()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->_internal_rotation(), deterministic, target);
+  if (this->_internal_has_rotation()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::rotation(this),
+        _Internal::rotation(this).GetCachedSize(), target, stream);
   }
 
   // .state.Vector3Proto scale = 3;
-  if (this->has_scale()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        3, this->_internal_scale(), deterministic, target);
+  if (this->_internal_has_scale()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::scale(this),
+        _Internal::scale(this).GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:state.TransformProto)
   return target;
@@ -793,75 +820,62 @@ size_t TransformProto::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:state.TransformProto)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // .state.Vector3Proto position = 1;
-  if (this->has_position()) {
+  if (this->_internal_has_position()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *position_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.position_);
   }
 
   // .state.Vector3Proto rotation = 2;
-  if (this->has_rotation()) {
+  if (this->_internal_has_rotation()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *rotation_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.rotation_);
   }
 
   // .state.Vector3Proto scale = 3;
-  if (this->has_scale()) {
+  if (this->_internal_has_scale()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *scale_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.scale_);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TransformProto::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:state.TransformProto)
-  GOOGLE_DCHECK_NE(&from, this);
-  const TransformProto* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const TransformProto>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:state.TransformProto)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:state.TransformProto)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TransformProto::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TransformProto::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TransformProto::GetClassData() const { return &_class_data_; }
+
 
-void TransformProto::MergeFrom(const TransformProto& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:state.TransformProto)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void TransformProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TransformProto*>(&to_msg);
+  auto& from = static_cast<const TransformProto&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:state.TransformProto)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.has_position()) {
-    mutable_position()->::state::Vector3Proto::MergeFrom(from.position());
+  if (from._internal_has_position()) {
+    _this->_internal_mutable_position()->::state::Vector3Proto::MergeFrom(
+        from._internal_position());
   }
-  if (from.has_rotation()) {
-    mutable_rotation()->::state::Vector3Proto::MergeFrom(from.rotation());
+  if (from._internal_has_rotation()) {
+    _this->_internal_mutable_rotation()->::state::Vector3Proto::MergeFrom(
+        from._internal_rotation());
   }
-  if (from.has_scale()) {
-    mutable_scale()->::state::Vector3Proto::MergeFrom(from.scale());
+  if (from._internal_has_scale()) {
+    _this->_internal_mutable_scale()->::state::Vector3Proto::MergeFrom(
+        from._internal_scale());
   }
-}
-
-void TransformProto::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:state.TransformProto)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void TransformProto::CopyFrom(const TransformProto& from) {
@@ -875,349 +889,286 @@ bool TransformProto::IsInitialized() const {
   return true;
 }
 
-void TransformProto::Swap(TransformProto* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void TransformProto::InternalSwap(TransformProto* other) {
   using std::swap;
-  swap(position_, other->position_);
-  swap(rotation_, other->rotation_);
-  swap(scale_, other->scale_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TransformProto, _impl_.scale_)
+      + sizeof(TransformProto::_impl_.scale_)
+      - PROTOBUF_FIELD_OFFSET(TransformProto, _impl_.position_)>(
+          reinterpret_cast<char*>(&_impl_.position_),
+          reinterpret_cast<char*>(&other->_impl_.position_));
 }
 
-::google::protobuf::Metadata TransformProto::GetMetadata() const {
-  protobuf_PlayState_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_PlayState_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata TransformProto::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_PlayState_2eproto_getter, &descriptor_table_PlayState_2eproto_once,
+      file_level_metadata_PlayState_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void PlayState::InitAsDefaultInstance() {
-  ::state::_PlayState_default_instance_._instance.get_mutable()->transform_ = const_cast< ::state::TransformProto*>(
-      ::state::TransformProto::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PlayState::kTransformFieldNumber;
-const int PlayState::kAnimStateFieldNumber;
-const int PlayState::kHealthFieldNumber;
-const int PlayState::kKillCountFieldNumber;
-const int PlayState::kDeathCountFieldNumber;
-const int PlayState::kRoomIdFieldNumber;
-const int PlayState::kClntNameFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-PlayState::PlayState()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_PlayState_2eproto::scc_info_PlayState.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:state.PlayState)
+class PlayState::_Internal {
+ public:
+  static const ::state::TransformProto& transform(const PlayState* msg);
+};
+
+const ::state::TransformProto&
+PlayState::_Internal::transform(const PlayState* msg) {
+  return *msg->_impl_.transform_;
+}
+PlayState::PlayState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:state.PlayState)
 }
 PlayState::PlayState(const PlayState& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  clntname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.clntname().size() > 0) {
-    clntname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.clntname_);
-  }
-  if (from.has_transform()) {
-    transform_ = new ::state::TransformProto(*from.transform_);
-  } else {
-    transform_ = NULL;
-  }
-  ::memcpy(&animstate_, &from.animstate_,
-    static_cast<size_t>(reinterpret_cast<char*>(&roomid_) -
-    reinterpret_cast<char*>(&animstate_)) + sizeof(roomid_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PlayState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.clntname_){}
+    , decltype(_impl_.transform_){nullptr}
+    , decltype(_impl_.animstate_){}
+    , decltype(_impl_.health_){}
+    , decltype(_impl_.killcount_){}
+    , decltype(_impl_.deathcount_){}
+    , decltype(_impl_.roomid_){}
+    , decltype(_impl_.slot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.clntname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clntname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_clntname().empty()) {
+    _this->_impl_.clntname_.Set(from._internal_clntname(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_transform()) {
+    _this->_impl_.transform_ = new ::state::TransformProto(*from._impl_.transform_);
+  }
+  ::memcpy(&_impl_.animstate_, &from._impl_.animstate_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.slot_) -
+    reinterpret_cast<char*>(&_impl_.animstate_)) + sizeof(_impl_.slot_));
   // @@protoc_insertion_point(copy_constructor:state.PlayState)
 }
 
-void PlayState::SharedCtor() {
-  clntname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&transform_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&roomid_) -
-      reinterpret_cast<char*>(&transform_)) + sizeof(roomid_));
+inline void PlayState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.clntname_){}
+    , decltype(_impl_.transform_){nullptr}
+    , decltype(_impl_.animstate_){0}
+    , decltype(_impl_.health_){0}
+    , decltype(_impl_.killcount_){0}
+    , decltype(_impl_.deathcount_){0}
+    , decltype(_impl_.roomid_){0}
+    , decltype(_impl_.slot_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.clntname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clntname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PlayState::~PlayState() {
   // @@protoc_insertion_point(destructor:state.PlayState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PlayState::SharedDtor() {
-  clntname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete transform_;
+inline void PlayState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.clntname_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.transform_;
 }
 
 void PlayState::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* PlayState::descriptor() {
-  ::protobuf_PlayState_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_PlayState_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+  _impl_._cached_size_.Set(size);
 }
 
-const PlayState& PlayState::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_PlayState_2eproto::scc_info_PlayState.base);
-  return *internal_default_instance();
-}
-
-
 void PlayState::Clear() {
 // @@protoc_insertion_point(message_clear_start:state.PlayState)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  clntname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == NULL && transform_ != NULL) {
-    delete transform_;
-  }
-  transform_ = NULL;
-  ::memset(&animstate_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&roomid_) -
-      reinterpret_cast<char*>(&animstate_)) + sizeof(roomid_));
-  _internal_metadata_.Clear();
-}
-
-bool PlayState::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:state.PlayState)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.clntname_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.transform_ != nullptr) {
+    delete _impl_.transform_;
+  }
+  _impl_.transform_ = nullptr;
+  ::memset(&_impl_.animstate_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.slot_) -
+      reinterpret_cast<char*>(&_impl_.animstate_)) + sizeof(_impl_.slot_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PlayState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .state.TransformProto transform = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_transform()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_transform(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 animState = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &animstate_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.animstate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 health = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &health_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.health_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 killCount = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &killcount_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.killcount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 deathCount = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &deathcount_)));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.deathcount_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 roomId = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &roomid_)));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.roomid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string clntName = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(58u /* 58 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_clntname()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->clntname().data(), static_cast<int>(this->clntname().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "state.PlayState.clntName"));
-        } else {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_clntname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "state.PlayState.clntName"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // int32 slot = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:state.PlayState)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:state.PlayState)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void PlayState::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:state.PlayState)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* PlayState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:state.PlayState)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .state.TransformProto transform = 1;
-  if (this->has_transform()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->_internal_transform(), output);
+  if (this->_internal_has_transform()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::transform(this),
+        _Internal::transform(this).GetCachedSize(), target, stream);
   }
 
   // int32 animState = 2;
-  if (this->animstate() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->animstate(), output);
+  if (this->_internal_animstate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_animstate(), target);
   }
 
   // int32 health = 3;
-  if (this->health() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->health(), output);
+  if (this->_internal_health() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_health(), target);
   }
 
   // int32 killCount = 4;
-  if (this->killcount() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->killcount(), output);
+  if (this->_internal_killcount() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_killcount(), target);
   }
 
   // int32 deathCount = 5;
-  if (this->deathcount() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(5, this->deathcount(), output);
+  if (this->_internal_deathcount() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_deathcount(), target);
   }
 
   // int32 roomId = 6;
-  if (this->roomid() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(6, this->roomid(), output);
+  if (this->_internal_roomid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_roomid(), target);
   }
 
   // string clntName = 7;
-  if (this->clntname().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->clntname().data(), static_cast<int>(this->clntname().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_clntname().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_clntname().data(), static_cast<int>(this->_internal_clntname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "state.PlayState.clntName");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      7, this->clntname(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:state.PlayState)
-}
-
-::google::protobuf::uint8* PlayState::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:state.PlayState)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .state.TransformProto transform = 1;
-  if (this->has_transform()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->_internal_transform(), deterministic, target);
-  }
-
-  // int32 animState = 2;
-  if (this->animstate() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->animstate(), target);
-  }
-
-  // int32 health = 3;
-  if (this->health() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->health(), target);
-  }
-
-  // int32 killCount = 4;
-  if (this->killcount() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->killcount(), target);
-  }
-
-  // int32 deathCount = 5;
-  if (this->deathcount() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(5, this->deathcount(), target);
-  }
-
-  // int32 roomId = 6;
-  if (this->roomid() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(6, this->roomid(), target);
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_clntname(), target);
   }
 
-  // string clntName = 7;
-  if (this->clntname().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->clntname().data(), static_cast<int>(this->clntname().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "state.PlayState.clntName");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        7, this->clntname(), target);
+  // int32 slot = 8;
+  if (this->_internal_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_slot(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:state.PlayState)
   return target;
@@ -1227,116 +1178,98 @@ size_t PlayState::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:state.PlayState)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string clntName = 7;
-  if (this->clntname().size() > 0) {
+  if (!this->_internal_clntname().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->clntname());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_clntname());
   }
 
   // .state.TransformProto transform = 1;
-  if (this->has_transform()) {
+  if (this->_internal_has_transform()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *transform_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.transform_);
   }
 
   // int32 animState = 2;
-  if (this->animstate() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->animstate());
+  if (this->_internal_animstate() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_animstate());
   }
 
   // int32 health = 3;
-  if (this->health() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->health());
+  if (this->_internal_health() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_health());
   }
 
   // int32 killCount = 4;
-  if (this->killcount() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->killcount());
+  if (this->_internal_killcount() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_killcount());
   }
 
   // int32 deathCount = 5;
-  if (this->deathcount() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->deathcount());
+  if (this->_internal_deathcount() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_deathcount());
   }
 
   // int32 roomId = 6;
-  if (this->roomid() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->roomid());
+  if (this->_internal_roomid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_roomid());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void PlayState::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:state.PlayState)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PlayState* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PlayState>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:state.PlayState)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:state.PlayState)
-    MergeFrom(*source);
+  // int32 slot = 8;
+  if (this->_internal_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_slot());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PlayState::MergeFrom(const PlayState& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:state.PlayState)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PlayState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PlayState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PlayState::GetClassData() const { return &_class_data_; }
+
 
-  if (from.clntname().size() > 0) {
+void PlayState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PlayState*>(&to_msg);
+  auto& from = static_cast<const PlayState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:state.PlayState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    clntname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.clntname_);
+  if (!from._internal_clntname().empty()) {
+    _this->_internal_set_clntname(from._internal_clntname());
   }
-  if (from.has_transform()) {
-    mutable_transform()->::state::TransformProto::MergeFrom(from.transform());
+  if (from._internal_has_transform()) {
+    _this->_internal_mutable_transform()->::state::TransformProto::MergeFrom(
+        from._internal_transform());
   }
-  if (from.animstate() != 0) {
-    set_animstate(from.animstate());
+  if (from._internal_animstate() != 0) {
+    _this->_internal_set_animstate(from._internal_animstate());
   }
-  if (from.health() != 0) {
-    set_health(from.health());
+  if (from._internal_health() != 0) {
+    _this->_internal_set_health(from._internal_health());
   }
-  if (from.killcount() != 0) {
-    set_killcount(from.killcount());
+  if (from._internal_killcount() != 0) {
+    _this->_internal_set_killcount(from._internal_killcount());
   }
-  if (from.deathcount() != 0) {
-    set_deathcount(from.deathcount());
+  if (from._internal_deathcount() != 0) {
+    _this->_internal_set_deathcount(from._internal_deathcount());
   }
-  if (from.roomid() != 0) {
-    set_roomid(from.roomid());
+  if (from._internal_roomid() != 0) {
+    _this->_internal_set_roomid(from._internal_roomid());
   }
-}
-
-void PlayState::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:state.PlayState)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_slot() != 0) {
+    _this->_internal_set_slot(from._internal_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PlayState::CopyFrom(const PlayState& from) {
@@ -1350,255 +1283,250 @@ bool PlayState::IsInitialized() const {
   return true;
 }
 
-void PlayState::Swap(PlayState* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PlayState::InternalSwap(PlayState* other) {
   using std::swap;
-  clntname_.Swap(&other->clntname_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(transform_, other->transform_);
-  swap(animstate_, other->animstate_);
-  swap(health_, other->health_);
-  swap(killcount_, other->killcount_);
-  swap(deathcount_, other->deathcount_);
-  swap(roomid_, other->roomid_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::google::protobuf::Metadata PlayState::GetMetadata() const {
-  protobuf_PlayState_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_PlayState_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clntname_, lhs_arena,
+      &other->_impl_.clntname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PlayState, _impl_.slot_)
+      + sizeof(PlayState::_impl_.slot_)
+      - PROTOBUF_FIELD_OFFSET(PlayState, _impl_.transform_)>(
+          reinterpret_cast<char*>(&_impl_.transform_),
+          reinterpret_cast<char*>(&other->_impl_.transform_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PlayState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_PlayState_2eproto_getter, &descriptor_table_PlayState_2eproto_once,
+      file_level_metadata_PlayState_2eproto[2]);
 }
 
-
 // ===================================================================
 
-void HitState::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int HitState::kFromFieldNumber;
-const int HitState::kToFieldNumber;
-const int HitState::kDamageFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class HitState::_Internal {
+ public:
+};
 
-HitState::HitState()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_PlayState_2eproto::scc_info_HitState.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:state.HitState)
+HitState::HitState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:state.HitState)
 }
 HitState::HitState(const HitState& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  from_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.from().size() > 0) {
-    from_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.from_);
-  }
-  to_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.to().size() > 0) {
-    to_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.to_);
-  }
-  damage_ = from.damage_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HitState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_){}
+    , decltype(_impl_.to_){}
+    , decltype(_impl_.damage_){}
+    , decltype(_impl_.fromslot_){}
+    , decltype(_impl_.toslot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.from_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.from_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_from().empty()) {
+    _this->_impl_.from_.Set(from._internal_from(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.to_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.to_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_to().empty()) {
+    _this->_impl_.to_.Set(from._internal_to(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.damage_, &from._impl_.damage_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.toslot_) -
+    reinterpret_cast<char*>(&_impl_.damage_)) + sizeof(_impl_.toslot_));
   // @@protoc_insertion_point(copy_constructor:state.HitState)
 }
 
-void HitState::SharedCtor() {
-  from_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  to_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  damage_ = 0;
+inline void HitState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_){}
+    , decltype(_impl_.to_){}
+    , decltype(_impl_.damage_){0}
+    , decltype(_impl_.fromslot_){0}
+    , decltype(_impl_.toslot_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.from_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.from_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.to_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.to_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 HitState::~HitState() {
   // @@protoc_insertion_point(destructor:state.HitState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void HitState::SharedDtor() {
-  from_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  to_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void HitState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.from_.Destroy();
+  _impl_.to_.Destroy();
 }
 
 void HitState::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* HitState::descriptor() {
-  ::protobuf_PlayState_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_PlayState_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const HitState& HitState::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_PlayState_2eproto::scc_info_HitState.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void HitState::Clear() {
 // @@protoc_insertion_point(message_clear_start:state.HitState)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  from_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  to_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  damage_ = 0;
-  _internal_metadata_.Clear();
-}
-
-bool HitState::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:state.HitState)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.from_.ClearToEmpty();
+  _impl_.to_.ClearToEmpty();
+  ::memset(&_impl_.damage_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.toslot_) -
+      reinterpret_cast<char*>(&_impl_.damage_)) + sizeof(_impl_.toslot_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HitState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string from = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_from()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->from().data(), static_cast<int>(this->from().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "state.HitState.from"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_from();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "state.HitState.from"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string to = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_to()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->to().data(), static_cast<int>(this->to().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "state.HitState.to"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_to();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "state.HitState.to"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 damage = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &damage_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.damage_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 fromSlot = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.fromslot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 toSlot = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.toslot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:state.HitState)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:state.HitState)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void HitState::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:state.HitState)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* HitState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:state.HitState)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string from = 1;
-  if (this->from().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->from().data(), static_cast<int>(this->from().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_from().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_from().data(), static_cast<int>(this->_internal_from().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "state.HitState.from");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->from(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_from(), target);
   }
 
   // string to = 2;
-  if (this->to().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->to().data(), static_cast<int>(this->to().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_to().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_to().data(), static_cast<int>(this->_internal_to().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "state.HitState.to");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->to(), output);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_to(), target);
   }
 
   // int32 damage = 3;
-  if (this->damage() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->damage(), output);
+  if (this->_internal_damage() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_damage(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:state.HitState)
-}
-
-::google::protobuf::uint8* HitState::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:state.HitState)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string from = 1;
-  if (this->from().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->from().data(), static_cast<int>(this->from().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "state.HitState.from");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->from(), target);
+  // int32 fromSlot = 4;
+  if (this->_internal_fromslot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_fromslot(), target);
   }
 
-  // string to = 2;
-  if (this->to().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->to().data(), static_cast<int>(this->to().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "state.HitState.to");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->to(), target);
+  // int32 toSlot = 5;
+  if (this->_internal_toslot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_toslot(), target);
   }
 
-  // int32 damage = 3;
-  if (this->damage() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->damage(), target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:state.HitState)
   return target;
@@ -1608,77 +1536,73 @@ size_t HitState::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:state.HitState)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string from = 1;
-  if (this->from().size() > 0) {
+  if (!this->_internal_from().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->from());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_from());
   }
 
   // string to = 2;
-  if (this->to().size() > 0) {
+  if (!this->_internal_to().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->to());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_to());
   }
 
   // int32 damage = 3;
-  if (this->damage() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->damage());
+  if (this->_internal_damage() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_damage());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // int32 fromSlot = 4;
+  if (this->_internal_fromslot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_fromslot());
+  }
 
-void HitState::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:state.HitState)
-  GOOGLE_DCHECK_NE(&from, this);
-  const HitState* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const HitState>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:state.HitState)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:state.HitState)
-    MergeFrom(*source);
+  // int32 toSlot = 5;
+  if (this->_internal_toslot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_toslot());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void HitState::MergeFrom(const HitState& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:state.HitState)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HitState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HitState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HitState::GetClassData() const { return &_class_data_; }
 
-  if (from.from().size() > 0) {
 
-    from_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.from_);
-  }
-  if (from.to().size() > 0) {
+void HitState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HitState*>(&to_msg);
+  auto& from = static_cast<const HitState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:state.HitState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    to_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.to_);
+  if (!from._internal_from().empty()) {
+    _this->_internal_set_from(from._internal_from());
   }
-  if (from.damage() != 0) {
-    set_damage(from.damage());
+  if (!from._internal_to().empty()) {
+    _this->_internal_set_to(from._internal_to());
   }
-}
-
-void HitState::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:state.HitState)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_damage() != 0) {
+    _this->_internal_set_damage(from._internal_damage());
+  }
+  if (from._internal_fromslot() != 0) {
+    _this->_internal_set_fromslot(from._internal_fromslot());
+  }
+  if (from._internal_toslot() != 0) {
+    _this->_internal_set_toslot(from._internal_toslot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void HitState::CopyFrom(const HitState& from) {
@@ -1692,643 +1616,1637 @@ bool HitState::IsInitialized() const {
   return true;
 }
 
-void HitState::Swap(HitState* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void HitState::InternalSwap(HitState* other) {
   using std::swap;
-  from_.Swap(&other->from_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  to_.Swap(&other->to_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(damage_, other->damage_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.from_, lhs_arena,
+      &other->_impl_.from_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.to_, lhs_arena,
+      &other->_impl_.to_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HitState, _impl_.toslot_)
+      + sizeof(HitState::_impl_.toslot_)
+      - PROTOBUF_FIELD_OFFSET(HitState, _impl_.damage_)>(
+          reinterpret_cast<char*>(&_impl_.damage_),
+          reinterpret_cast<char*>(&other->_impl_.damage_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HitState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_PlayState_2eproto_getter, &descriptor_table_PlayState_2eproto_once,
+      file_level_metadata_PlayState_2eproto[3]);
 }
 
-::google::protobuf::Metadata HitState::GetMetadata() const {
-  protobuf_PlayState_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_PlayState_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-
 // ===================================================================
 
-void WorldState::InitAsDefaultInstance() {
-  ::state::_WorldState_default_instance_._instance.get_mutable()->transform_ = const_cast< ::state::TransformProto*>(
-      ::state::TransformProto::internal_default_instance());
-  ::state::_WorldState_default_instance_._instance.get_mutable()->hitstate_ = const_cast< ::state::HitState*>(
-      ::state::HitState::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int WorldState::kRoomIdFieldNumber;
-const int WorldState::kClntNameFieldNumber;
-const int WorldState::kTransformFieldNumber;
-const int WorldState::kFiredFieldNumber;
-const int WorldState::kHealthFieldNumber;
-const int WorldState::kHitFieldNumber;
-const int WorldState::kHitStateFieldNumber;
-const int WorldState::kKillPointFieldNumber;
-const int WorldState::kDeathPointFieldNumber;
-const int WorldState::kAnimStateFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-WorldState::WorldState()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_PlayState_2eproto::scc_info_WorldState.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:state.WorldState)
+class WorldState::_Internal {
+ public:
+  static const ::state::TransformProto& transform(const WorldState* msg);
+  static const ::state::HitState& hitstate(const WorldState* msg);
+  static const ::state::CompactTransform& compacttransform(const WorldState* msg);
+};
+
+const ::state::TransformProto&
+WorldState::_Internal::transform(const WorldState* msg) {
+  return *msg->_impl_.transform_;
+}
+const ::state::HitState&
+WorldState::_Internal::hitstate(const WorldState* msg) {
+  return *msg->_impl_.hitstate_;
+}
+const ::state::CompactTransform&
+WorldState::_Internal::compacttransform(const WorldState* msg) {
+  return *msg->_impl_.compacttransform_;
+}
+WorldState::WorldState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:state.WorldState)
 }
 WorldState::WorldState(const WorldState& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  clntname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.clntname().size() > 0) {
-    clntname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.clntname_);
-  }
-  if (from.has_transform()) {
-    transform_ = new ::state::TransformProto(*from.transform_);
-  } else {
-    transform_ = NULL;
-  }
-  if (from.has_hitstate()) {
-    hitstate_ = new ::state::HitState(*from.hitstate_);
-  } else {
-    hitstate_ = NULL;
-  }
-  ::memcpy(&roomid_, &from.roomid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&animstate_) -
-    reinterpret_cast<char*>(&roomid_)) + sizeof(animstate_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WorldState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.clntname_){}
+    , decltype(_impl_.transform_){nullptr}
+    , decltype(_impl_.hitstate_){nullptr}
+    , decltype(_impl_.compacttransform_){nullptr}
+    , decltype(_impl_.roomid_){}
+    , decltype(_impl_.health_){}
+    , decltype(_impl_.fired_){}
+    , decltype(_impl_.hit_){}
+    , decltype(_impl_.killpoint_){}
+    , decltype(_impl_.deathpoint_){}
+    , decltype(_impl_.animstate_){}
+    , decltype(_impl_.slot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.clntname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clntname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_clntname().empty()) {
+    _this->_impl_.clntname_.Set(from._internal_clntname(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_transform()) {
+    _this->_impl_.transform_ = new ::state::TransformProto(*from._impl_.transform_);
+  }
+  if (from._internal_has_hitstate()) {
+    _this->_impl_.hitstate_ = new ::state::HitState(*from._impl_.hitstate_);
+  }
+  if (from._internal_has_compacttransform()) {
+    _this->_impl_.compacttransform_ = new ::state::CompactTransform(*from._impl_.compacttransform_);
+  }
+  ::memcpy(&_impl_.roomid_, &from._impl_.roomid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.slot_) -
+    reinterpret_cast<char*>(&_impl_.roomid_)) + sizeof(_impl_.slot_));
   // @@protoc_insertion_point(copy_constructor:state.WorldState)
 }
 
-void WorldState::SharedCtor() {
-  clntname_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&transform_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&animstate_) -
-      reinterpret_cast<char*>(&transform_)) + sizeof(animstate_));
+inline void WorldState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.clntname_){}
+    , decltype(_impl_.transform_){nullptr}
+    , decltype(_impl_.hitstate_){nullptr}
+    , decltype(_impl_.compacttransform_){nullptr}
+    , decltype(_impl_.roomid_){0}
+    , decltype(_impl_.health_){0}
+    , decltype(_impl_.fired_){false}
+    , decltype(_impl_.hit_){false}
+    , decltype(_impl_.killpoint_){0}
+    , decltype(_impl_.deathpoint_){0}
+    , decltype(_impl_.animstate_){0}
+    , decltype(_impl_.slot_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.clntname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.clntname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 WorldState::~WorldState() {
   // @@protoc_insertion_point(destructor:state.WorldState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void WorldState::SharedDtor() {
-  clntname_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete transform_;
-  if (this != internal_default_instance()) delete hitstate_;
+inline void WorldState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.clntname_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.transform_;
+  if (this != internal_default_instance()) delete _impl_.hitstate_;
+  if (this != internal_default_instance()) delete _impl_.compacttransform_;
 }
 
 void WorldState::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* WorldState::descriptor() {
-  ::protobuf_PlayState_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_PlayState_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const WorldState& WorldState::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_PlayState_2eproto::scc_info_WorldState.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void WorldState::Clear() {
 // @@protoc_insertion_point(message_clear_start:state.WorldState)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  clntname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == NULL && transform_ != NULL) {
-    delete transform_;
-  }
-  transform_ = NULL;
-  if (GetArenaNoVirtual() == NULL && hitstate_ != NULL) {
-    delete hitstate_;
-  }
-  hitstate_ = NULL;
-  ::memset(&roomid_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&animstate_) -
-      reinterpret_cast<char*>(&roomid_)) + sizeof(animstate_));
-  _internal_metadata_.Clear();
-}
-
-bool WorldState::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:state.WorldState)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.clntname_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.transform_ != nullptr) {
+    delete _impl_.transform_;
+  }
+  _impl_.transform_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.hitstate_ != nullptr) {
+    delete _impl_.hitstate_;
+  }
+  _impl_.hitstate_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.compacttransform_ != nullptr) {
+    delete _impl_.compacttransform_;
+  }
+  _impl_.compacttransform_ = nullptr;
+  ::memset(&_impl_.roomid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.slot_) -
+      reinterpret_cast<char*>(&_impl_.roomid_)) + sizeof(_impl_.slot_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WorldState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // int32 roomId = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &roomid_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.roomid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string clntName = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_clntname()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->clntname().data(), static_cast<int>(this->clntname().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "state.WorldState.clntName"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_clntname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "state.WorldState.clntName"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .state.TransformProto transform = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_transform()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_transform(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bool fired = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &fired_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.fired_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 health = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &health_)));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.health_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // bool hit = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(48u /* 48 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &hit_)));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.hit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .state.HitState hitState = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(58u /* 58 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_hitstate()));
-        } else {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hitstate(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 killPoint = 8;
-      case 8: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(64u /* 64 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &killpoint_)));
-        } else {
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.killpoint_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 deathPoint = 9;
-      case 9: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(72u /* 72 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &deathpoint_)));
-        } else {
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.deathpoint_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // int32 animState = 10;
-      case 10: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(80u /* 80 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &animstate_)));
-        } else {
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.animstate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .state.CompactTransform compactTransform = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_compacttransform(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // int32 slot = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.slot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:state.WorldState)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:state.WorldState)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void WorldState::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:state.WorldState)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* WorldState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:state.WorldState)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 roomId = 1;
-  if (this->roomid() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->roomid(), output);
+  if (this->_internal_roomid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_roomid(), target);
   }
 
   // string clntName = 2;
-  if (this->clntname().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->clntname().data(), static_cast<int>(this->clntname().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_clntname().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_clntname().data(), static_cast<int>(this->_internal_clntname().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "state.WorldState.clntName");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->clntname(), output);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_clntname(), target);
   }
 
   // .state.TransformProto transform = 3;
-  if (this->has_transform()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->_internal_transform(), output);
+  if (this->_internal_has_transform()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::transform(this),
+        _Internal::transform(this).GetCachedSize(), target, stream);
   }
 
   // bool fired = 4;
-  if (this->fired() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->fired(), output);
+  if (this->_internal_fired() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_fired(), target);
   }
 
   // int32 health = 5;
-  if (this->health() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(5, this->health(), output);
+  if (this->_internal_health() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_health(), target);
   }
 
   // bool hit = 6;
-  if (this->hit() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(6, this->hit(), output);
+  if (this->_internal_hit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_hit(), target);
   }
 
   // .state.HitState hitState = 7;
-  if (this->has_hitstate()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->_internal_hitstate(), output);
+  if (this->_internal_has_hitstate()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::hitstate(this),
+        _Internal::hitstate(this).GetCachedSize(), target, stream);
   }
 
   // int32 killPoint = 8;
-  if (this->killpoint() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(8, this->killpoint(), output);
+  if (this->_internal_killpoint() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_killpoint(), target);
   }
 
   // int32 deathPoint = 9;
-  if (this->deathpoint() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(9, this->deathpoint(), output);
+  if (this->_internal_deathpoint() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_deathpoint(), target);
   }
 
   // int32 animState = 10;
-  if (this->animstate() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(10, this->animstate(), output);
+  if (this->_internal_animstate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(10, this->_internal_animstate(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  // .state.CompactTransform compactTransform = 11;
+  if (this->_internal_has_compacttransform()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::compacttransform(this),
+        _Internal::compacttransform(this).GetCachedSize(), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:state.WorldState)
-}
 
-::google::protobuf::uint8* WorldState::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:state.WorldState)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+  // int32 slot = 12;
+  if (this->_internal_slot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(12, this->_internal_slot(), target);
+  }
 
-  // int32 roomId = 1;
-  if (this->roomid() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->roomid(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:state.WorldState)
+  return target;
+}
+
+size_t WorldState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:state.WorldState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // string clntName = 2;
-  if (this->clntname().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->clntname().data(), static_cast<int>(this->clntname().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "state.WorldState.clntName");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->clntname(), target);
+  if (!this->_internal_clntname().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_clntname());
   }
 
   // .state.TransformProto transform = 3;
-  if (this->has_transform()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        3, this->_internal_transform(), deterministic, target);
+  if (this->_internal_has_transform()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.transform_);
   }
 
-  // bool fired = 4;
-  if (this->fired() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->fired(), target);
+  // .state.HitState hitState = 7;
+  if (this->_internal_has_hitstate()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.hitstate_);
+  }
+
+  // .state.CompactTransform compactTransform = 11;
+  if (this->_internal_has_compacttransform()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.compacttransform_);
+  }
+
+  // int32 roomId = 1;
+  if (this->_internal_roomid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_roomid());
   }
 
   // int32 health = 5;
-  if (this->health() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(5, this->health(), target);
+  if (this->_internal_health() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_health());
   }
 
-  // bool hit = 6;
-  if (this->hit() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(6, this->hit(), target);
+  // bool fired = 4;
+  if (this->_internal_fired() != 0) {
+    total_size += 1 + 1;
   }
 
-  // .state.HitState hitState = 7;
-  if (this->has_hitstate()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        7, this->_internal_hitstate(), deterministic, target);
+  // bool hit = 6;
+  if (this->_internal_hit() != 0) {
+    total_size += 1 + 1;
   }
 
   // int32 killPoint = 8;
-  if (this->killpoint() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(8, this->killpoint(), target);
+  if (this->_internal_killpoint() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_killpoint());
   }
 
   // int32 deathPoint = 9;
-  if (this->deathpoint() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(9, this->deathpoint(), target);
+  if (this->_internal_deathpoint() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_deathpoint());
   }
 
   // int32 animState = 10;
-  if (this->animstate() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(10, this->animstate(), target);
+  if (this->_internal_animstate() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_animstate());
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  // int32 slot = 12;
+  if (this->_internal_slot() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_slot());
   }
-  // @@protoc_insertion_point(serialize_to_array_end:state.WorldState)
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WorldState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WorldState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WorldState::GetClassData() const { return &_class_data_; }
+
+
+void WorldState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WorldState*>(&to_msg);
+  auto& from = static_cast<const WorldState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:state.WorldState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_clntname().empty()) {
+    _this->_internal_set_clntname(from._internal_clntname());
+  }
+  if (from._internal_has_transform()) {
+    _this->_internal_mutable_transform()->::state::TransformProto::MergeFrom(
+        from._internal_transform());
+  }
+  if (from._internal_has_hitstate()) {
+    _this->_internal_mutable_hitstate()->::state::HitState::MergeFrom(
+        from._internal_hitstate());
+  }
+  if (from._internal_has_compacttransform()) {
+    _this->_internal_mutable_compacttransform()->::state::CompactTransform::MergeFrom(
+        from._internal_compacttransform());
+  }
+  if (from._internal_roomid() != 0) {
+    _this->_internal_set_roomid(from._internal_roomid());
+  }
+  if (from._internal_health() != 0) {
+    _this->_internal_set_health(from._internal_health());
+  }
+  if (from._internal_fired() != 0) {
+    _this->_internal_set_fired(from._internal_fired());
+  }
+  if (from._internal_hit() != 0) {
+    _this->_internal_set_hit(from._internal_hit());
+  }
+  if (from._internal_killpoint() != 0) {
+    _this->_internal_set_killpoint(from._internal_killpoint());
+  }
+  if (from._internal_deathpoint() != 0) {
+    _this->_internal_set_deathpoint(from._internal_deathpoint());
+  }
+  if (from._internal_animstate() != 0) {
+    _this->_internal_set_animstate(from._internal_animstate());
+  }
+  if (from._internal_slot() != 0) {
+    _this->_internal_set_slot(from._internal_slot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WorldState::CopyFrom(const WorldState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:state.WorldState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WorldState::IsInitialized() const {
+  return true;
+}
+
+void WorldState::InternalSwap(WorldState* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.clntname_, lhs_arena,
+      &other->_impl_.clntname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WorldState, _impl_.slot_)
+      + sizeof(WorldState::_impl_.slot_)
+      - PROTOBUF_FIELD_OFFSET(WorldState, _impl_.transform_)>(
+          reinterpret_cast<char*>(&_impl_.transform_),
+          reinterpret_cast<char*>(&other->_impl_.transform_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WorldState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_PlayState_2eproto_getter, &descriptor_table_PlayState_2eproto_once,
+      file_level_metadata_PlayState_2eproto[4]);
+}
+
+// ===================================================================
+
+class CompactTransform::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CompactTransform>()._impl_._has_bits_);
+  static void set_has_position(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_rotation(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::state::Vector3Proto& scale(const CompactTransform* msg);
+};
+
+const ::state::Vector3Proto&
+CompactTransform::_Internal::scale(const CompactTransform* msg) {
+  return *msg->_impl_.scale_;
+}
+CompactTransform::CompactTransform(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:state.CompactTransform)
+}
+CompactTransform::CompactTransform(const CompactTransform& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CompactTransform* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.scale_){nullptr}
+    , decltype(_impl_.position_){}
+    , decltype(_impl_.rotation_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_scale()) {
+    _this->_impl_.scale_ = new ::state::Vector3Proto(*from._impl_.scale_);
+  }
+  ::memcpy(&_impl_.position_, &from._impl_.position_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.rotation_) -
+    reinterpret_cast<char*>(&_impl_.position_)) + sizeof(_impl_.rotation_));
+  // @@protoc_insertion_point(copy_constructor:state.CompactTransform)
+}
+
+inline void CompactTransform::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.scale_){nullptr}
+    , decltype(_impl_.position_){uint64_t{0u}}
+    , decltype(_impl_.rotation_){0u}
+  };
+}
+
+CompactTransform::~CompactTransform() {
+  // @@protoc_insertion_point(destructor:state.CompactTransform)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CompactTransform::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.scale_;
+}
+
+void CompactTransform::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CompactTransform::Clear() {
+// @@protoc_insertion_point(message_clear_start:state.CompactTransform)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.scale_ != nullptr) {
+    delete _impl_.scale_;
+  }
+  _impl_.scale_ = nullptr;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.position_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.rotation_) -
+        reinterpret_cast<char*>(&_impl_.position_)) + sizeof(_impl_.rotation_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CompactTransform::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional fixed64 position = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_position(&has_bits);
+          _impl_.position_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional fixed32 rotation = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_rotation(&has_bits);
+          _impl_.rotation_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // .state.Vector3Proto scale = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_scale(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CompactTransform::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:state.CompactTransform)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // optional fixed64 position = 1;
+  if (_internal_has_position()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_position(), target);
+  }
+
+  // optional fixed32 rotation = 2;
+  if (_internal_has_rotation()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(2, this->_internal_rotation(), target);
+  }
+
+  // .state.Vector3Proto scale = 3;
+  if (this->_internal_has_scale()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::scale(this),
+        _Internal::scale(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:state.CompactTransform)
   return target;
 }
 
-size_t WorldState::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:state.WorldState)
+size_t CompactTransform::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:state.CompactTransform)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  // string clntName = 2;
-  if (this->clntname().size() > 0) {
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .state.Vector3Proto scale = 3;
+  if (this->_internal_has_scale()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->clntname());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.scale_);
   }
 
-  // .state.TransformProto transform = 3;
-  if (this->has_transform()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *transform_);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional fixed64 position = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
+    }
+
+    // optional fixed32 rotation = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 4;
+    }
+
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
 
-  // .state.HitState hitState = 7;
-  if (this->has_hitstate()) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *hitstate_);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CompactTransform::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CompactTransform::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CompactTransform::GetClassData() const { return &_class_data_; }
+
+
+void CompactTransform::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CompactTransform*>(&to_msg);
+  auto& from = static_cast<const CompactTransform&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:state.CompactTransform)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_scale()) {
+    _this->_internal_mutable_scale()->::state::Vector3Proto::MergeFrom(
+        from._internal_scale());
   }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.position_ = from._impl_.position_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.rotation_ = from._impl_.rotation_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-  // int32 roomId = 1;
-  if (this->roomid() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->roomid());
+void CompactTransform::CopyFrom(const CompactTransform& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:state.CompactTransform)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CompactTransform::IsInitialized() const {
+  return true;
+}
+
+void CompactTransform::InternalSwap(CompactTransform* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CompactTransform, _impl_.rotation_)
+      + sizeof(CompactTransform::_impl_.rotation_)
+      - PROTOBUF_FIELD_OFFSET(CompactTransform, _impl_.scale_)>(
+          reinterpret_cast<char*>(&_impl_.scale_),
+          reinterpret_cast<char*>(&other->_impl_.scale_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CompactTransform::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_PlayState_2eproto_getter, &descriptor_table_PlayState_2eproto_once,
+      file_level_metadata_PlayState_2eproto[5]);
+}
+
+// ===================================================================
+
+class StateDelta::_Internal {
+ public:
+  static const ::state::WorldState& state(const StateDelta* msg);
+};
+
+const ::state::WorldState&
+StateDelta::_Internal::state(const StateDelta* msg) {
+  return *msg->_impl_.state_;
+}
+StateDelta::StateDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:state.StateDelta)
+}
+StateDelta::StateDelta(const StateDelta& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StateDelta* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.state_){nullptr}
+    , decltype(_impl_.entity_){}
+    , decltype(_impl_.changed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_state()) {
+    _this->_impl_.state_ = new ::state::WorldState(*from._impl_.state_);
+  }
+  ::memcpy(&_impl_.entity_, &from._impl_.entity_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.changed_) -
+    reinterpret_cast<char*>(&_impl_.entity_)) + sizeof(_impl_.changed_));
+  // @@protoc_insertion_point(copy_constructor:state.StateDelta)
+}
+
+inline void StateDelta::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.state_){nullptr}
+    , decltype(_impl_.entity_){0}
+    , decltype(_impl_.changed_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StateDelta::~StateDelta() {
+  // @@protoc_insertion_point(destructor:state.StateDelta)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
+}
 
-  // int32 health = 5;
-  if (this->health() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->health());
+inline void StateDelta::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.state_;
+}
+
+void StateDelta::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StateDelta::Clear() {
+// @@protoc_insertion_point(message_clear_start:state.StateDelta)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.state_ != nullptr) {
+    delete _impl_.state_;
+  }
+  _impl_.state_ = nullptr;
+  ::memset(&_impl_.entity_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.changed_) -
+      reinterpret_cast<char*>(&_impl_.entity_)) + sizeof(_impl_.changed_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StateDelta::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 entity = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.entity_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 changed = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.changed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .state.WorldState state = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StateDelta::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:state.StateDelta)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 entity = 1;
+  if (this->_internal_entity() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_entity(), target);
   }
 
-  // bool fired = 4;
-  if (this->fired() != 0) {
-    total_size += 1 + 1;
+  // uint32 changed = 2;
+  if (this->_internal_changed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_changed(), target);
   }
 
-  // bool hit = 6;
-  if (this->hit() != 0) {
-    total_size += 1 + 1;
+  // .state.WorldState state = 3;
+  if (this->_internal_has_state()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::state(this),
+        _Internal::state(this).GetCachedSize(), target, stream);
   }
 
-  // int32 killPoint = 8;
-  if (this->killpoint() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->killpoint());
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:state.StateDelta)
+  return target;
+}
 
-  // int32 deathPoint = 9;
-  if (this->deathpoint() != 0) {
+size_t StateDelta::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:state.StateDelta)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .state.WorldState state = 3;
+  if (this->_internal_has_state()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->deathpoint());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.state_);
   }
 
-  // int32 animState = 10;
-  if (this->animstate() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::Int32Size(
-        this->animstate());
+  // int32 entity = 1;
+  if (this->_internal_entity() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_entity());
+  }
+
+  // uint32 changed = 2;
+  if (this->_internal_changed() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_changed());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void WorldState::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:state.WorldState)
-  GOOGLE_DCHECK_NE(&from, this);
-  const WorldState* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const WorldState>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:state.WorldState)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:state.WorldState)
-    MergeFrom(*source);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StateDelta::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StateDelta::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StateDelta::GetClassData() const { return &_class_data_; }
+
+
+void StateDelta::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StateDelta*>(&to_msg);
+  auto& from = static_cast<const StateDelta&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:state.StateDelta)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_state()) {
+    _this->_internal_mutable_state()->::state::WorldState::MergeFrom(
+        from._internal_state());
+  }
+  if (from._internal_entity() != 0) {
+    _this->_internal_set_entity(from._internal_entity());
   }
+  if (from._internal_changed() != 0) {
+    _this->_internal_set_changed(from._internal_changed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void WorldState::MergeFrom(const WorldState& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:state.WorldState)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void StateDelta::CopyFrom(const StateDelta& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:state.StateDelta)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StateDelta::IsInitialized() const {
+  return true;
+}
+
+void StateDelta::InternalSwap(StateDelta* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StateDelta, _impl_.changed_)
+      + sizeof(StateDelta::_impl_.changed_)
+      - PROTOBUF_FIELD_OFFSET(StateDelta, _impl_.state_)>(
+          reinterpret_cast<char*>(&_impl_.state_),
+          reinterpret_cast<char*>(&other->_impl_.state_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StateDelta::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_PlayState_2eproto_getter, &descriptor_table_PlayState_2eproto_once,
+      file_level_metadata_PlayState_2eproto[6]);
+}
+
+// ===================================================================
+
+class RoomSnapshot::_Internal {
+ public:
+};
+
+RoomSnapshot::RoomSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:state.RoomSnapshot)
+}
+RoomSnapshot::RoomSnapshot(const RoomSnapshot& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoomSnapshot* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.states_){from._impl_.states_}
+    , decltype(_impl_.deltas_){from._impl_.deltas_}
+    , decltype(_impl_.roomid_){}
+    , decltype(_impl_.tick_){}
+    , decltype(_impl_.basetick_){}
+    , decltype(_impl_.visible_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.roomid_, &from._impl_.roomid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.visible_) -
+    reinterpret_cast<char*>(&_impl_.roomid_)) + sizeof(_impl_.visible_));
+  // @@protoc_insertion_point(copy_constructor:state.RoomSnapshot)
+}
+
+inline void RoomSnapshot::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.states_){arena}
+    , decltype(_impl_.deltas_){arena}
+    , decltype(_impl_.roomid_){0}
+    , decltype(_impl_.tick_){0u}
+    , decltype(_impl_.basetick_){0u}
+    , decltype(_impl_.visible_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RoomSnapshot::~RoomSnapshot() {
+  // @@protoc_insertion_point(destructor:state.RoomSnapshot)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RoomSnapshot::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.states_.~RepeatedPtrField();
+  _impl_.deltas_.~RepeatedPtrField();
+}
+
+void RoomSnapshot::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RoomSnapshot::Clear() {
+// @@protoc_insertion_point(message_clear_start:state.RoomSnapshot)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (from.clntname().size() > 0) {
+  _impl_.states_.Clear();
+  _impl_.deltas_.Clear();
+  ::memset(&_impl_.roomid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.visible_) -
+      reinterpret_cast<char*>(&_impl_.roomid_)) + sizeof(_impl_.visible_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
 
-    clntname_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.clntname_);
+const char* RoomSnapshot::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 roomId = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.roomid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 tick = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .state.WorldState states = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_states(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 baseTick = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.basetick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .state.StateDelta deltas = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_deltas(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 visible = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.visible_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RoomSnapshot::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:state.RoomSnapshot)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 roomId = 1;
+  if (this->_internal_roomid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_roomid(), target);
   }
-  if (from.has_transform()) {
-    mutable_transform()->::state::TransformProto::MergeFrom(from.transform());
+
+  // uint32 tick = 2;
+  if (this->_internal_tick() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_tick(), target);
   }
-  if (from.has_hitstate()) {
-    mutable_hitstate()->::state::HitState::MergeFrom(from.hitstate());
+
+  // repeated .state.WorldState states = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_states_size()); i < n; i++) {
+    const auto& repfield = this->_internal_states(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
-  if (from.roomid() != 0) {
-    set_roomid(from.roomid());
+
+  // uint32 baseTick = 4;
+  if (this->_internal_basetick() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_basetick(), target);
   }
-  if (from.health() != 0) {
-    set_health(from.health());
+
+  // repeated .state.StateDelta deltas = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_deltas_size()); i < n; i++) {
+    const auto& repfield = this->_internal_deltas(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
   }
-  if (from.fired() != 0) {
-    set_fired(from.fired());
+
+  // uint32 visible = 6;
+  if (this->_internal_visible() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_visible(), target);
   }
-  if (from.hit() != 0) {
-    set_hit(from.hit());
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  if (from.killpoint() != 0) {
-    set_killpoint(from.killpoint());
+  // @@protoc_insertion_point(serialize_to_array_end:state.RoomSnapshot)
+  return target;
+}
+
+size_t RoomSnapshot::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:state.RoomSnapshot)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .state.WorldState states = 3;
+  total_size += 1UL * this->_internal_states_size();
+  for (const auto& msg : this->_impl_.states_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  if (from.deathpoint() != 0) {
-    set_deathpoint(from.deathpoint());
+
+  // repeated .state.StateDelta deltas = 5;
+  total_size += 1UL * this->_internal_deltas_size();
+  for (const auto& msg : this->_impl_.deltas_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  if (from.animstate() != 0) {
-    set_animstate(from.animstate());
+
+  // int32 roomId = 1;
+  if (this->_internal_roomid() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_roomid());
+  }
+
+  // uint32 tick = 2;
+  if (this->_internal_tick() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_tick());
+  }
+
+  // uint32 baseTick = 4;
+  if (this->_internal_basetick() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_basetick());
+  }
+
+  // uint32 visible = 6;
+  if (this->_internal_visible() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_visible());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void WorldState::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:state.WorldState)
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomSnapshot::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoomSnapshot::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomSnapshot::GetClassData() const { return &_class_data_; }
+
+
+void RoomSnapshot::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoomSnapshot*>(&to_msg);
+  auto& from = static_cast<const RoomSnapshot&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:state.RoomSnapshot)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.states_.MergeFrom(from._impl_.states_);
+  _this->_impl_.deltas_.MergeFrom(from._impl_.deltas_);
+  if (from._internal_roomid() != 0) {
+    _this->_internal_set_roomid(from._internal_roomid());
+  }
+  if (from._internal_tick() != 0) {
+    _this->_internal_set_tick(from._internal_tick());
+  }
+  if (from._internal_basetick() != 0) {
+    _this->_internal_set_basetick(from._internal_basetick());
+  }
+  if (from._internal_visible() != 0) {
+    _this->_internal_set_visible(from._internal_visible());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RoomSnapshot::CopyFrom(const RoomSnapshot& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:state.RoomSnapshot)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void WorldState::CopyFrom(const WorldState& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:state.WorldState)
+bool RoomSnapshot::IsInitialized() const {
+  return true;
+}
+
+void RoomSnapshot::InternalSwap(RoomSnapshot* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.states_.InternalSwap(&other->_impl_.states_);
+  _impl_.deltas_.InternalSwap(&other->_impl_.deltas_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RoomSnapshot, _impl_.visible_)
+      + sizeof(RoomSnapshot::_impl_.visible_)
+      - PROTOBUF_FIELD_OFFSET(RoomSnapshot, _impl_.roomid_)>(
+          reinterpret_cast<char*>(&_impl_.roomid_),
+          reinterpret_cast<char*>(&other->_impl_.roomid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoomSnapshot::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_PlayState_2eproto_getter, &descriptor_table_PlayState_2eproto_once,
+      file_level_metadata_PlayState_2eproto[7]);
+}
+
+// ===================================================================
+
+class SnapshotAck::_Internal {
+ public:
+};
+
+SnapshotAck::SnapshotAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:state.SnapshotAck)
+}
+SnapshotAck::SnapshotAck(const SnapshotAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SnapshotAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tick_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.tick_ = from._impl_.tick_;
+  // @@protoc_insertion_point(copy_constructor:state.SnapshotAck)
+}
+
+inline void SnapshotAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tick_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SnapshotAck::~SnapshotAck() {
+  // @@protoc_insertion_point(destructor:state.SnapshotAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SnapshotAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SnapshotAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SnapshotAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:state.SnapshotAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.tick_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SnapshotAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 tick = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.tick_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SnapshotAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:state.SnapshotAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 tick = 1;
+  if (this->_internal_tick() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_tick(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:state.SnapshotAck)
+  return target;
+}
+
+size_t SnapshotAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:state.SnapshotAck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 tick = 1;
+  if (this->_internal_tick() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_tick());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SnapshotAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SnapshotAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SnapshotAck::GetClassData() const { return &_class_data_; }
+
+
+void SnapshotAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SnapshotAck*>(&to_msg);
+  auto& from = static_cast<const SnapshotAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:state.SnapshotAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_tick() != 0) {
+    _this->_internal_set_tick(from._internal_tick());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SnapshotAck::CopyFrom(const SnapshotAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:state.SnapshotAck)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool WorldState::IsInitialized() const {
+bool SnapshotAck::IsInitialized() const {
   return true;
 }
 
-void WorldState::Swap(WorldState* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void WorldState::InternalSwap(WorldState* other) {
+void SnapshotAck::InternalSwap(SnapshotAck* other) {
   using std::swap;
-  clntname_.Swap(&other->clntname_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(transform_, other->transform_);
-  swap(hitstate_, other->hitstate_);
-  swap(roomid_, other->roomid_);
-  swap(health_, other->health_);
-  swap(fired_, other->fired_);
-  swap(hit_, other->hit_);
-  swap(killpoint_, other->killpoint_);
-  swap(deathpoint_, other->deathpoint_);
-  swap(animstate_, other->animstate_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.tick_, other->_impl_.tick_);
 }
 
-::google::protobuf::Metadata WorldState::GetMetadata() const {
-  protobuf_PlayState_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_PlayState_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata SnapshotAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_PlayState_2eproto_getter, &descriptor_table_PlayState_2eproto_once,
+      file_level_metadata_PlayState_2eproto[8]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace state
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::state::Vector3Proto* Arena::CreateMaybeMessage< ::state::Vector3Proto >(Arena* arena) {
-  return Arena::CreateInternal< ::state::Vector3Proto >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::state::Vector3Proto*
+Arena::CreateMaybeMessage< ::state::Vector3Proto >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::state::Vector3Proto >(arena);
+}
+template<> PROTOBUF_NOINLINE ::state::TransformProto*
+Arena::CreateMaybeMessage< ::state::TransformProto >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::state::TransformProto >(arena);
+}
+template<> PROTOBUF_NOINLINE ::state::PlayState*
+Arena::CreateMaybeMessage< ::state::PlayState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::state::PlayState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::state::HitState*
+Arena::CreateMaybeMessage< ::state::HitState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::state::HitState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::state::WorldState*
+Arena::CreateMaybeMessage< ::state::WorldState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::state::WorldState >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::state::TransformProto* Arena::CreateMaybeMessage< ::state::TransformProto >(Arena* arena) {
-  return Arena::CreateInternal< ::state::TransformProto >(arena);
+template<> PROTOBUF_NOINLINE ::state::CompactTransform*
+Arena::CreateMaybeMessage< ::state::CompactTransform >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::state::CompactTransform >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::state::PlayState* Arena::CreateMaybeMessage< ::state::PlayState >(Arena* arena) {
-  return Arena::CreateInternal< ::state::PlayState >(arena);
+template<> PROTOBUF_NOINLINE ::state::StateDelta*
+Arena::CreateMaybeMessage< ::state::StateDelta >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::state::StateDelta >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::state::HitState* Arena::CreateMaybeMessage< ::state::HitState >(Arena* arena) {
-  return Arena::CreateInternal< ::state::HitState >(arena);
+template<> PROTOBUF_NOINLINE ::state::RoomSnapshot*
+Arena::CreateMaybeMessage< ::state::RoomSnapshot >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::state::RoomSnapshot >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::state::WorldState* Arena::CreateMaybeMessage< ::state::WorldState >(Arena* arena) {
-  return Arena::CreateInternal< ::state::WorldState >(arena);
+template<> PROTOBUF_NOINLINE ::state::SnapshotAck*
+Arena::CreateMaybeMessage< ::state::SnapshotAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::state::SnapshotAck >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
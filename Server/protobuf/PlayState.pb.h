@@ -1,110 +1,136 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: PlayState.proto
 
-#ifndef PROTOBUF_INCLUDED_PlayState_2eproto
-#define PROTOBUF_INCLUDED_PlayState_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_PlayState_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_PlayState_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_PlayState_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_PlayState_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_PlayState_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[5];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_PlayState_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-}  // namespace protobuf_PlayState_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_PlayState_2eproto;
 namespace state {
+class CompactTransform;
+struct CompactTransformDefaultTypeInternal;
+extern CompactTransformDefaultTypeInternal _CompactTransform_default_instance_;
 class HitState;
-class HitStateDefaultTypeInternal;
+struct HitStateDefaultTypeInternal;
 extern HitStateDefaultTypeInternal _HitState_default_instance_;
 class PlayState;
-class PlayStateDefaultTypeInternal;
+struct PlayStateDefaultTypeInternal;
 extern PlayStateDefaultTypeInternal _PlayState_default_instance_;
+class RoomSnapshot;
+struct RoomSnapshotDefaultTypeInternal;
+extern RoomSnapshotDefaultTypeInternal _RoomSnapshot_default_instance_;
+class SnapshotAck;
+struct SnapshotAckDefaultTypeInternal;
+extern SnapshotAckDefaultTypeInternal _SnapshotAck_default_instance_;
+class StateDelta;
+struct StateDeltaDefaultTypeInternal;
+extern StateDeltaDefaultTypeInternal _StateDelta_default_instance_;
 class TransformProto;
-class TransformProtoDefaultTypeInternal;
+struct TransformProtoDefaultTypeInternal;
 extern TransformProtoDefaultTypeInternal _TransformProto_default_instance_;
 class Vector3Proto;
-class Vector3ProtoDefaultTypeInternal;
+struct Vector3ProtoDefaultTypeInternal;
 extern Vector3ProtoDefaultTypeInternal _Vector3Proto_default_instance_;
 class WorldState;
-class WorldStateDefaultTypeInternal;
+struct WorldStateDefaultTypeInternal;
 extern WorldStateDefaultTypeInternal _WorldState_default_instance_;
 }  // namespace state
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
+template<> ::state::CompactTransform* Arena::CreateMaybeMessage<::state::CompactTransform>(Arena*);
 template<> ::state::HitState* Arena::CreateMaybeMessage<::state::HitState>(Arena*);
 template<> ::state::PlayState* Arena::CreateMaybeMessage<::state::PlayState>(Arena*);
+template<> ::state::RoomSnapshot* Arena::CreateMaybeMessage<::state::RoomSnapshot>(Arena*);
+template<> ::state::SnapshotAck* Arena::CreateMaybeMessage<::state::SnapshotAck>(Arena*);
+template<> ::state::StateDelta* Arena::CreateMaybeMessage<::state::StateDelta>(Arena*);
 template<> ::state::TransformProto* Arena::CreateMaybeMessage<::state::TransformProto>(Arena*);
 template<> ::state::Vector3Proto* Arena::CreateMaybeMessage<::state::Vector3Proto>(Arena*);
 template<> ::state::WorldState* Arena::CreateMaybeMessage<::state::WorldState>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 namespace state {
 
 // ===================================================================
 
-class Vector3Proto : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:state.Vector3Proto) */ {
+class Vector3Proto final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:state.Vector3Proto) */ {
  public:
-  Vector3Proto();
-  virtual ~Vector3Proto();
+  inline Vector3Proto() : Vector3Proto(nullptr) {}
+  ~Vector3Proto() override;
+  explicit PROTOBUF_CONSTEXPR Vector3Proto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Vector3Proto(const Vector3Proto& from);
-
-  inline Vector3Proto& operator=(const Vector3Proto& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Vector3Proto(Vector3Proto&& from) noexcept
     : Vector3Proto() {
     *this = ::std::move(from);
   }
 
+  inline Vector3Proto& operator=(const Vector3Proto& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Vector3Proto& operator=(Vector3Proto&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Vector3Proto& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Vector3Proto& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Vector3Proto* internal_default_instance() {
     return reinterpret_cast<const Vector3Proto*>(
                &_Vector3Proto_default_instance_);
@@ -112,116 +138,169 @@ class Vector3Proto : public ::google::protobuf::Message /* @@protoc_insertion_po
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(Vector3Proto* other);
   friend void swap(Vector3Proto& a, Vector3Proto& b) {
     a.Swap(&b);
   }
+  inline void Swap(Vector3Proto* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Vector3Proto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Vector3Proto* New() const final {
-    return CreateMaybeMessage<Vector3Proto>(NULL);
-  }
-
-  Vector3Proto* New(::google::protobuf::Arena* arena) const final {
+  Vector3Proto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Vector3Proto>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Vector3Proto& from);
-  void MergeFrom(const Vector3Proto& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Vector3Proto& from) {
+    Vector3Proto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Vector3Proto* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "state.Vector3Proto";
   }
+  protected:
+  explicit Vector3Proto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+    kZFieldNumber = 3,
+  };
   // float x = 1;
   void clear_x();
-  static const int kXFieldNumber = 1;
   float x() const;
   void set_x(float value);
+  private:
+  float _internal_x() const;
+  void _internal_set_x(float value);
+  public:
 
   // float y = 2;
   void clear_y();
-  static const int kYFieldNumber = 2;
   float y() const;
   void set_y(float value);
+  private:
+  float _internal_y() const;
+  void _internal_set_y(float value);
+  public:
 
   // float z = 3;
   void clear_z();
-  static const int kZFieldNumber = 3;
   float z() const;
   void set_z(float value);
+  private:
+  float _internal_z() const;
+  void _internal_set_z(float value);
+  public:
 
   // @@protoc_insertion_point(class_scope:state.Vector3Proto)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  float x_;
-  float y_;
-  float z_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_PlayState_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float x_;
+    float y_;
+    float z_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_PlayState_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TransformProto : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:state.TransformProto) */ {
+class TransformProto final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:state.TransformProto) */ {
  public:
-  TransformProto();
-  virtual ~TransformProto();
+  inline TransformProto() : TransformProto(nullptr) {}
+  ~TransformProto() override;
+  explicit PROTOBUF_CONSTEXPR TransformProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TransformProto(const TransformProto& from);
-
-  inline TransformProto& operator=(const TransformProto& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   TransformProto(TransformProto&& from) noexcept
     : TransformProto() {
     *this = ::std::move(from);
   }
 
+  inline TransformProto& operator=(const TransformProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline TransformProto& operator=(TransformProto&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TransformProto& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransformProto& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const TransformProto* internal_default_instance() {
     return reinterpret_cast<const TransformProto*>(
                &_TransformProto_default_instance_);
@@ -229,134 +308,196 @@ class TransformProto : public ::google::protobuf::Message /* @@protoc_insertion_
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(TransformProto* other);
   friend void swap(TransformProto& a, TransformProto& b) {
     a.Swap(&b);
   }
+  inline void Swap(TransformProto* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransformProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline TransformProto* New() const final {
-    return CreateMaybeMessage<TransformProto>(NULL);
-  }
-
-  TransformProto* New(::google::protobuf::Arena* arena) const final {
+  TransformProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TransformProto>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TransformProto& from);
-  void MergeFrom(const TransformProto& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransformProto& from) {
+    TransformProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TransformProto* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "state.TransformProto";
   }
+  protected:
+  explicit TransformProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPositionFieldNumber = 1,
+    kRotationFieldNumber = 2,
+    kScaleFieldNumber = 3,
+  };
   // .state.Vector3Proto position = 1;
   bool has_position() const;
-  void clear_position();
-  static const int kPositionFieldNumber = 1;
   private:
-  const ::state::Vector3Proto& _internal_position() const;
+  bool _internal_has_position() const;
   public:
+  void clear_position();
   const ::state::Vector3Proto& position() const;
-  ::state::Vector3Proto* release_position();
+  PROTOBUF_NODISCARD ::state::Vector3Proto* release_position();
   ::state::Vector3Proto* mutable_position();
   void set_allocated_position(::state::Vector3Proto* position);
+  private:
+  const ::state::Vector3Proto& _internal_position() const;
+  ::state::Vector3Proto* _internal_mutable_position();
+  public:
+  void unsafe_arena_set_allocated_position(
+      ::state::Vector3Proto* position);
+  ::state::Vector3Proto* unsafe_arena_release_position();
 
   // .state.Vector3Proto rotation = 2;
   bool has_rotation() const;
-  void clear_rotation();
-  static const int kRotationFieldNumber = 2;
   private:
-  const ::state::Vector3Proto& _internal_rotation() const;
+  bool _internal_has_rotation() const;
   public:
+  void clear_rotation();
   const ::state::Vector3Proto& rotation() const;
-  ::state::Vector3Proto* release_rotation();
+  PROTOBUF_NODISCARD ::state::Vector3Proto* release_rotation();
   ::state::Vector3Proto* mutable_rotation();
   void set_allocated_rotation(::state::Vector3Proto* rotation);
+  private:
+  const ::state::Vector3Proto& _internal_rotation() const;
+  ::state::Vector3Proto* _internal_mutable_rotation();
+  public:
+  void unsafe_arena_set_allocated_rotation(
+      ::state::Vector3Proto* rotation);
+  ::state::Vector3Proto* unsafe_arena_release_rotation();
 
   // .state.Vector3Proto scale = 3;
   bool has_scale() const;
-  void clear_scale();
-  static const int kScaleFieldNumber = 3;
   private:
-  const ::state::Vector3Proto& _internal_scale() const;
+  bool _internal_has_scale() const;
   public:
+  void clear_scale();
   const ::state::Vector3Proto& scale() const;
-  ::state::Vector3Proto* release_scale();
+  PROTOBUF_NODISCARD ::state::Vector3Proto* release_scale();
   ::state::Vector3Proto* mutable_scale();
   void set_allocated_scale(::state::Vector3Proto* scale);
+  private:
+  const ::state::Vector3Proto& _internal_scale() const;
+  ::state::Vector3Proto* _internal_mutable_scale();
+  public:
+  void unsafe_arena_set_allocated_scale(
+      ::state::Vector3Proto* scale);
+  ::state::Vector3Proto* unsafe_arena_release_scale();
 
   // @@protoc_insertion_point(class_scope:state.TransformProto)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::state::Vector3Proto* position_;
-  ::state::Vector3Proto* rotation_;
-  ::state::Vector3Proto* scale_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_PlayState_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::state::Vector3Proto* position_;
+    ::state::Vector3Proto* rotation_;
+    ::state::Vector3Proto* scale_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_PlayState_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PlayState : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:state.PlayState) */ {
+class PlayState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:state.PlayState) */ {
  public:
-  PlayState();
-  virtual ~PlayState();
+  inline PlayState() : PlayState(nullptr) {}
+  ~PlayState() override;
+  explicit PROTOBUF_CONSTEXPR PlayState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PlayState(const PlayState& from);
-
-  inline PlayState& operator=(const PlayState& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   PlayState(PlayState&& from) noexcept
     : PlayState() {
     *this = ::std::move(from);
   }
 
+  inline PlayState& operator=(const PlayState& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline PlayState& operator=(PlayState&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PlayState& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayState& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PlayState* internal_default_instance() {
     return reinterpret_cast<const PlayState*>(
                &_PlayState_default_instance_);
@@ -364,158 +505,238 @@ class PlayState : public ::google::protobuf::Message /* @@protoc_insertion_point
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(PlayState* other);
   friend void swap(PlayState& a, PlayState& b) {
     a.Swap(&b);
   }
+  inline void Swap(PlayState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PlayState* New() const final {
-    return CreateMaybeMessage<PlayState>(NULL);
-  }
-
-  PlayState* New(::google::protobuf::Arena* arena) const final {
+  PlayState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PlayState>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PlayState& from);
-  void MergeFrom(const PlayState& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayState& from) {
+    PlayState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PlayState* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "state.PlayState";
   }
+  protected:
+  explicit PlayState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kClntNameFieldNumber = 7,
+    kTransformFieldNumber = 1,
+    kAnimStateFieldNumber = 2,
+    kHealthFieldNumber = 3,
+    kKillCountFieldNumber = 4,
+    kDeathCountFieldNumber = 5,
+    kRoomIdFieldNumber = 6,
+    kSlotFieldNumber = 8,
+  };
   // string clntName = 7;
   void clear_clntname();
-  static const int kClntNameFieldNumber = 7;
-  const ::std::string& clntname() const;
-  void set_clntname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_clntname(::std::string&& value);
-  #endif
-  void set_clntname(const char* value);
-  void set_clntname(const char* value, size_t size);
-  ::std::string* mutable_clntname();
-  ::std::string* release_clntname();
-  void set_allocated_clntname(::std::string* clntname);
+  const std::string& clntname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clntname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clntname();
+  PROTOBUF_NODISCARD std::string* release_clntname();
+  void set_allocated_clntname(std::string* clntname);
+  private:
+  const std::string& _internal_clntname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clntname(const std::string& value);
+  std::string* _internal_mutable_clntname();
+  public:
 
   // .state.TransformProto transform = 1;
   bool has_transform() const;
-  void clear_transform();
-  static const int kTransformFieldNumber = 1;
   private:
-  const ::state::TransformProto& _internal_transform() const;
+  bool _internal_has_transform() const;
   public:
+  void clear_transform();
   const ::state::TransformProto& transform() const;
-  ::state::TransformProto* release_transform();
+  PROTOBUF_NODISCARD ::state::TransformProto* release_transform();
   ::state::TransformProto* mutable_transform();
   void set_allocated_transform(::state::TransformProto* transform);
+  private:
+  const ::state::TransformProto& _internal_transform() const;
+  ::state::TransformProto* _internal_mutable_transform();
+  public:
+  void unsafe_arena_set_allocated_transform(
+      ::state::TransformProto* transform);
+  ::state::TransformProto* unsafe_arena_release_transform();
 
   // int32 animState = 2;
   void clear_animstate();
-  static const int kAnimStateFieldNumber = 2;
-  ::google::protobuf::int32 animstate() const;
-  void set_animstate(::google::protobuf::int32 value);
+  int32_t animstate() const;
+  void set_animstate(int32_t value);
+  private:
+  int32_t _internal_animstate() const;
+  void _internal_set_animstate(int32_t value);
+  public:
 
   // int32 health = 3;
   void clear_health();
-  static const int kHealthFieldNumber = 3;
-  ::google::protobuf::int32 health() const;
-  void set_health(::google::protobuf::int32 value);
+  int32_t health() const;
+  void set_health(int32_t value);
+  private:
+  int32_t _internal_health() const;
+  void _internal_set_health(int32_t value);
+  public:
 
   // int32 killCount = 4;
   void clear_killcount();
-  static const int kKillCountFieldNumber = 4;
-  ::google::protobuf::int32 killcount() const;
-  void set_killcount(::google::protobuf::int32 value);
+  int32_t killcount() const;
+  void set_killcount(int32_t value);
+  private:
+  int32_t _internal_killcount() const;
+  void _internal_set_killcount(int32_t value);
+  public:
 
   // int32 deathCount = 5;
   void clear_deathcount();
-  static const int kDeathCountFieldNumber = 5;
-  ::google::protobuf::int32 deathcount() const;
-  void set_deathcount(::google::protobuf::int32 value);
+  int32_t deathcount() const;
+  void set_deathcount(int32_t value);
+  private:
+  int32_t _internal_deathcount() const;
+  void _internal_set_deathcount(int32_t value);
+  public:
 
   // int32 roomId = 6;
   void clear_roomid();
-  static const int kRoomIdFieldNumber = 6;
-  ::google::protobuf::int32 roomid() const;
-  void set_roomid(::google::protobuf::int32 value);
+  int32_t roomid() const;
+  void set_roomid(int32_t value);
+  private:
+  int32_t _internal_roomid() const;
+  void _internal_set_roomid(int32_t value);
+  public:
+
+  // int32 slot = 8;
+  void clear_slot();
+  int32_t slot() const;
+  void set_slot(int32_t value);
+  private:
+  int32_t _internal_slot() const;
+  void _internal_set_slot(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:state.PlayState)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr clntname_;
-  ::state::TransformProto* transform_;
-  ::google::protobuf::int32 animstate_;
-  ::google::protobuf::int32 health_;
-  ::google::protobuf::int32 killcount_;
-  ::google::protobuf::int32 deathcount_;
-  ::google::protobuf::int32 roomid_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_PlayState_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clntname_;
+    ::state::TransformProto* transform_;
+    int32_t animstate_;
+    int32_t health_;
+    int32_t killcount_;
+    int32_t deathcount_;
+    int32_t roomid_;
+    int32_t slot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_PlayState_2eproto;
 };
 // -------------------------------------------------------------------
 
-class HitState : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:state.HitState) */ {
+class HitState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:state.HitState) */ {
  public:
-  HitState();
-  virtual ~HitState();
+  inline HitState() : HitState(nullptr) {}
+  ~HitState() override;
+  explicit PROTOBUF_CONSTEXPR HitState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   HitState(const HitState& from);
-
-  inline HitState& operator=(const HitState& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   HitState(HitState&& from) noexcept
     : HitState() {
     *this = ::std::move(from);
   }
 
+  inline HitState& operator=(const HitState& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline HitState& operator=(HitState&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const HitState& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HitState& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const HitState* internal_default_instance() {
     return reinterpret_cast<const HitState*>(
                &_HitState_default_instance_);
@@ -523,132 +744,201 @@ class HitState : public ::google::protobuf::Message /* @@protoc_insertion_point(
   static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(HitState* other);
   friend void swap(HitState& a, HitState& b) {
     a.Swap(&b);
   }
+  inline void Swap(HitState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HitState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline HitState* New() const final {
-    return CreateMaybeMessage<HitState>(NULL);
-  }
-
-  HitState* New(::google::protobuf::Arena* arena) const final {
+  HitState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<HitState>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const HitState& from);
-  void MergeFrom(const HitState& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HitState& from) {
+    HitState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(HitState* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "state.HitState";
   }
+  protected:
+  explicit HitState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kFromFieldNumber = 1,
+    kToFieldNumber = 2,
+    kDamageFieldNumber = 3,
+    kFromSlotFieldNumber = 4,
+    kToSlotFieldNumber = 5,
+  };
   // string from = 1;
   void clear_from();
-  static const int kFromFieldNumber = 1;
-  const ::std::string& from() const;
-  void set_from(const ::std::string& value);
-  #if LANG_CXX11
-  void set_from(::std::string&& value);
-  #endif
-  void set_from(const char* value);
-  void set_from(const char* value, size_t size);
-  ::std::string* mutable_from();
-  ::std::string* release_from();
-  void set_allocated_from(::std::string* from);
+  const std::string& from() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_from(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_from();
+  PROTOBUF_NODISCARD std::string* release_from();
+  void set_allocated_from(std::string* from);
+  private:
+  const std::string& _internal_from() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_from(const std::string& value);
+  std::string* _internal_mutable_from();
+  public:
 
   // string to = 2;
   void clear_to();
-  static const int kToFieldNumber = 2;
-  const ::std::string& to() const;
-  void set_to(const ::std::string& value);
-  #if LANG_CXX11
-  void set_to(::std::string&& value);
-  #endif
-  void set_to(const char* value);
-  void set_to(const char* value, size_t size);
-  ::std::string* mutable_to();
-  ::std::string* release_to();
-  void set_allocated_to(::std::string* to);
+  const std::string& to() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_to(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_to();
+  PROTOBUF_NODISCARD std::string* release_to();
+  void set_allocated_to(std::string* to);
+  private:
+  const std::string& _internal_to() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_to(const std::string& value);
+  std::string* _internal_mutable_to();
+  public:
 
   // int32 damage = 3;
   void clear_damage();
-  static const int kDamageFieldNumber = 3;
-  ::google::protobuf::int32 damage() const;
-  void set_damage(::google::protobuf::int32 value);
+  int32_t damage() const;
+  void set_damage(int32_t value);
+  private:
+  int32_t _internal_damage() const;
+  void _internal_set_damage(int32_t value);
+  public:
+
+  // int32 fromSlot = 4;
+  void clear_fromslot();
+  int32_t fromslot() const;
+  void set_fromslot(int32_t value);
+  private:
+  int32_t _internal_fromslot() const;
+  void _internal_set_fromslot(int32_t value);
+  public:
+
+  // int32 toSlot = 5;
+  void clear_toslot();
+  int32_t toslot() const;
+  void set_toslot(int32_t value);
+  private:
+  int32_t _internal_toslot() const;
+  void _internal_set_toslot(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:state.HitState)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr from_;
-  ::google::protobuf::internal::ArenaStringPtr to_;
-  ::google::protobuf::int32 damage_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_PlayState_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr from_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr to_;
+    int32_t damage_;
+    int32_t fromslot_;
+    int32_t toslot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_PlayState_2eproto;
 };
 // -------------------------------------------------------------------
 
-class WorldState : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:state.WorldState) */ {
+class WorldState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:state.WorldState) */ {
  public:
-  WorldState();
-  virtual ~WorldState();
+  inline WorldState() : WorldState(nullptr) {}
+  ~WorldState() override;
+  explicit PROTOBUF_CONSTEXPR WorldState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   WorldState(const WorldState& from);
-
-  inline WorldState& operator=(const WorldState& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   WorldState(WorldState&& from) noexcept
     : WorldState() {
     *this = ::std::move(from);
   }
 
+  inline WorldState& operator=(const WorldState& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline WorldState& operator=(WorldState&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const WorldState& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WorldState& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const WorldState* internal_default_instance() {
     return reinterpret_cast<const WorldState*>(
                &_WorldState_default_instance_);
@@ -656,938 +946,2718 @@ class WorldState : public ::google::protobuf::Message /* @@protoc_insertion_poin
   static constexpr int kIndexInFileMessages =
     4;
 
-  void Swap(WorldState* other);
   friend void swap(WorldState& a, WorldState& b) {
     a.Swap(&b);
   }
+  inline void Swap(WorldState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WorldState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline WorldState* New() const final {
-    return CreateMaybeMessage<WorldState>(NULL);
-  }
-
-  WorldState* New(::google::protobuf::Arena* arena) const final {
+  WorldState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<WorldState>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const WorldState& from);
-  void MergeFrom(const WorldState& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WorldState& from) {
+    WorldState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(WorldState* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "state.WorldState";
   }
+  protected:
+  explicit WorldState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kClntNameFieldNumber = 2,
+    kTransformFieldNumber = 3,
+    kHitStateFieldNumber = 7,
+    kCompactTransformFieldNumber = 11,
+    kRoomIdFieldNumber = 1,
+    kHealthFieldNumber = 5,
+    kFiredFieldNumber = 4,
+    kHitFieldNumber = 6,
+    kKillPointFieldNumber = 8,
+    kDeathPointFieldNumber = 9,
+    kAnimStateFieldNumber = 10,
+    kSlotFieldNumber = 12,
+  };
   // string clntName = 2;
   void clear_clntname();
-  static const int kClntNameFieldNumber = 2;
-  const ::std::string& clntname() const;
-  void set_clntname(const ::std::string& value);
-  #if LANG_CXX11
-  void set_clntname(::std::string&& value);
-  #endif
-  void set_clntname(const char* value);
-  void set_clntname(const char* value, size_t size);
-  ::std::string* mutable_clntname();
-  ::std::string* release_clntname();
-  void set_allocated_clntname(::std::string* clntname);
+  const std::string& clntname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_clntname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_clntname();
+  PROTOBUF_NODISCARD std::string* release_clntname();
+  void set_allocated_clntname(std::string* clntname);
+  private:
+  const std::string& _internal_clntname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_clntname(const std::string& value);
+  std::string* _internal_mutable_clntname();
+  public:
 
   // .state.TransformProto transform = 3;
   bool has_transform() const;
-  void clear_transform();
-  static const int kTransformFieldNumber = 3;
   private:
-  const ::state::TransformProto& _internal_transform() const;
+  bool _internal_has_transform() const;
   public:
+  void clear_transform();
   const ::state::TransformProto& transform() const;
-  ::state::TransformProto* release_transform();
+  PROTOBUF_NODISCARD ::state::TransformProto* release_transform();
   ::state::TransformProto* mutable_transform();
   void set_allocated_transform(::state::TransformProto* transform);
+  private:
+  const ::state::TransformProto& _internal_transform() const;
+  ::state::TransformProto* _internal_mutable_transform();
+  public:
+  void unsafe_arena_set_allocated_transform(
+      ::state::TransformProto* transform);
+  ::state::TransformProto* unsafe_arena_release_transform();
 
   // .state.HitState hitState = 7;
   bool has_hitstate() const;
-  void clear_hitstate();
-  static const int kHitStateFieldNumber = 7;
   private:
-  const ::state::HitState& _internal_hitstate() const;
+  bool _internal_has_hitstate() const;
   public:
+  void clear_hitstate();
   const ::state::HitState& hitstate() const;
-  ::state::HitState* release_hitstate();
+  PROTOBUF_NODISCARD ::state::HitState* release_hitstate();
   ::state::HitState* mutable_hitstate();
   void set_allocated_hitstate(::state::HitState* hitstate);
+  private:
+  const ::state::HitState& _internal_hitstate() const;
+  ::state::HitState* _internal_mutable_hitstate();
+  public:
+  void unsafe_arena_set_allocated_hitstate(
+      ::state::HitState* hitstate);
+  ::state::HitState* unsafe_arena_release_hitstate();
+
+  // .state.CompactTransform compactTransform = 11;
+  bool has_compacttransform() const;
+  private:
+  bool _internal_has_compacttransform() const;
+  public:
+  void clear_compacttransform();
+  const ::state::CompactTransform& compacttransform() const;
+  PROTOBUF_NODISCARD ::state::CompactTransform* release_compacttransform();
+  ::state::CompactTransform* mutable_compacttransform();
+  void set_allocated_compacttransform(::state::CompactTransform* compacttransform);
+  private:
+  const ::state::CompactTransform& _internal_compacttransform() const;
+  ::state::CompactTransform* _internal_mutable_compacttransform();
+  public:
+  void unsafe_arena_set_allocated_compacttransform(
+      ::state::CompactTransform* compacttransform);
+  ::state::CompactTransform* unsafe_arena_release_compacttransform();
 
   // int32 roomId = 1;
   void clear_roomid();
-  static const int kRoomIdFieldNumber = 1;
-  ::google::protobuf::int32 roomid() const;
-  void set_roomid(::google::protobuf::int32 value);
+  int32_t roomid() const;
+  void set_roomid(int32_t value);
+  private:
+  int32_t _internal_roomid() const;
+  void _internal_set_roomid(int32_t value);
+  public:
 
   // int32 health = 5;
   void clear_health();
-  static const int kHealthFieldNumber = 5;
-  ::google::protobuf::int32 health() const;
-  void set_health(::google::protobuf::int32 value);
+  int32_t health() const;
+  void set_health(int32_t value);
+  private:
+  int32_t _internal_health() const;
+  void _internal_set_health(int32_t value);
+  public:
 
   // bool fired = 4;
   void clear_fired();
-  static const int kFiredFieldNumber = 4;
   bool fired() const;
   void set_fired(bool value);
+  private:
+  bool _internal_fired() const;
+  void _internal_set_fired(bool value);
+  public:
 
   // bool hit = 6;
   void clear_hit();
-  static const int kHitFieldNumber = 6;
   bool hit() const;
   void set_hit(bool value);
+  private:
+  bool _internal_hit() const;
+  void _internal_set_hit(bool value);
+  public:
 
   // int32 killPoint = 8;
   void clear_killpoint();
-  static const int kKillPointFieldNumber = 8;
-  ::google::protobuf::int32 killpoint() const;
-  void set_killpoint(::google::protobuf::int32 value);
+  int32_t killpoint() const;
+  void set_killpoint(int32_t value);
+  private:
+  int32_t _internal_killpoint() const;
+  void _internal_set_killpoint(int32_t value);
+  public:
 
   // int32 deathPoint = 9;
   void clear_deathpoint();
-  static const int kDeathPointFieldNumber = 9;
-  ::google::protobuf::int32 deathpoint() const;
-  void set_deathpoint(::google::protobuf::int32 value);
+  int32_t deathpoint() const;
+  void set_deathpoint(int32_t value);
+  private:
+  int32_t _internal_deathpoint() const;
+  void _internal_set_deathpoint(int32_t value);
+  public:
 
   // int32 animState = 10;
   void clear_animstate();
-  static const int kAnimStateFieldNumber = 10;
-  ::google::protobuf::int32 animstate() const;
-  void set_animstate(::google::protobuf::int32 value);
+  int32_t animstate() const;
+  void set_animstate(int32_t value);
+  private:
+  int32_t _internal_animstate() const;
+  void _internal_set_animstate(int32_t value);
+  public:
+
+  // int32 slot = 12;
+  void clear_slot();
+  int32_t slot() const;
+  void set_slot(int32_t value);
+  private:
+  int32_t _internal_slot() const;
+  void _internal_set_slot(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:state.WorldState)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr clntname_;
-  ::state::TransformProto* transform_;
-  ::state::HitState* hitstate_;
-  ::google::protobuf::int32 roomid_;
-  ::google::protobuf::int32 health_;
-  bool fired_;
-  bool hit_;
-  ::google::protobuf::int32 killpoint_;
-  ::google::protobuf::int32 deathpoint_;
-  ::google::protobuf::int32 animstate_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_PlayState_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr clntname_;
+    ::state::TransformProto* transform_;
+    ::state::HitState* hitstate_;
+    ::state::CompactTransform* compacttransform_;
+    int32_t roomid_;
+    int32_t health_;
+    bool fired_;
+    bool hit_;
+    int32_t killpoint_;
+    int32_t deathpoint_;
+    int32_t animstate_;
+    int32_t slot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_PlayState_2eproto;
 };
-// ===================================================================
-
+// -------------------------------------------------------------------
 
-// ===================================================================
+class CompactTransform final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:state.CompactTransform) */ {
+ public:
+  inline CompactTransform() : CompactTransform(nullptr) {}
+  ~CompactTransform() override;
+  explicit PROTOBUF_CONSTEXPR CompactTransform(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Vector3Proto
+  CompactTransform(const CompactTransform& from);
+  CompactTransform(CompactTransform&& from) noexcept
+    : CompactTransform() {
+    *this = ::std::move(from);
+  }
 
-// float x = 1;
-inline void Vector3Proto::clear_x() {
-  x_ = 0;
-}
-inline float Vector3Proto::x() const {
-  // @@protoc_insertion_point(field_get:state.Vector3Proto.x)
-  return x_;
-}
-inline void Vector3Proto::set_x(float value) {
-  
-  x_ = value;
-  // @@protoc_insertion_point(field_set:state.Vector3Proto.x)
-}
+  inline CompactTransform& operator=(const CompactTransform& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CompactTransform& operator=(CompactTransform&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// float y = 2;
-inline void Vector3Proto::clear_y() {
-  y_ = 0;
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CompactTransform& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CompactTransform* internal_default_instance() {
+    return reinterpret_cast<const CompactTransform*>(
+               &_CompactTransform_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(CompactTransform& a, CompactTransform& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CompactTransform* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CompactTransform* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CompactTransform* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CompactTransform>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CompactTransform& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CompactTransform& from) {
+    CompactTransform::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CompactTransform* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "state.CompactTransform";
+  }
+  protected:
+  explicit CompactTransform(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kScaleFieldNumber = 3,
+    kPositionFieldNumber = 1,
+    kRotationFieldNumber = 2,
+  };
+  // .state.Vector3Proto scale = 3;
+  bool has_scale() const;
+  private:
+  bool _internal_has_scale() const;
+  public:
+  void clear_scale();
+  const ::state::Vector3Proto& scale() const;
+  PROTOBUF_NODISCARD ::state::Vector3Proto* release_scale();
+  ::state::Vector3Proto* mutable_scale();
+  void set_allocated_scale(::state::Vector3Proto* scale);
+  private:
+  const ::state::Vector3Proto& _internal_scale() const;
+  ::state::Vector3Proto* _internal_mutable_scale();
+  public:
+  void unsafe_arena_set_allocated_scale(
+      ::state::Vector3Proto* scale);
+  ::state::Vector3Proto* unsafe_arena_release_scale();
+
+  // optional fixed64 position = 1;
+  bool has_position() const;
+  private:
+  bool _internal_has_position() const;
+  public:
+  void clear_position();
+  uint64_t position() const;
+  void set_position(uint64_t value);
+  private:
+  uint64_t _internal_position() const;
+  void _internal_set_position(uint64_t value);
+  public:
+
+  // optional fixed32 rotation = 2;
+  bool has_rotation() const;
+  private:
+  bool _internal_has_rotation() const;
+  public:
+  void clear_rotation();
+  uint32_t rotation() const;
+  void set_rotation(uint32_t value);
+  private:
+  uint32_t _internal_rotation() const;
+  void _internal_set_rotation(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:state.CompactTransform)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::state::Vector3Proto* scale_;
+    uint64_t position_;
+    uint32_t rotation_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_PlayState_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StateDelta final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:state.StateDelta) */ {
+ public:
+  inline StateDelta() : StateDelta(nullptr) {}
+  ~StateDelta() override;
+  explicit PROTOBUF_CONSTEXPR StateDelta(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StateDelta(const StateDelta& from);
+  StateDelta(StateDelta&& from) noexcept
+    : StateDelta() {
+    *this = ::std::move(from);
+  }
+
+  inline StateDelta& operator=(const StateDelta& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StateDelta& operator=(StateDelta&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StateDelta& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StateDelta* internal_default_instance() {
+    return reinterpret_cast<const StateDelta*>(
+               &_StateDelta_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(StateDelta& a, StateDelta& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StateDelta* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StateDelta* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StateDelta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StateDelta>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StateDelta& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StateDelta& from) {
+    StateDelta::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StateDelta* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "state.StateDelta";
+  }
+  protected:
+  explicit StateDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStateFieldNumber = 3,
+    kEntityFieldNumber = 1,
+    kChangedFieldNumber = 2,
+  };
+  // .state.WorldState state = 3;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  const ::state::WorldState& state() const;
+  PROTOBUF_NODISCARD ::state::WorldState* release_state();
+  ::state::WorldState* mutable_state();
+  void set_allocated_state(::state::WorldState* state);
+  private:
+  const ::state::WorldState& _internal_state() const;
+  ::state::WorldState* _internal_mutable_state();
+  public:
+  void unsafe_arena_set_allocated_state(
+      ::state::WorldState* state);
+  ::state::WorldState* unsafe_arena_release_state();
+
+  // int32 entity = 1;
+  void clear_entity();
+  int32_t entity() const;
+  void set_entity(int32_t value);
+  private:
+  int32_t _internal_entity() const;
+  void _internal_set_entity(int32_t value);
+  public:
+
+  // uint32 changed = 2;
+  void clear_changed();
+  uint32_t changed() const;
+  void set_changed(uint32_t value);
+  private:
+  uint32_t _internal_changed() const;
+  void _internal_set_changed(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:state.StateDelta)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::state::WorldState* state_;
+    int32_t entity_;
+    uint32_t changed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_PlayState_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoomSnapshot final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:state.RoomSnapshot) */ {
+ public:
+  inline RoomSnapshot() : RoomSnapshot(nullptr) {}
+  ~RoomSnapshot() override;
+  explicit PROTOBUF_CONSTEXPR RoomSnapshot(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoomSnapshot(const RoomSnapshot& from);
+  RoomSnapshot(RoomSnapshot&& from) noexcept
+    : RoomSnapshot() {
+    *this = ::std::move(from);
+  }
+
+  inline RoomSnapshot& operator=(const RoomSnapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoomSnapshot& operator=(RoomSnapshot&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomSnapshot& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoomSnapshot* internal_default_instance() {
+    return reinterpret_cast<const RoomSnapshot*>(
+               &_RoomSnapshot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(RoomSnapshot& a, RoomSnapshot& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoomSnapshot* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomSnapshot* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoomSnapshot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoomSnapshot>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoomSnapshot& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomSnapshot& from) {
+    RoomSnapshot::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoomSnapshot* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "state.RoomSnapshot";
+  }
+  protected:
+  explicit RoomSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStatesFieldNumber = 3,
+    kDeltasFieldNumber = 5,
+    kRoomIdFieldNumber = 1,
+    kTickFieldNumber = 2,
+    kBaseTickFieldNumber = 4,
+    kVisibleFieldNumber = 6,
+  };
+  // repeated .state.WorldState states = 3;
+  int states_size() const;
+  private:
+  int _internal_states_size() const;
+  public:
+  void clear_states();
+  ::state::WorldState* mutable_states(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::state::WorldState >*
+      mutable_states();
+  private:
+  const ::state::WorldState& _internal_states(int index) const;
+  ::state::WorldState* _internal_add_states();
+  public:
+  const ::state::WorldState& states(int index) const;
+  ::state::WorldState* add_states();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::state::WorldState >&
+      states() const;
+
+  // repeated .state.StateDelta deltas = 5;
+  int deltas_size() const;
+  private:
+  int _internal_deltas_size() const;
+  public:
+  void clear_deltas();
+  ::state::StateDelta* mutable_deltas(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::state::StateDelta >*
+      mutable_deltas();
+  private:
+  const ::state::StateDelta& _internal_deltas(int index) const;
+  ::state::StateDelta* _internal_add_deltas();
+  public:
+  const ::state::StateDelta& deltas(int index) const;
+  ::state::StateDelta* add_deltas();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::state::StateDelta >&
+      deltas() const;
+
+  // int32 roomId = 1;
+  void clear_roomid();
+  int32_t roomid() const;
+  void set_roomid(int32_t value);
+  private:
+  int32_t _internal_roomid() const;
+  void _internal_set_roomid(int32_t value);
+  public:
+
+  // uint32 tick = 2;
+  void clear_tick();
+  uint32_t tick() const;
+  void set_tick(uint32_t value);
+  private:
+  uint32_t _internal_tick() const;
+  void _internal_set_tick(uint32_t value);
+  public:
+
+  // uint32 baseTick = 4;
+  void clear_basetick();
+  uint32_t basetick() const;
+  void set_basetick(uint32_t value);
+  private:
+  uint32_t _internal_basetick() const;
+  void _internal_set_basetick(uint32_t value);
+  public:
+
+  // uint32 visible = 6;
+  void clear_visible();
+  uint32_t visible() const;
+  void set_visible(uint32_t value);
+  private:
+  uint32_t _internal_visible() const;
+  void _internal_set_visible(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:state.RoomSnapshot)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::state::WorldState > states_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::state::StateDelta > deltas_;
+    int32_t roomid_;
+    uint32_t tick_;
+    uint32_t basetick_;
+    uint32_t visible_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_PlayState_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SnapshotAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:state.SnapshotAck) */ {
+ public:
+  inline SnapshotAck() : SnapshotAck(nullptr) {}
+  ~SnapshotAck() override;
+  explicit PROTOBUF_CONSTEXPR SnapshotAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SnapshotAck(const SnapshotAck& from);
+  SnapshotAck(SnapshotAck&& from) noexcept
+    : SnapshotAck() {
+    *this = ::std::move(from);
+  }
+
+  inline SnapshotAck& operator=(const SnapshotAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SnapshotAck& operator=(SnapshotAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SnapshotAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SnapshotAck* internal_default_instance() {
+    return reinterpret_cast<const SnapshotAck*>(
+               &_SnapshotAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(SnapshotAck& a, SnapshotAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SnapshotAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SnapshotAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SnapshotAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SnapshotAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SnapshotAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SnapshotAck& from) {
+    SnapshotAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SnapshotAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "state.SnapshotAck";
+  }
+  protected:
+  explicit SnapshotAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTickFieldNumber = 1,
+  };
+  // uint32 tick = 1;
+  void clear_tick();
+  uint32_t tick() const;
+  void set_tick(uint32_t value);
+  private:
+  uint32_t _internal_tick() const;
+  void _internal_set_tick(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:state.SnapshotAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t tick_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_PlayState_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Vector3Proto
+
+// float x = 1;
+inline void Vector3Proto::clear_x() {
+  _impl_.x_ = 0;
+}
+inline float Vector3Proto::_internal_x() const {
+  return _impl_.x_;
+}
+inline float Vector3Proto::x() const {
+  // @@protoc_insertion_point(field_get:state.Vector3Proto.x)
+  return _internal_x();
+}
+inline void Vector3Proto::_internal_set_x(float value) {
+  
+  _impl_.x_ = value;
+}
+inline void Vector3Proto::set_x(float value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:state.Vector3Proto.x)
+}
+
+// float y = 2;
+inline void Vector3Proto::clear_y() {
+  _impl_.y_ = 0;
+}
+inline float Vector3Proto::_internal_y() const {
+  return _impl_.y_;
+}
+inline float Vector3Proto::y() const {
+  // @@protoc_insertion_point(field_get:state.Vector3Proto.y)
+  return _internal_y();
+}
+inline void Vector3Proto::_internal_set_y(float value) {
+  
+  _impl_.y_ = value;
+}
+inline void Vector3Proto::set_y(float value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:state.Vector3Proto.y)
+}
+
+// float z = 3;
+inline void Vector3Proto::clear_z() {
+  _impl_.z_ = 0;
+}
+inline float Vector3Proto::_internal_z() const {
+  return _impl_.z_;
+}
+inline float Vector3Proto::z() const {
+  // @@protoc_insertion_point(field_get:state.Vector3Proto.z)
+  return _internal_z();
+}
+inline void Vector3Proto::_internal_set_z(float value) {
+  
+  _impl_.z_ = value;
+}
+inline void Vector3Proto::set_z(float value) {
+  _internal_set_z(value);
+  // @@protoc_insertion_point(field_set:state.Vector3Proto.z)
+}
+
+// -------------------------------------------------------------------
+
+// TransformProto
+
+// .state.Vector3Proto position = 1;
+inline bool TransformProto::_internal_has_position() const {
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
+}
+inline bool TransformProto::has_position() const {
+  return _internal_has_position();
+}
+inline void TransformProto::clear_position() {
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
+  }
+  _impl_.position_ = nullptr;
+}
+inline const ::state::Vector3Proto& TransformProto::_internal_position() const {
+  const ::state::Vector3Proto* p = _impl_.position_;
+  return p != nullptr ? *p : reinterpret_cast<const ::state::Vector3Proto&>(
+      ::state::_Vector3Proto_default_instance_);
+}
+inline const ::state::Vector3Proto& TransformProto::position() const {
+  // @@protoc_insertion_point(field_get:state.TransformProto.position)
+  return _internal_position();
+}
+inline void TransformProto::unsafe_arena_set_allocated_position(
+    ::state::Vector3Proto* position) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
+  }
+  _impl_.position_ = position;
+  if (position) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:state.TransformProto.position)
+}
+inline ::state::Vector3Proto* TransformProto::release_position() {
+  
+  ::state::Vector3Proto* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::state::Vector3Proto* TransformProto::unsafe_arena_release_position() {
+  // @@protoc_insertion_point(field_release:state.TransformProto.position)
+  
+  ::state::Vector3Proto* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+  return temp;
+}
+inline ::state::Vector3Proto* TransformProto::_internal_mutable_position() {
+  
+  if (_impl_.position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::state::Vector3Proto>(GetArenaForAllocation());
+    _impl_.position_ = p;
+  }
+  return _impl_.position_;
+}
+inline ::state::Vector3Proto* TransformProto::mutable_position() {
+  ::state::Vector3Proto* _msg = _internal_mutable_position();
+  // @@protoc_insertion_point(field_mutable:state.TransformProto.position)
+  return _msg;
+}
+inline void TransformProto::set_allocated_position(::state::Vector3Proto* position) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.position_;
+  }
+  if (position) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(position);
+    if (message_arena != submessage_arena) {
+      position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, position, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.position_ = position;
+  // @@protoc_insertion_point(field_set_allocated:state.TransformProto.position)
+}
+
+// .state.Vector3Proto rotation = 2;
+inline bool TransformProto::_internal_has_rotation() const {
+  return this != internal_default_instance() && _impl_.rotation_ != nullptr;
+}
+inline bool TransformProto::has_rotation() const {
+  return _internal_has_rotation();
+}
+inline void TransformProto::clear_rotation() {
+  if (GetArenaForAllocation() == nullptr && _impl_.rotation_ != nullptr) {
+    delete _impl_.rotation_;
+  }
+  _impl_.rotation_ = nullptr;
+}
+inline const ::state::Vector3Proto& TransformProto::_internal_rotation() const {
+  const ::state::Vector3Proto* p = _impl_.rotation_;
+  return p != nullptr ? *p : reinterpret_cast<const ::state::Vector3Proto&>(
+      ::state::_Vector3Proto_default_instance_);
+}
+inline const ::state::Vector3Proto& TransformProto::rotation() const {
+  // @@protoc_insertion_point(field_get:state.TransformProto.rotation)
+  return _internal_rotation();
+}
+inline void TransformProto::unsafe_arena_set_allocated_rotation(
+    ::state::Vector3Proto* rotation) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rotation_);
+  }
+  _impl_.rotation_ = rotation;
+  if (rotation) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:state.TransformProto.rotation)
+}
+inline ::state::Vector3Proto* TransformProto::release_rotation() {
+  
+  ::state::Vector3Proto* temp = _impl_.rotation_;
+  _impl_.rotation_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::state::Vector3Proto* TransformProto::unsafe_arena_release_rotation() {
+  // @@protoc_insertion_point(field_release:state.TransformProto.rotation)
+  
+  ::state::Vector3Proto* temp = _impl_.rotation_;
+  _impl_.rotation_ = nullptr;
+  return temp;
+}
+inline ::state::Vector3Proto* TransformProto::_internal_mutable_rotation() {
+  
+  if (_impl_.rotation_ == nullptr) {
+    auto* p = CreateMaybeMessage<::state::Vector3Proto>(GetArenaForAllocation());
+    _impl_.rotation_ = p;
+  }
+  return _impl_.rotation_;
+}
+inline ::state::Vector3Proto* TransformProto::mutable_rotation() {
+  ::state::Vector3Proto* _msg = _internal_mutable_rotation();
+  // @@protoc_insertion_point(field_mutable:state.TransformProto.rotation)
+  return _msg;
+}
+inline void TransformProto::set_allocated_rotation(::state::Vector3Proto* rotation) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rotation_;
+  }
+  if (rotation) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rotation);
+    if (message_arena != submessage_arena) {
+      rotation = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rotation, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.rotation_ = rotation;
+  // @@protoc_insertion_point(field_set_allocated:state.TransformProto.rotation)
+}
+
+// .state.Vector3Proto scale = 3;
+inline bool TransformProto::_internal_has_scale() const {
+  return this != internal_default_instance() && _impl_.scale_ != nullptr;
+}
+inline bool TransformProto::has_scale() const {
+  return _internal_has_scale();
+}
+inline void TransformProto::clear_scale() {
+  if (GetArenaForAllocation() == nullptr && _impl_.scale_ != nullptr) {
+    delete _impl_.scale_;
+  }
+  _impl_.scale_ = nullptr;
+}
+inline const ::state::Vector3Proto& TransformProto::_internal_scale() const {
+  const ::state::Vector3Proto* p = _impl_.scale_;
+  return p != nullptr ? *p : reinterpret_cast<const ::state::Vector3Proto&>(
+      ::state::_Vector3Proto_default_instance_);
+}
+inline const ::state::Vector3Proto& TransformProto::scale() const {
+  // @@protoc_insertion_point(field_get:state.TransformProto.scale)
+  return _internal_scale();
+}
+inline void TransformProto::unsafe_arena_set_allocated_scale(
+    ::state::Vector3Proto* scale) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.scale_);
+  }
+  _impl_.scale_ = scale;
+  if (scale) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:state.TransformProto.scale)
+}
+inline ::state::Vector3Proto* TransformProto::release_scale() {
+  
+  ::state::Vector3Proto* temp = _impl_.scale_;
+  _impl_.scale_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::state::Vector3Proto* TransformProto::unsafe_arena_release_scale() {
+  // @@protoc_insertion_point(field_release:state.TransformProto.scale)
+  
+  ::state::Vector3Proto* temp = _impl_.scale_;
+  _impl_.scale_ = nullptr;
+  return temp;
+}
+inline ::state::Vector3Proto* TransformProto::_internal_mutable_scale() {
+  
+  if (_impl_.scale_ == nullptr) {
+    auto* p = CreateMaybeMessage<::state::Vector3Proto>(GetArenaForAllocation());
+    _impl_.scale_ = p;
+  }
+  return _impl_.scale_;
+}
+inline ::state::Vector3Proto* TransformProto::mutable_scale() {
+  ::state::Vector3Proto* _msg = _internal_mutable_scale();
+  // @@protoc_insertion_point(field_mutable:state.TransformProto.scale)
+  return _msg;
+}
+inline void TransformProto::set_allocated_scale(::state::Vector3Proto* scale) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.scale_;
+  }
+  if (scale) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(scale);
+    if (message_arena != submessage_arena) {
+      scale = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, scale, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.scale_ = scale;
+  // @@protoc_insertion_point(field_set_allocated:state.TransformProto.scale)
+}
+
+// -------------------------------------------------------------------
+
+// PlayState
+
+// .state.TransformProto transform = 1;
+inline bool PlayState::_internal_has_transform() const {
+  return this != internal_default_instance() && _impl_.transform_ != nullptr;
+}
+inline bool PlayState::has_transform() const {
+  return _internal_has_transform();
+}
+inline void PlayState::clear_transform() {
+  if (GetArenaForAllocation() == nullptr && _impl_.transform_ != nullptr) {
+    delete _impl_.transform_;
+  }
+  _impl_.transform_ = nullptr;
+}
+inline const ::state::TransformProto& PlayState::_internal_transform() const {
+  const ::state::TransformProto* p = _impl_.transform_;
+  return p != nullptr ? *p : reinterpret_cast<const ::state::TransformProto&>(
+      ::state::_TransformProto_default_instance_);
+}
+inline const ::state::TransformProto& PlayState::transform() const {
+  // @@protoc_insertion_point(field_get:state.PlayState.transform)
+  return _internal_transform();
+}
+inline void PlayState::unsafe_arena_set_allocated_transform(
+    ::state::TransformProto* transform) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.transform_);
+  }
+  _impl_.transform_ = transform;
+  if (transform) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:state.PlayState.transform)
+}
+inline ::state::TransformProto* PlayState::release_transform() {
+  
+  ::state::TransformProto* temp = _impl_.transform_;
+  _impl_.transform_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::state::TransformProto* PlayState::unsafe_arena_release_transform() {
+  // @@protoc_insertion_point(field_release:state.PlayState.transform)
+  
+  ::state::TransformProto* temp = _impl_.transform_;
+  _impl_.transform_ = nullptr;
+  return temp;
+}
+inline ::state::TransformProto* PlayState::_internal_mutable_transform() {
+  
+  if (_impl_.transform_ == nullptr) {
+    auto* p = CreateMaybeMessage<::state::TransformProto>(GetArenaForAllocation());
+    _impl_.transform_ = p;
+  }
+  return _impl_.transform_;
+}
+inline ::state::TransformProto* PlayState::mutable_transform() {
+  ::state::TransformProto* _msg = _internal_mutable_transform();
+  // @@protoc_insertion_point(field_mutable:state.PlayState.transform)
+  return _msg;
+}
+inline void PlayState::set_allocated_transform(::state::TransformProto* transform) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.transform_;
+  }
+  if (transform) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(transform);
+    if (message_arena != submessage_arena) {
+      transform = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, transform, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.transform_ = transform;
+  // @@protoc_insertion_point(field_set_allocated:state.PlayState.transform)
+}
+
+// int32 animState = 2;
+inline void PlayState::clear_animstate() {
+  _impl_.animstate_ = 0;
+}
+inline int32_t PlayState::_internal_animstate() const {
+  return _impl_.animstate_;
+}
+inline int32_t PlayState::animstate() const {
+  // @@protoc_insertion_point(field_get:state.PlayState.animState)
+  return _internal_animstate();
+}
+inline void PlayState::_internal_set_animstate(int32_t value) {
+  
+  _impl_.animstate_ = value;
+}
+inline void PlayState::set_animstate(int32_t value) {
+  _internal_set_animstate(value);
+  // @@protoc_insertion_point(field_set:state.PlayState.animState)
+}
+
+// int32 health = 3;
+inline void PlayState::clear_health() {
+  _impl_.health_ = 0;
+}
+inline int32_t PlayState::_internal_health() const {
+  return _impl_.health_;
+}
+inline int32_t PlayState::health() const {
+  // @@protoc_insertion_point(field_get:state.PlayState.health)
+  return _internal_health();
+}
+inline void PlayState::_internal_set_health(int32_t value) {
+  
+  _impl_.health_ = value;
+}
+inline void PlayState::set_health(int32_t value) {
+  _internal_set_health(value);
+  // @@protoc_insertion_point(field_set:state.PlayState.health)
+}
+
+// int32 killCount = 4;
+inline void PlayState::clear_killcount() {
+  _impl_.killcount_ = 0;
+}
+inline int32_t PlayState::_internal_killcount() const {
+  return _impl_.killcount_;
+}
+inline int32_t PlayState::killcount() const {
+  // @@protoc_insertion_point(field_get:state.PlayState.killCount)
+  return _internal_killcount();
+}
+inline void PlayState::_internal_set_killcount(int32_t value) {
+  
+  _impl_.killcount_ = value;
+}
+inline void PlayState::set_killcount(int32_t value) {
+  _internal_set_killcount(value);
+  // @@protoc_insertion_point(field_set:state.PlayState.killCount)
+}
+
+// int32 deathCount = 5;
+inline void PlayState::clear_deathcount() {
+  _impl_.deathcount_ = 0;
+}
+inline int32_t PlayState::_internal_deathcount() const {
+  return _impl_.deathcount_;
+}
+inline int32_t PlayState::deathcount() const {
+  // @@protoc_insertion_point(field_get:state.PlayState.deathCount)
+  return _internal_deathcount();
+}
+inline void PlayState::_internal_set_deathcount(int32_t value) {
+  
+  _impl_.deathcount_ = value;
+}
+inline void PlayState::set_deathcount(int32_t value) {
+  _internal_set_deathcount(value);
+  // @@protoc_insertion_point(field_set:state.PlayState.deathCount)
+}
+
+// int32 roomId = 6;
+inline void PlayState::clear_roomid() {
+  _impl_.roomid_ = 0;
+}
+inline int32_t PlayState::_internal_roomid() const {
+  return _impl_.roomid_;
+}
+inline int32_t PlayState::roomid() const {
+  // @@protoc_insertion_point(field_get:state.PlayState.roomId)
+  return _internal_roomid();
+}
+inline void PlayState::_internal_set_roomid(int32_t value) {
+  
+  _impl_.roomid_ = value;
+}
+inline void PlayState::set_roomid(int32_t value) {
+  _internal_set_roomid(value);
+  // @@protoc_insertion_point(field_set:state.PlayState.roomId)
+}
+
+// string clntName = 7;
+inline void PlayState::clear_clntname() {
+  _impl_.clntname_.ClearToEmpty();
+}
+inline const std::string& PlayState::clntname() const {
+  // @@protoc_insertion_point(field_get:state.PlayState.clntName)
+  return _internal_clntname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PlayState::set_clntname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clntname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:state.PlayState.clntName)
+}
+inline std::string* PlayState::mutable_clntname() {
+  std::string* _s = _internal_mutable_clntname();
+  // @@protoc_insertion_point(field_mutable:state.PlayState.clntName)
+  return _s;
+}
+inline const std::string& PlayState::_internal_clntname() const {
+  return _impl_.clntname_.Get();
+}
+inline void PlayState::_internal_set_clntname(const std::string& value) {
+  
+  _impl_.clntname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PlayState::_internal_mutable_clntname() {
+  
+  return _impl_.clntname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PlayState::release_clntname() {
+  // @@protoc_insertion_point(field_release:state.PlayState.clntName)
+  return _impl_.clntname_.Release();
+}
+inline void PlayState::set_allocated_clntname(std::string* clntname) {
+  if (clntname != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.clntname_.SetAllocated(clntname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clntname_.IsDefault()) {
+    _impl_.clntname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:state.PlayState.clntName)
+}
+
+// int32 slot = 8;
+inline void PlayState::clear_slot() {
+  _impl_.slot_ = 0;
+}
+inline int32_t PlayState::_internal_slot() const {
+  return _impl_.slot_;
+}
+inline int32_t PlayState::slot() const {
+  // @@protoc_insertion_point(field_get:state.PlayState.slot)
+  return _internal_slot();
+}
+inline void PlayState::_internal_set_slot(int32_t value) {
+  
+  _impl_.slot_ = value;
+}
+inline void PlayState::set_slot(int32_t value) {
+  _internal_set_slot(value);
+  // @@protoc_insertion_point(field_set:state.PlayState.slot)
+}
+
+// -------------------------------------------------------------------
+
+// HitState
+
+// string from = 1;
+inline void HitState::clear_from() {
+  _impl_.from_.ClearToEmpty();
+}
+inline const std::string& HitState::from() const {
+  // @@protoc_insertion_point(field_get:state.HitState.from)
+  return _internal_from();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HitState::set_from(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.from_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:state.HitState.from)
+}
+inline std::string* HitState::mutable_from() {
+  std::string* _s = _internal_mutable_from();
+  // @@protoc_insertion_point(field_mutable:state.HitState.from)
+  return _s;
+}
+inline const std::string& HitState::_internal_from() const {
+  return _impl_.from_.Get();
+}
+inline void HitState::_internal_set_from(const std::string& value) {
+  
+  _impl_.from_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HitState::_internal_mutable_from() {
+  
+  return _impl_.from_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HitState::release_from() {
+  // @@protoc_insertion_point(field_release:state.HitState.from)
+  return _impl_.from_.Release();
+}
+inline void HitState::set_allocated_from(std::string* from) {
+  if (from != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.from_.SetAllocated(from, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.from_.IsDefault()) {
+    _impl_.from_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:state.HitState.from)
+}
+
+// string to = 2;
+inline void HitState::clear_to() {
+  _impl_.to_.ClearToEmpty();
 }
-inline float Vector3Proto::y() const {
-  // @@protoc_insertion_point(field_get:state.Vector3Proto.y)
-  return y_;
+inline const std::string& HitState::to() const {
+  // @@protoc_insertion_point(field_get:state.HitState.to)
+  return _internal_to();
 }
-inline void Vector3Proto::set_y(float value) {
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HitState::set_to(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.to_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:state.HitState.to)
+}
+inline std::string* HitState::mutable_to() {
+  std::string* _s = _internal_mutable_to();
+  // @@protoc_insertion_point(field_mutable:state.HitState.to)
+  return _s;
+}
+inline const std::string& HitState::_internal_to() const {
+  return _impl_.to_.Get();
+}
+inline void HitState::_internal_set_to(const std::string& value) {
   
-  y_ = value;
-  // @@protoc_insertion_point(field_set:state.Vector3Proto.y)
+  _impl_.to_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HitState::_internal_mutable_to() {
+  
+  return _impl_.to_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HitState::release_to() {
+  // @@protoc_insertion_point(field_release:state.HitState.to)
+  return _impl_.to_.Release();
+}
+inline void HitState::set_allocated_to(std::string* to) {
+  if (to != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.to_.SetAllocated(to, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.to_.IsDefault()) {
+    _impl_.to_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:state.HitState.to)
 }
 
-// float z = 3;
-inline void Vector3Proto::clear_z() {
-  z_ = 0;
+// int32 damage = 3;
+inline void HitState::clear_damage() {
+  _impl_.damage_ = 0;
 }
-inline float Vector3Proto::z() const {
-  // @@protoc_insertion_point(field_get:state.Vector3Proto.z)
-  return z_;
+inline int32_t HitState::_internal_damage() const {
+  return _impl_.damage_;
 }
-inline void Vector3Proto::set_z(float value) {
+inline int32_t HitState::damage() const {
+  // @@protoc_insertion_point(field_get:state.HitState.damage)
+  return _internal_damage();
+}
+inline void HitState::_internal_set_damage(int32_t value) {
   
-  z_ = value;
-  // @@protoc_insertion_point(field_set:state.Vector3Proto.z)
+  _impl_.damage_ = value;
+}
+inline void HitState::set_damage(int32_t value) {
+  _internal_set_damage(value);
+  // @@protoc_insertion_point(field_set:state.HitState.damage)
+}
+
+// int32 fromSlot = 4;
+inline void HitState::clear_fromslot() {
+  _impl_.fromslot_ = 0;
+}
+inline int32_t HitState::_internal_fromslot() const {
+  return _impl_.fromslot_;
+}
+inline int32_t HitState::fromslot() const {
+  // @@protoc_insertion_point(field_get:state.HitState.fromSlot)
+  return _internal_fromslot();
+}
+inline void HitState::_internal_set_fromslot(int32_t value) {
+  
+  _impl_.fromslot_ = value;
+}
+inline void HitState::set_fromslot(int32_t value) {
+  _internal_set_fromslot(value);
+  // @@protoc_insertion_point(field_set:state.HitState.fromSlot)
+}
+
+// int32 toSlot = 5;
+inline void HitState::clear_toslot() {
+  _impl_.toslot_ = 0;
+}
+inline int32_t HitState::_internal_toslot() const {
+  return _impl_.toslot_;
+}
+inline int32_t HitState::toslot() const {
+  // @@protoc_insertion_point(field_get:state.HitState.toSlot)
+  return _internal_toslot();
+}
+inline void HitState::_internal_set_toslot(int32_t value) {
+  
+  _impl_.toslot_ = value;
+}
+inline void HitState::set_toslot(int32_t value) {
+  _internal_set_toslot(value);
+  // @@protoc_insertion_point(field_set:state.HitState.toSlot)
 }
 
 // -------------------------------------------------------------------
 
-// TransformProto
+// WorldState
 
-// .state.Vector3Proto position = 1;
-inline bool TransformProto::has_position() const {
-  return this != internal_default_instance() && position_ != NULL;
+// int32 roomId = 1;
+inline void WorldState::clear_roomid() {
+  _impl_.roomid_ = 0;
 }
-inline void TransformProto::clear_position() {
-  if (GetArenaNoVirtual() == NULL && position_ != NULL) {
-    delete position_;
-  }
-  position_ = NULL;
+inline int32_t WorldState::_internal_roomid() const {
+  return _impl_.roomid_;
 }
-inline const ::state::Vector3Proto& TransformProto::_internal_position() const {
-  return *position_;
+inline int32_t WorldState::roomid() const {
+  // @@protoc_insertion_point(field_get:state.WorldState.roomId)
+  return _internal_roomid();
 }
-inline const ::state::Vector3Proto& TransformProto::position() const {
-  const ::state::Vector3Proto* p = position_;
-  // @@protoc_insertion_point(field_get:state.TransformProto.position)
-  return p != NULL ? *p : *reinterpret_cast<const ::state::Vector3Proto*>(
-      &::state::_Vector3Proto_default_instance_);
+inline void WorldState::_internal_set_roomid(int32_t value) {
+  
+  _impl_.roomid_ = value;
 }
-inline ::state::Vector3Proto* TransformProto::release_position() {
-  // @@protoc_insertion_point(field_release:state.TransformProto.position)
+inline void WorldState::set_roomid(int32_t value) {
+  _internal_set_roomid(value);
+  // @@protoc_insertion_point(field_set:state.WorldState.roomId)
+}
+
+// string clntName = 2;
+inline void WorldState::clear_clntname() {
+  _impl_.clntname_.ClearToEmpty();
+}
+inline const std::string& WorldState::clntname() const {
+  // @@protoc_insertion_point(field_get:state.WorldState.clntName)
+  return _internal_clntname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WorldState::set_clntname(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.clntname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:state.WorldState.clntName)
+}
+inline std::string* WorldState::mutable_clntname() {
+  std::string* _s = _internal_mutable_clntname();
+  // @@protoc_insertion_point(field_mutable:state.WorldState.clntName)
+  return _s;
+}
+inline const std::string& WorldState::_internal_clntname() const {
+  return _impl_.clntname_.Get();
+}
+inline void WorldState::_internal_set_clntname(const std::string& value) {
   
-  ::state::Vector3Proto* temp = position_;
-  position_ = NULL;
-  return temp;
+  _impl_.clntname_.Set(value, GetArenaForAllocation());
 }
-inline ::state::Vector3Proto* TransformProto::mutable_position() {
+inline std::string* WorldState::_internal_mutable_clntname() {
   
-  if (position_ == NULL) {
-    auto* p = CreateMaybeMessage<::state::Vector3Proto>(GetArenaNoVirtual());
-    position_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:state.TransformProto.position)
-  return position_;
+  return _impl_.clntname_.Mutable(GetArenaForAllocation());
 }
-inline void TransformProto::set_allocated_position(::state::Vector3Proto* position) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete position_;
-  }
-  if (position) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      position = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, position, submessage_arena);
-    }
+inline std::string* WorldState::release_clntname() {
+  // @@protoc_insertion_point(field_release:state.WorldState.clntName)
+  return _impl_.clntname_.Release();
+}
+inline void WorldState::set_allocated_clntname(std::string* clntname) {
+  if (clntname != nullptr) {
     
   } else {
     
   }
-  position_ = position;
-  // @@protoc_insertion_point(field_set_allocated:state.TransformProto.position)
+  _impl_.clntname_.SetAllocated(clntname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.clntname_.IsDefault()) {
+    _impl_.clntname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:state.WorldState.clntName)
 }
 
-// .state.Vector3Proto rotation = 2;
-inline bool TransformProto::has_rotation() const {
-  return this != internal_default_instance() && rotation_ != NULL;
+// .state.TransformProto transform = 3;
+inline bool WorldState::_internal_has_transform() const {
+  return this != internal_default_instance() && _impl_.transform_ != nullptr;
 }
-inline void TransformProto::clear_rotation() {
-  if (GetArenaNoVirtual() == NULL && rotation_ != NULL) {
-    delete rotation_;
+inline bool WorldState::has_transform() const {
+  return _internal_has_transform();
+}
+inline void WorldState::clear_transform() {
+  if (GetArenaForAllocation() == nullptr && _impl_.transform_ != nullptr) {
+    delete _impl_.transform_;
   }
-  rotation_ = NULL;
+  _impl_.transform_ = nullptr;
 }
-inline const ::state::Vector3Proto& TransformProto::_internal_rotation() const {
-  return *rotation_;
+inline const ::state::TransformProto& WorldState::_internal_transform() const {
+  const ::state::TransformProto* p = _impl_.transform_;
+  return p != nullptr ? *p : reinterpret_cast<const ::state::TransformProto&>(
+      ::state::_TransformProto_default_instance_);
 }
-inline const ::state::Vector3Proto& TransformProto::rotation() const {
-  const ::state::Vector3Proto* p = rotation_;
-  // @@protoc_insertion_point(field_get:state.TransformProto.rotation)
-  return p != NULL ? *p : *reinterpret_cast<const ::state::Vector3Proto*>(
-      &::state::_Vector3Proto_default_instance_);
+inline const ::state::TransformProto& WorldState::transform() const {
+  // @@protoc_insertion_point(field_get:state.WorldState.transform)
+  return _internal_transform();
 }
-inline ::state::Vector3Proto* TransformProto::release_rotation() {
-  // @@protoc_insertion_point(field_release:state.TransformProto.rotation)
+inline void WorldState::unsafe_arena_set_allocated_transform(
+    ::state::TransformProto* transform) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.transform_);
+  }
+  _impl_.transform_ = transform;
+  if (transform) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:state.WorldState.transform)
+}
+inline ::state::TransformProto* WorldState::release_transform() {
   
-  ::state::Vector3Proto* temp = rotation_;
-  rotation_ = NULL;
+  ::state::TransformProto* temp = _impl_.transform_;
+  _impl_.transform_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::state::Vector3Proto* TransformProto::mutable_rotation() {
+inline ::state::TransformProto* WorldState::unsafe_arena_release_transform() {
+  // @@protoc_insertion_point(field_release:state.WorldState.transform)
+  
+  ::state::TransformProto* temp = _impl_.transform_;
+  _impl_.transform_ = nullptr;
+  return temp;
+}
+inline ::state::TransformProto* WorldState::_internal_mutable_transform() {
   
-  if (rotation_ == NULL) {
-    auto* p = CreateMaybeMessage<::state::Vector3Proto>(GetArenaNoVirtual());
-    rotation_ = p;
+  if (_impl_.transform_ == nullptr) {
+    auto* p = CreateMaybeMessage<::state::TransformProto>(GetArenaForAllocation());
+    _impl_.transform_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:state.TransformProto.rotation)
-  return rotation_;
+  return _impl_.transform_;
 }
-inline void TransformProto::set_allocated_rotation(::state::Vector3Proto* rotation) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete rotation_;
+inline ::state::TransformProto* WorldState::mutable_transform() {
+  ::state::TransformProto* _msg = _internal_mutable_transform();
+  // @@protoc_insertion_point(field_mutable:state.WorldState.transform)
+  return _msg;
+}
+inline void WorldState::set_allocated_transform(::state::TransformProto* transform) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.transform_;
   }
-  if (rotation) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (transform) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(transform);
     if (message_arena != submessage_arena) {
-      rotation = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, rotation, submessage_arena);
+      transform = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, transform, submessage_arena);
     }
     
   } else {
     
   }
-  rotation_ = rotation;
-  // @@protoc_insertion_point(field_set_allocated:state.TransformProto.rotation)
+  _impl_.transform_ = transform;
+  // @@protoc_insertion_point(field_set_allocated:state.WorldState.transform)
 }
 
-// .state.Vector3Proto scale = 3;
-inline bool TransformProto::has_scale() const {
-  return this != internal_default_instance() && scale_ != NULL;
+// bool fired = 4;
+inline void WorldState::clear_fired() {
+  _impl_.fired_ = false;
 }
-inline void TransformProto::clear_scale() {
-  if (GetArenaNoVirtual() == NULL && scale_ != NULL) {
-    delete scale_;
+inline bool WorldState::_internal_fired() const {
+  return _impl_.fired_;
+}
+inline bool WorldState::fired() const {
+  // @@protoc_insertion_point(field_get:state.WorldState.fired)
+  return _internal_fired();
+}
+inline void WorldState::_internal_set_fired(bool value) {
+  
+  _impl_.fired_ = value;
+}
+inline void WorldState::set_fired(bool value) {
+  _internal_set_fired(value);
+  // @@protoc_insertion_point(field_set:state.WorldState.fired)
+}
+
+// int32 health = 5;
+inline void WorldState::clear_health() {
+  _impl_.health_ = 0;
+}
+inline int32_t WorldState::_internal_health() const {
+  return _impl_.health_;
+}
+inline int32_t WorldState::health() const {
+  // @@protoc_insertion_point(field_get:state.WorldState.health)
+  return _internal_health();
+}
+inline void WorldState::_internal_set_health(int32_t value) {
+  
+  _impl_.health_ = value;
+}
+inline void WorldState::set_health(int32_t value) {
+  _internal_set_health(value);
+  // @@protoc_insertion_point(field_set:state.WorldState.health)
+}
+
+// bool hit = 6;
+inline void WorldState::clear_hit() {
+  _impl_.hit_ = false;
+}
+inline bool WorldState::_internal_hit() const {
+  return _impl_.hit_;
+}
+inline bool WorldState::hit() const {
+  // @@protoc_insertion_point(field_get:state.WorldState.hit)
+  return _internal_hit();
+}
+inline void WorldState::_internal_set_hit(bool value) {
+  
+  _impl_.hit_ = value;
+}
+inline void WorldState::set_hit(bool value) {
+  _internal_set_hit(value);
+  // @@protoc_insertion_point(field_set:state.WorldState.hit)
+}
+
+// .state.HitState hitState = 7;
+inline bool WorldState::_internal_has_hitstate() const {
+  return this != internal_default_instance() && _impl_.hitstate_ != nullptr;
+}
+inline bool WorldState::has_hitstate() const {
+  return _internal_has_hitstate();
+}
+inline void WorldState::clear_hitstate() {
+  if (GetArenaForAllocation() == nullptr && _impl_.hitstate_ != nullptr) {
+    delete _impl_.hitstate_;
   }
-  scale_ = NULL;
+  _impl_.hitstate_ = nullptr;
 }
-inline const ::state::Vector3Proto& TransformProto::_internal_scale() const {
-  return *scale_;
+inline const ::state::HitState& WorldState::_internal_hitstate() const {
+  const ::state::HitState* p = _impl_.hitstate_;
+  return p != nullptr ? *p : reinterpret_cast<const ::state::HitState&>(
+      ::state::_HitState_default_instance_);
 }
-inline const ::state::Vector3Proto& TransformProto::scale() const {
-  const ::state::Vector3Proto* p = scale_;
-  // @@protoc_insertion_point(field_get:state.TransformProto.scale)
-  return p != NULL ? *p : *reinterpret_cast<const ::state::Vector3Proto*>(
-      &::state::_Vector3Proto_default_instance_);
+inline const ::state::HitState& WorldState::hitstate() const {
+  // @@protoc_insertion_point(field_get:state.WorldState.hitState)
+  return _internal_hitstate();
 }
-inline ::state::Vector3Proto* TransformProto::release_scale() {
-  // @@protoc_insertion_point(field_release:state.TransformProto.scale)
+inline void WorldState::unsafe_arena_set_allocated_hitstate(
+    ::state::HitState* hitstate) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hitstate_);
+  }
+  _impl_.hitstate_ = hitstate;
+  if (hitstate) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:state.WorldState.hitState)
+}
+inline ::state::HitState* WorldState::release_hitstate() {
   
-  ::state::Vector3Proto* temp = scale_;
-  scale_ = NULL;
+  ::state::HitState* temp = _impl_.hitstate_;
+  _impl_.hitstate_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::state::Vector3Proto* TransformProto::mutable_scale() {
+inline ::state::HitState* WorldState::unsafe_arena_release_hitstate() {
+  // @@protoc_insertion_point(field_release:state.WorldState.hitState)
+  
+  ::state::HitState* temp = _impl_.hitstate_;
+  _impl_.hitstate_ = nullptr;
+  return temp;
+}
+inline ::state::HitState* WorldState::_internal_mutable_hitstate() {
   
-  if (scale_ == NULL) {
-    auto* p = CreateMaybeMessage<::state::Vector3Proto>(GetArenaNoVirtual());
-    scale_ = p;
+  if (_impl_.hitstate_ == nullptr) {
+    auto* p = CreateMaybeMessage<::state::HitState>(GetArenaForAllocation());
+    _impl_.hitstate_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:state.TransformProto.scale)
-  return scale_;
+  return _impl_.hitstate_;
 }
-inline void TransformProto::set_allocated_scale(::state::Vector3Proto* scale) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete scale_;
+inline ::state::HitState* WorldState::mutable_hitstate() {
+  ::state::HitState* _msg = _internal_mutable_hitstate();
+  // @@protoc_insertion_point(field_mutable:state.WorldState.hitState)
+  return _msg;
+}
+inline void WorldState::set_allocated_hitstate(::state::HitState* hitstate) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.hitstate_;
   }
-  if (scale) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (hitstate) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(hitstate);
     if (message_arena != submessage_arena) {
-      scale = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, scale, submessage_arena);
+      hitstate = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hitstate, submessage_arena);
     }
     
   } else {
     
   }
-  scale_ = scale;
-  // @@protoc_insertion_point(field_set_allocated:state.TransformProto.scale)
+  _impl_.hitstate_ = hitstate;
+  // @@protoc_insertion_point(field_set_allocated:state.WorldState.hitState)
 }
 
-// -------------------------------------------------------------------
+// int32 killPoint = 8;
+inline void WorldState::clear_killpoint() {
+  _impl_.killpoint_ = 0;
+}
+inline int32_t WorldState::_internal_killpoint() const {
+  return _impl_.killpoint_;
+}
+inline int32_t WorldState::killpoint() const {
+  // @@protoc_insertion_point(field_get:state.WorldState.killPoint)
+  return _internal_killpoint();
+}
+inline void WorldState::_internal_set_killpoint(int32_t value) {
+  
+  _impl_.killpoint_ = value;
+}
+inline void WorldState::set_killpoint(int32_t value) {
+  _internal_set_killpoint(value);
+  // @@protoc_insertion_point(field_set:state.WorldState.killPoint)
+}
 
-// PlayState
+// int32 deathPoint = 9;
+inline void WorldState::clear_deathpoint() {
+  _impl_.deathpoint_ = 0;
+}
+inline int32_t WorldState::_internal_deathpoint() const {
+  return _impl_.deathpoint_;
+}
+inline int32_t WorldState::deathpoint() const {
+  // @@protoc_insertion_point(field_get:state.WorldState.deathPoint)
+  return _internal_deathpoint();
+}
+inline void WorldState::_internal_set_deathpoint(int32_t value) {
+  
+  _impl_.deathpoint_ = value;
+}
+inline void WorldState::set_deathpoint(int32_t value) {
+  _internal_set_deathpoint(value);
+  // @@protoc_insertion_point(field_set:state.WorldState.deathPoint)
+}
 
-// .state.TransformProto transform = 1;
-inline bool PlayState::has_transform() const {
-  return this != internal_default_instance() && transform_ != NULL;
+// int32 animState = 10;
+inline void WorldState::clear_animstate() {
+  _impl_.animstate_ = 0;
 }
-inline void PlayState::clear_transform() {
-  if (GetArenaNoVirtual() == NULL && transform_ != NULL) {
-    delete transform_;
+inline int32_t WorldState::_internal_animstate() const {
+  return _impl_.animstate_;
+}
+inline int32_t WorldState::animstate() const {
+  // @@protoc_insertion_point(field_get:state.WorldState.animState)
+  return _internal_animstate();
+}
+inline void WorldState::_internal_set_animstate(int32_t value) {
+  
+  _impl_.animstate_ = value;
+}
+inline void WorldState::set_animstate(int32_t value) {
+  _internal_set_animstate(value);
+  // @@protoc_insertion_point(field_set:state.WorldState.animState)
+}
+
+// .state.CompactTransform compactTransform = 11;
+inline bool WorldState::_internal_has_compacttransform() const {
+  return this != internal_default_instance() && _impl_.compacttransform_ != nullptr;
+}
+inline bool WorldState::has_compacttransform() const {
+  return _internal_has_compacttransform();
+}
+inline void WorldState::clear_compacttransform() {
+  if (GetArenaForAllocation() == nullptr && _impl_.compacttransform_ != nullptr) {
+    delete _impl_.compacttransform_;
   }
-  transform_ = NULL;
+  _impl_.compacttransform_ = nullptr;
 }
-inline const ::state::TransformProto& PlayState::_internal_transform() const {
-  return *transform_;
+inline const ::state::CompactTransform& WorldState::_internal_compacttransform() const {
+  const ::state::CompactTransform* p = _impl_.compacttransform_;
+  return p != nullptr ? *p : reinterpret_cast<const ::state::CompactTransform&>(
+      ::state::_CompactTransform_default_instance_);
 }
-inline const ::state::TransformProto& PlayState::transform() const {
-  const ::state::TransformProto* p = transform_;
-  // @@protoc_insertion_point(field_get:state.PlayState.transform)
-  return p != NULL ? *p : *reinterpret_cast<const ::state::TransformProto*>(
-      &::state::_TransformProto_default_instance_);
+inline const ::state::CompactTransform& WorldState::compacttransform() const {
+  // @@protoc_insertion_point(field_get:state.WorldState.compactTransform)
+  return _internal_compacttransform();
+}
+inline void WorldState::unsafe_arena_set_allocated_compacttransform(
+    ::state::CompactTransform* compacttransform) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.compacttransform_);
+  }
+  _impl_.compacttransform_ = compacttransform;
+  if (compacttransform) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:state.WorldState.compactTransform)
 }
-inline ::state::TransformProto* PlayState::release_transform() {
-  // @@protoc_insertion_point(field_release:state.PlayState.transform)
+inline ::state::CompactTransform* WorldState::release_compacttransform() {
   
-  ::state::TransformProto* temp = transform_;
-  transform_ = NULL;
+  ::state::CompactTransform* temp = _impl_.compacttransform_;
+  _impl_.compacttransform_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::state::TransformProto* PlayState::mutable_transform() {
+inline ::state::CompactTransform* WorldState::unsafe_arena_release_compacttransform() {
+  // @@protoc_insertion_point(field_release:state.WorldState.compactTransform)
+  
+  ::state::CompactTransform* temp = _impl_.compacttransform_;
+  _impl_.compacttransform_ = nullptr;
+  return temp;
+}
+inline ::state::CompactTransform* WorldState::_internal_mutable_compacttransform() {
   
-  if (transform_ == NULL) {
-    auto* p = CreateMaybeMessage<::state::TransformProto>(GetArenaNoVirtual());
-    transform_ = p;
+  if (_impl_.compacttransform_ == nullptr) {
+    auto* p = CreateMaybeMessage<::state::CompactTransform>(GetArenaForAllocation());
+    _impl_.compacttransform_ = p;
   }
-  // @@protoc_insertion_point(field_mutable:state.PlayState.transform)
-  return transform_;
+  return _impl_.compacttransform_;
 }
-inline void PlayState::set_allocated_transform(::state::TransformProto* transform) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete transform_;
+inline ::state::CompactTransform* WorldState::mutable_compacttransform() {
+  ::state::CompactTransform* _msg = _internal_mutable_compacttransform();
+  // @@protoc_insertion_point(field_mutable:state.WorldState.compactTransform)
+  return _msg;
+}
+inline void WorldState::set_allocated_compacttransform(::state::CompactTransform* compacttransform) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.compacttransform_;
   }
-  if (transform) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+  if (compacttransform) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(compacttransform);
     if (message_arena != submessage_arena) {
-      transform = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, transform, submessage_arena);
+      compacttransform = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, compacttransform, submessage_arena);
     }
     
   } else {
     
   }
-  transform_ = transform;
-  // @@protoc_insertion_point(field_set_allocated:state.PlayState.transform)
+  _impl_.compacttransform_ = compacttransform;
+  // @@protoc_insertion_point(field_set_allocated:state.WorldState.compactTransform)
 }
 
-// int32 animState = 2;
-inline void PlayState::clear_animstate() {
-  animstate_ = 0;
+// int32 slot = 12;
+inline void WorldState::clear_slot() {
+  _impl_.slot_ = 0;
 }
-inline ::google::protobuf::int32 PlayState::animstate() const {
-  // @@protoc_insertion_point(field_get:state.PlayState.animState)
-  return animstate_;
+inline int32_t WorldState::_internal_slot() const {
+  return _impl_.slot_;
+}
+inline int32_t WorldState::slot() const {
+  // @@protoc_insertion_point(field_get:state.WorldState.slot)
+  return _internal_slot();
 }
-inline void PlayState::set_animstate(::google::protobuf::int32 value) {
+inline void WorldState::_internal_set_slot(int32_t value) {
   
-  animstate_ = value;
-  // @@protoc_insertion_point(field_set:state.PlayState.animState)
+  _impl_.slot_ = value;
+}
+inline void WorldState::set_slot(int32_t value) {
+  _internal_set_slot(value);
+  // @@protoc_insertion_point(field_set:state.WorldState.slot)
 }
 
-// int32 health = 3;
-inline void PlayState::clear_health() {
-  health_ = 0;
+// -------------------------------------------------------------------
+
+// CompactTransform
+
+// optional fixed64 position = 1;
+inline bool CompactTransform::_internal_has_position() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline ::google::protobuf::int32 PlayState::health() const {
-  // @@protoc_insertion_point(field_get:state.PlayState.health)
-  return health_;
+inline bool CompactTransform::has_position() const {
+  return _internal_has_position();
 }
-inline void PlayState::set_health(::google::protobuf::int32 value) {
-  
-  health_ = value;
-  // @@protoc_insertion_point(field_set:state.PlayState.health)
+inline void CompactTransform::clear_position() {
+  _impl_.position_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-
-// int32 killCount = 4;
-inline void PlayState::clear_killcount() {
-  killcount_ = 0;
+inline uint64_t CompactTransform::_internal_position() const {
+  return _impl_.position_;
 }
-inline ::google::protobuf::int32 PlayState::killcount() const {
-  // @@protoc_insertion_point(field_get:state.PlayState.killCount)
-  return killcount_;
+inline uint64_t CompactTransform::position() const {
+  // @@protoc_insertion_point(field_get:state.CompactTransform.position)
+  return _internal_position();
 }
-inline void PlayState::set_killcount(::google::protobuf::int32 value) {
-  
-  killcount_ = value;
-  // @@protoc_insertion_point(field_set:state.PlayState.killCount)
+inline void CompactTransform::_internal_set_position(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.position_ = value;
+}
+inline void CompactTransform::set_position(uint64_t value) {
+  _internal_set_position(value);
+  // @@protoc_insertion_point(field_set:state.CompactTransform.position)
 }
 
-// int32 deathCount = 5;
-inline void PlayState::clear_deathcount() {
-  deathcount_ = 0;
+// optional fixed32 rotation = 2;
+inline bool CompactTransform::_internal_has_rotation() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline ::google::protobuf::int32 PlayState::deathcount() const {
-  // @@protoc_insertion_point(field_get:state.PlayState.deathCount)
-  return deathcount_;
+inline bool CompactTransform::has_rotation() const {
+  return _internal_has_rotation();
 }
-inline void PlayState::set_deathcount(::google::protobuf::int32 value) {
-  
-  deathcount_ = value;
-  // @@protoc_insertion_point(field_set:state.PlayState.deathCount)
+inline void CompactTransform::clear_rotation() {
+  _impl_.rotation_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-
-// int32 roomId = 6;
-inline void PlayState::clear_roomid() {
-  roomid_ = 0;
+inline uint32_t CompactTransform::_internal_rotation() const {
+  return _impl_.rotation_;
 }
-inline ::google::protobuf::int32 PlayState::roomid() const {
-  // @@protoc_insertion_point(field_get:state.PlayState.roomId)
-  return roomid_;
+inline uint32_t CompactTransform::rotation() const {
+  // @@protoc_insertion_point(field_get:state.CompactTransform.rotation)
+  return _internal_rotation();
 }
-inline void PlayState::set_roomid(::google::protobuf::int32 value) {
-  
-  roomid_ = value;
-  // @@protoc_insertion_point(field_set:state.PlayState.roomId)
+inline void CompactTransform::_internal_set_rotation(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.rotation_ = value;
+}
+inline void CompactTransform::set_rotation(uint32_t value) {
+  _internal_set_rotation(value);
+  // @@protoc_insertion_point(field_set:state.CompactTransform.rotation)
 }
 
-// string clntName = 7;
-inline void PlayState::clear_clntname() {
-  clntname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// .state.Vector3Proto scale = 3;
+inline bool CompactTransform::_internal_has_scale() const {
+  return this != internal_default_instance() && _impl_.scale_ != nullptr;
 }
-inline const ::std::string& PlayState::clntname() const {
-  // @@protoc_insertion_point(field_get:state.PlayState.clntName)
-  return clntname_.GetNoArena();
+inline bool CompactTransform::has_scale() const {
+  return _internal_has_scale();
 }
-inline void PlayState::set_clntname(const ::std::string& value) {
-  
-  clntname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:state.PlayState.clntName)
+inline void CompactTransform::clear_scale() {
+  if (GetArenaForAllocation() == nullptr && _impl_.scale_ != nullptr) {
+    delete _impl_.scale_;
+  }
+  _impl_.scale_ = nullptr;
 }
-#if LANG_CXX11
-inline void PlayState::set_clntname(::std::string&& value) {
-  
-  clntname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:state.PlayState.clntName)
+inline const ::state::Vector3Proto& CompactTransform::_internal_scale() const {
+  const ::state::Vector3Proto* p = _impl_.scale_;
+  return p != nullptr ? *p : reinterpret_cast<const ::state::Vector3Proto&>(
+      ::state::_Vector3Proto_default_instance_);
 }
-#endif
-inline void PlayState::set_clntname(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  clntname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:state.PlayState.clntName)
+inline const ::state::Vector3Proto& CompactTransform::scale() const {
+  // @@protoc_insertion_point(field_get:state.CompactTransform.scale)
+  return _internal_scale();
+}
+inline void CompactTransform::unsafe_arena_set_allocated_scale(
+    ::state::Vector3Proto* scale) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.scale_);
+  }
+  _impl_.scale_ = scale;
+  if (scale) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:state.CompactTransform.scale)
 }
-inline void PlayState::set_clntname(const char* value, size_t size) {
+inline ::state::Vector3Proto* CompactTransform::release_scale() {
   
-  clntname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:state.PlayState.clntName)
+  ::state::Vector3Proto* temp = _impl_.scale_;
+  _impl_.scale_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::std::string* PlayState::mutable_clntname() {
+inline ::state::Vector3Proto* CompactTransform::unsafe_arena_release_scale() {
+  // @@protoc_insertion_point(field_release:state.CompactTransform.scale)
   
-  // @@protoc_insertion_point(field_mutable:state.PlayState.clntName)
-  return clntname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::state::Vector3Proto* temp = _impl_.scale_;
+  _impl_.scale_ = nullptr;
+  return temp;
 }
-inline ::std::string* PlayState::release_clntname() {
-  // @@protoc_insertion_point(field_release:state.PlayState.clntName)
+inline ::state::Vector3Proto* CompactTransform::_internal_mutable_scale() {
   
-  return clntname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.scale_ == nullptr) {
+    auto* p = CreateMaybeMessage<::state::Vector3Proto>(GetArenaForAllocation());
+    _impl_.scale_ = p;
+  }
+  return _impl_.scale_;
+}
+inline ::state::Vector3Proto* CompactTransform::mutable_scale() {
+  ::state::Vector3Proto* _msg = _internal_mutable_scale();
+  // @@protoc_insertion_point(field_mutable:state.CompactTransform.scale)
+  return _msg;
 }
-inline void PlayState::set_allocated_clntname(::std::string* clntname) {
-  if (clntname != NULL) {
+inline void CompactTransform::set_allocated_scale(::state::Vector3Proto* scale) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.scale_;
+  }
+  if (scale) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(scale);
+    if (message_arena != submessage_arena) {
+      scale = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, scale, submessage_arena);
+    }
     
   } else {
     
   }
-  clntname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), clntname);
-  // @@protoc_insertion_point(field_set_allocated:state.PlayState.clntName)
+  _impl_.scale_ = scale;
+  // @@protoc_insertion_point(field_set_allocated:state.CompactTransform.scale)
 }
 
 // -------------------------------------------------------------------
 
-// HitState
+// StateDelta
 
-// string from = 1;
-inline void HitState::clear_from() {
-  from_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// int32 entity = 1;
+inline void StateDelta::clear_entity() {
+  _impl_.entity_ = 0;
 }
-inline const ::std::string& HitState::from() const {
-  // @@protoc_insertion_point(field_get:state.HitState.from)
-  return from_.GetNoArena();
+inline int32_t StateDelta::_internal_entity() const {
+  return _impl_.entity_;
 }
-inline void HitState::set_from(const ::std::string& value) {
-  
-  from_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:state.HitState.from)
+inline int32_t StateDelta::entity() const {
+  // @@protoc_insertion_point(field_get:state.StateDelta.entity)
+  return _internal_entity();
 }
-#if LANG_CXX11
-inline void HitState::set_from(::std::string&& value) {
+inline void StateDelta::_internal_set_entity(int32_t value) {
   
-  from_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:state.HitState.from)
+  _impl_.entity_ = value;
 }
-#endif
-inline void HitState::set_from(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  from_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:state.HitState.from)
+inline void StateDelta::set_entity(int32_t value) {
+  _internal_set_entity(value);
+  // @@protoc_insertion_point(field_set:state.StateDelta.entity)
 }
-inline void HitState::set_from(const char* value, size_t size) {
-  
-  from_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:state.HitState.from)
+
+// uint32 changed = 2;
+inline void StateDelta::clear_changed() {
+  _impl_.changed_ = 0u;
 }
-inline ::std::string* HitState::mutable_from() {
-  
-  // @@protoc_insertion_point(field_mutable:state.HitState.from)
-  return from_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline uint32_t StateDelta::_internal_changed() const {
+  return _impl_.changed_;
 }
-inline ::std::string* HitState::release_from() {
-  // @@protoc_insertion_point(field_release:state.HitState.from)
+inline uint32_t StateDelta::changed() const {
+  // @@protoc_insertion_point(field_get:state.StateDelta.changed)
+  return _internal_changed();
+}
+inline void StateDelta::_internal_set_changed(uint32_t value) {
   
-  return from_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.changed_ = value;
 }
-inline void HitState::set_allocated_from(::std::string* from) {
-  if (from != NULL) {
-    
-  } else {
-    
-  }
-  from_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from);
-  // @@protoc_insertion_point(field_set_allocated:state.HitState.from)
+inline void StateDelta::set_changed(uint32_t value) {
+  _internal_set_changed(value);
+  // @@protoc_insertion_point(field_set:state.StateDelta.changed)
 }
 
-// string to = 2;
-inline void HitState::clear_to() {
-  to_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// .state.WorldState state = 3;
+inline bool StateDelta::_internal_has_state() const {
+  return this != internal_default_instance() && _impl_.state_ != nullptr;
 }
-inline const ::std::string& HitState::to() const {
-  // @@protoc_insertion_point(field_get:state.HitState.to)
-  return to_.GetNoArena();
+inline bool StateDelta::has_state() const {
+  return _internal_has_state();
 }
-inline void HitState::set_to(const ::std::string& value) {
-  
-  to_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:state.HitState.to)
+inline void StateDelta::clear_state() {
+  if (GetArenaForAllocation() == nullptr && _impl_.state_ != nullptr) {
+    delete _impl_.state_;
+  }
+  _impl_.state_ = nullptr;
 }
-#if LANG_CXX11
-inline void HitState::set_to(::std::string&& value) {
-  
-  to_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:state.HitState.to)
+inline const ::state::WorldState& StateDelta::_internal_state() const {
+  const ::state::WorldState* p = _impl_.state_;
+  return p != nullptr ? *p : reinterpret_cast<const ::state::WorldState&>(
+      ::state::_WorldState_default_instance_);
 }
-#endif
-inline void HitState::set_to(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  to_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:state.HitState.to)
+inline const ::state::WorldState& StateDelta::state() const {
+  // @@protoc_insertion_point(field_get:state.StateDelta.state)
+  return _internal_state();
+}
+inline void StateDelta::unsafe_arena_set_allocated_state(
+    ::state::WorldState* state) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.state_);
+  }
+  _impl_.state_ = state;
+  if (state) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:state.StateDelta.state)
 }
-inline void HitState::set_to(const char* value, size_t size) {
+inline ::state::WorldState* StateDelta::release_state() {
   
-  to_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:state.HitState.to)
+  ::state::WorldState* temp = _impl_.state_;
+  _impl_.state_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::std::string* HitState::mutable_to() {
+inline ::state::WorldState* StateDelta::unsafe_arena_release_state() {
+  // @@protoc_insertion_point(field_release:state.StateDelta.state)
   
-  // @@protoc_insertion_point(field_mutable:state.HitState.to)
-  return to_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::state::WorldState* temp = _impl_.state_;
+  _impl_.state_ = nullptr;
+  return temp;
 }
-inline ::std::string* HitState::release_to() {
-  // @@protoc_insertion_point(field_release:state.HitState.to)
+inline ::state::WorldState* StateDelta::_internal_mutable_state() {
   
-  return to_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.state_ == nullptr) {
+    auto* p = CreateMaybeMessage<::state::WorldState>(GetArenaForAllocation());
+    _impl_.state_ = p;
+  }
+  return _impl_.state_;
+}
+inline ::state::WorldState* StateDelta::mutable_state() {
+  ::state::WorldState* _msg = _internal_mutable_state();
+  // @@protoc_insertion_point(field_mutable:state.StateDelta.state)
+  return _msg;
 }
-inline void HitState::set_allocated_to(::std::string* to) {
-  if (to != NULL) {
+inline void StateDelta::set_allocated_state(::state::WorldState* state) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.state_;
+  }
+  if (state) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state);
+    if (message_arena != submessage_arena) {
+      state = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state, submessage_arena);
+    }
     
   } else {
     
   }
-  to_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), to);
-  // @@protoc_insertion_point(field_set_allocated:state.HitState.to)
-}
-
-// int32 damage = 3;
-inline void HitState::clear_damage() {
-  damage_ = 0;
-}
-inline ::google::protobuf::int32 HitState::damage() const {
-  // @@protoc_insertion_point(field_get:state.HitState.damage)
-  return damage_;
-}
-inline void HitState::set_damage(::google::protobuf::int32 value) {
-  
-  damage_ = value;
-  // @@protoc_insertion_point(field_set:state.HitState.damage)
+  _impl_.state_ = state;
+  // @@protoc_insertion_point(field_set_allocated:state.StateDelta.state)
 }
 
 // -------------------------------------------------------------------
 
-// WorldState
+// RoomSnapshot
 
 // int32 roomId = 1;
-inline void WorldState::clear_roomid() {
-  roomid_ = 0;
-}
-inline ::google::protobuf::int32 WorldState::roomid() const {
-  // @@protoc_insertion_point(field_get:state.WorldState.roomId)
-  return roomid_;
-}
-inline void WorldState::set_roomid(::google::protobuf::int32 value) {
-  
-  roomid_ = value;
-  // @@protoc_insertion_point(field_set:state.WorldState.roomId)
+inline void RoomSnapshot::clear_roomid() {
+  _impl_.roomid_ = 0;
 }
-
-// string clntName = 2;
-inline void WorldState::clear_clntname() {
-  clntname_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline int32_t RoomSnapshot::_internal_roomid() const {
+  return _impl_.roomid_;
 }
-inline const ::std::string& WorldState::clntname() const {
-  // @@protoc_insertion_point(field_get:state.WorldState.clntName)
-  return clntname_.GetNoArena();
+inline int32_t RoomSnapshot::roomid() const {
+  // @@protoc_insertion_point(field_get:state.RoomSnapshot.roomId)
+  return _internal_roomid();
 }
-inline void WorldState::set_clntname(const ::std::string& value) {
+inline void RoomSnapshot::_internal_set_roomid(int32_t value) {
   
-  clntname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:state.WorldState.clntName)
+  _impl_.roomid_ = value;
 }
-#if LANG_CXX11
-inline void WorldState::set_clntname(::std::string&& value) {
-  
-  clntname_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:state.WorldState.clntName)
+inline void RoomSnapshot::set_roomid(int32_t value) {
+  _internal_set_roomid(value);
+  // @@protoc_insertion_point(field_set:state.RoomSnapshot.roomId)
 }
-#endif
-inline void WorldState::set_clntname(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  clntname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:state.WorldState.clntName)
+
+// uint32 tick = 2;
+inline void RoomSnapshot::clear_tick() {
+  _impl_.tick_ = 0u;
 }
-inline void WorldState::set_clntname(const char* value, size_t size) {
-  
-  clntname_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:state.WorldState.clntName)
+inline uint32_t RoomSnapshot::_internal_tick() const {
+  return _impl_.tick_;
 }
-inline ::std::string* WorldState::mutable_clntname() {
-  
-  // @@protoc_insertion_point(field_mutable:state.WorldState.clntName)
-  return clntname_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline uint32_t RoomSnapshot::tick() const {
+  // @@protoc_insertion_point(field_get:state.RoomSnapshot.tick)
+  return _internal_tick();
 }
-inline ::std::string* WorldState::release_clntname() {
-  // @@protoc_insertion_point(field_release:state.WorldState.clntName)
+inline void RoomSnapshot::_internal_set_tick(uint32_t value) {
   
-  return clntname_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.tick_ = value;
 }
-inline void WorldState::set_allocated_clntname(::std::string* clntname) {
-  if (clntname != NULL) {
-    
-  } else {
-    
-  }
-  clntname_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), clntname);
-  // @@protoc_insertion_point(field_set_allocated:state.WorldState.clntName)
+inline void RoomSnapshot::set_tick(uint32_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:state.RoomSnapshot.tick)
 }
 
-// .state.TransformProto transform = 3;
-inline bool WorldState::has_transform() const {
-  return this != internal_default_instance() && transform_ != NULL;
+// repeated .state.WorldState states = 3;
+inline int RoomSnapshot::_internal_states_size() const {
+  return _impl_.states_.size();
 }
-inline void WorldState::clear_transform() {
-  if (GetArenaNoVirtual() == NULL && transform_ != NULL) {
-    delete transform_;
-  }
-  transform_ = NULL;
+inline int RoomSnapshot::states_size() const {
+  return _internal_states_size();
 }
-inline const ::state::TransformProto& WorldState::_internal_transform() const {
-  return *transform_;
+inline void RoomSnapshot::clear_states() {
+  _impl_.states_.Clear();
 }
-inline const ::state::TransformProto& WorldState::transform() const {
-  const ::state::TransformProto* p = transform_;
-  // @@protoc_insertion_point(field_get:state.WorldState.transform)
-  return p != NULL ? *p : *reinterpret_cast<const ::state::TransformProto*>(
-      &::state::_TransformProto_default_instance_);
+inline ::state::WorldState* RoomSnapshot::mutable_states(int index) {
+  // @@protoc_insertion_point(field_mutable:state.RoomSnapshot.states)
+  return _impl_.states_.Mutable(index);
 }
-inline ::state::TransformProto* WorldState::release_transform() {
-  // @@protoc_insertion_point(field_release:state.WorldState.transform)
-  
-  ::state::TransformProto* temp = transform_;
-  transform_ = NULL;
-  return temp;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::state::WorldState >*
+RoomSnapshot::mutable_states() {
+  // @@protoc_insertion_point(field_mutable_list:state.RoomSnapshot.states)
+  return &_impl_.states_;
 }
-inline ::state::TransformProto* WorldState::mutable_transform() {
-  
-  if (transform_ == NULL) {
-    auto* p = CreateMaybeMessage<::state::TransformProto>(GetArenaNoVirtual());
-    transform_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:state.WorldState.transform)
-  return transform_;
+inline const ::state::WorldState& RoomSnapshot::_internal_states(int index) const {
+  return _impl_.states_.Get(index);
 }
-inline void WorldState::set_allocated_transform(::state::TransformProto* transform) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete transform_;
-  }
-  if (transform) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      transform = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, transform, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  transform_ = transform;
-  // @@protoc_insertion_point(field_set_allocated:state.WorldState.transform)
+inline const ::state::WorldState& RoomSnapshot::states(int index) const {
+  // @@protoc_insertion_point(field_get:state.RoomSnapshot.states)
+  return _internal_states(index);
 }
-
-// bool fired = 4;
-inline void WorldState::clear_fired() {
-  fired_ = false;
+inline ::state::WorldState* RoomSnapshot::_internal_add_states() {
+  return _impl_.states_.Add();
 }
-inline bool WorldState::fired() const {
-  // @@protoc_insertion_point(field_get:state.WorldState.fired)
-  return fired_;
+inline ::state::WorldState* RoomSnapshot::add_states() {
+  ::state::WorldState* _add = _internal_add_states();
+  // @@protoc_insertion_point(field_add:state.RoomSnapshot.states)
+  return _add;
 }
-inline void WorldState::set_fired(bool value) {
-  
-  fired_ = value;
-  // @@protoc_insertion_point(field_set:state.WorldState.fired)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::state::WorldState >&
+RoomSnapshot::states() const {
+  // @@protoc_insertion_point(field_list:state.RoomSnapshot.states)
+  return _impl_.states_;
 }
 
-// int32 health = 5;
-inline void WorldState::clear_health() {
-  health_ = 0;
-}
-inline ::google::protobuf::int32 WorldState::health() const {
-  // @@protoc_insertion_point(field_get:state.WorldState.health)
-  return health_;
-}
-inline void WorldState::set_health(::google::protobuf::int32 value) {
-  
-  health_ = value;
-  // @@protoc_insertion_point(field_set:state.WorldState.health)
+// uint32 baseTick = 4;
+inline void RoomSnapshot::clear_basetick() {
+  _impl_.basetick_ = 0u;
 }
-
-// bool hit = 6;
-inline void WorldState::clear_hit() {
-  hit_ = false;
+inline uint32_t RoomSnapshot::_internal_basetick() const {
+  return _impl_.basetick_;
 }
-inline bool WorldState::hit() const {
-  // @@protoc_insertion_point(field_get:state.WorldState.hit)
-  return hit_;
+inline uint32_t RoomSnapshot::basetick() const {
+  // @@protoc_insertion_point(field_get:state.RoomSnapshot.baseTick)
+  return _internal_basetick();
 }
-inline void WorldState::set_hit(bool value) {
+inline void RoomSnapshot::_internal_set_basetick(uint32_t value) {
   
-  hit_ = value;
-  // @@protoc_insertion_point(field_set:state.WorldState.hit)
+  _impl_.basetick_ = value;
+}
+inline void RoomSnapshot::set_basetick(uint32_t value) {
+  _internal_set_basetick(value);
+  // @@protoc_insertion_point(field_set:state.RoomSnapshot.baseTick)
 }
 
-// .state.HitState hitState = 7;
-inline bool WorldState::has_hitstate() const {
-  return this != internal_default_instance() && hitstate_ != NULL;
+// repeated .state.StateDelta deltas = 5;
+inline int RoomSnapshot::_internal_deltas_size() const {
+  return _impl_.deltas_.size();
 }
-inline void WorldState::clear_hitstate() {
-  if (GetArenaNoVirtual() == NULL && hitstate_ != NULL) {
-    delete hitstate_;
-  }
-  hitstate_ = NULL;
+inline int RoomSnapshot::deltas_size() const {
+  return _internal_deltas_size();
 }
-inline const ::state::HitState& WorldState::_internal_hitstate() const {
-  return *hitstate_;
+inline void RoomSnapshot::clear_deltas() {
+  _impl_.deltas_.Clear();
 }
-inline const ::state::HitState& WorldState::hitstate() const {
-  const ::state::HitState* p = hitstate_;
-  // @@protoc_insertion_point(field_get:state.WorldState.hitState)
-  return p != NULL ? *p : *reinterpret_cast<const ::state::HitState*>(
-      &::state::_HitState_default_instance_);
+inline ::state::StateDelta* RoomSnapshot::mutable_deltas(int index) {
+  // @@protoc_insertion_point(field_mutable:state.RoomSnapshot.deltas)
+  return _impl_.deltas_.Mutable(index);
 }
-inline ::state::HitState* WorldState::release_hitstate() {
-  // @@protoc_insertion_point(field_release:state.WorldState.hitState)
-  
-  ::state::HitState* temp = hitstate_;
-  hitstate_ = NULL;
-  return temp;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::state::StateDelta >*
+RoomSnapshot::mutable_deltas() {
+  // @@protoc_insertion_point(field_mutable_list:state.RoomSnapshot.deltas)
+  return &_impl_.deltas_;
 }
-inline ::state::HitState* WorldState::mutable_hitstate() {
-  
-  if (hitstate_ == NULL) {
-    auto* p = CreateMaybeMessage<::state::HitState>(GetArenaNoVirtual());
-    hitstate_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:state.WorldState.hitState)
-  return hitstate_;
+inline const ::state::StateDelta& RoomSnapshot::_internal_deltas(int index) const {
+  return _impl_.deltas_.Get(index);
 }
-inline void WorldState::set_allocated_hitstate(::state::HitState* hitstate) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete hitstate_;
-  }
-  if (hitstate) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      hitstate = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, hitstate, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  hitstate_ = hitstate;
-  // @@protoc_insertion_point(field_set_allocated:state.WorldState.hitState)
+inline const ::state::StateDelta& RoomSnapshot::deltas(int index) const {
+  // @@protoc_insertion_point(field_get:state.RoomSnapshot.deltas)
+  return _internal_deltas(index);
 }
-
-// int32 killPoint = 8;
-inline void WorldState::clear_killpoint() {
-  killpoint_ = 0;
+inline ::state::StateDelta* RoomSnapshot::_internal_add_deltas() {
+  return _impl_.deltas_.Add();
 }
-inline ::google::protobuf::int32 WorldState::killpoint() const {
-  // @@protoc_insertion_point(field_get:state.WorldState.killPoint)
-  return killpoint_;
+inline ::state::StateDelta* RoomSnapshot::add_deltas() {
+  ::state::StateDelta* _add = _internal_add_deltas();
+  // @@protoc_insertion_point(field_add:state.RoomSnapshot.deltas)
+  return _add;
 }
-inline void WorldState::set_killpoint(::google::protobuf::int32 value) {
-  
-  killpoint_ = value;
-  // @@protoc_insertion_point(field_set:state.WorldState.killPoint)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::state::StateDelta >&
+RoomSnapshot::deltas() const {
+  // @@protoc_insertion_point(field_list:state.RoomSnapshot.deltas)
+  return _impl_.deltas_;
 }
 
-// int32 deathPoint = 9;
-inline void WorldState::clear_deathpoint() {
-  deathpoint_ = 0;
+// uint32 visible = 6;
+inline void RoomSnapshot::clear_visible() {
+  _impl_.visible_ = 0u;
 }
-inline ::google::protobuf::int32 WorldState::deathpoint() const {
-  // @@protoc_insertion_point(field_get:state.WorldState.deathPoint)
-  return deathpoint_;
+inline uint32_t RoomSnapshot::_internal_visible() const {
+  return _impl_.visible_;
 }
-inline void WorldState::set_deathpoint(::google::protobuf::int32 value) {
+inline uint32_t RoomSnapshot::visible() const {
+  // @@protoc_insertion_point(field_get:state.RoomSnapshot.visible)
+  return _internal_visible();
+}
+inline void RoomSnapshot::_internal_set_visible(uint32_t value) {
   
-  deathpoint_ = value;
-  // @@protoc_insertion_point(field_set:state.WorldState.deathPoint)
+  _impl_.visible_ = value;
+}
+inline void RoomSnapshot::set_visible(uint32_t value) {
+  _internal_set_visible(value);
+  // @@protoc_insertion_point(field_set:state.RoomSnapshot.visible)
 }
 
-// int32 animState = 10;
-inline void WorldState::clear_animstate() {
-  animstate_ = 0;
+// -------------------------------------------------------------------
+
+// SnapshotAck
+
+// uint32 tick = 1;
+inline void SnapshotAck::clear_tick() {
+  _impl_.tick_ = 0u;
 }
-inline ::google::protobuf::int32 WorldState::animstate() const {
-  // @@protoc_insertion_point(field_get:state.WorldState.animState)
-  return animstate_;
+inline uint32_t SnapshotAck::_internal_tick() const {
+  return _impl_.tick_;
+}
+inline uint32_t SnapshotAck::tick() const {
+  // @@protoc_insertion_point(field_get:state.SnapshotAck.tick)
+  return _internal_tick();
 }
-inline void WorldState::set_animstate(::google::protobuf::int32 value) {
+inline void SnapshotAck::_internal_set_tick(uint32_t value) {
   
-  animstate_ = value;
-  // @@protoc_insertion_point(field_set:state.WorldState.animState)
+  _impl_.tick_ = value;
+}
+inline void SnapshotAck::set_tick(uint32_t value) {
+  _internal_set_tick(value);
+  // @@protoc_insertion_point(field_set:state.SnapshotAck.tick)
 }
 
 #ifdef __GNUC__
@@ -1601,6 +3671,14 @@ inline void WorldState::set_animstate(::google::protobuf::int32 value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -1608,4 +3686,5 @@ inline void WorldState::set_animstate(::google::protobuf::int32 value) {
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_PlayState_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_PlayState_2eproto
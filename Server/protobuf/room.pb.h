@@ -1,31 +1,31 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: room.proto
 
-#ifndef PROTOBUF_INCLUDED_room_2eproto
-#define PROTOBUF_INCLUDED_room_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_room_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_room_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
@@ -34,76 +34,86 @@
 #include <google/protobuf/map_field_inl.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_room_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_room_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_room_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[4];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_room_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-}  // namespace protobuf_room_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_room_2eproto;
 namespace packet {
 class Client;
-class ClientDefaultTypeInternal;
+struct ClientDefaultTypeInternal;
 extern ClientDefaultTypeInternal _Client_default_instance_;
 class RoomInfo;
-class RoomInfoDefaultTypeInternal;
+struct RoomInfoDefaultTypeInternal;
 extern RoomInfoDefaultTypeInternal _RoomInfo_default_instance_;
 class RoomList;
-class RoomListDefaultTypeInternal;
+struct RoomListDefaultTypeInternal;
 extern RoomListDefaultTypeInternal _RoomList_default_instance_;
 class RoomList_RoomsEntry_DoNotUse;
-class RoomList_RoomsEntry_DoNotUseDefaultTypeInternal;
+struct RoomList_RoomsEntry_DoNotUseDefaultTypeInternal;
 extern RoomList_RoomsEntry_DoNotUseDefaultTypeInternal _RoomList_RoomsEntry_DoNotUse_default_instance_;
 }  // namespace packet
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 template<> ::packet::Client* Arena::CreateMaybeMessage<::packet::Client>(Arena*);
 template<> ::packet::RoomInfo* Arena::CreateMaybeMessage<::packet::RoomInfo>(Arena*);
 template<> ::packet::RoomList* Arena::CreateMaybeMessage<::packet::RoomList>(Arena*);
 template<> ::packet::RoomList_RoomsEntry_DoNotUse* Arena::CreateMaybeMessage<::packet::RoomList_RoomsEntry_DoNotUse>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 namespace packet {
 
 // ===================================================================
 
-class Client : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:packet.Client) */ {
+class Client final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:packet.Client) */ {
  public:
-  Client();
-  virtual ~Client();
+  inline Client() : Client(nullptr) {}
+  ~Client() override;
+  explicit PROTOBUF_CONSTEXPR Client(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Client(const Client& from);
-
-  inline Client& operator=(const Client& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Client(Client&& from) noexcept
     : Client() {
     *this = ::std::move(from);
   }
 
+  inline Client& operator=(const Client& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Client& operator=(Client&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Client& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Client& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Client* internal_default_instance() {
     return reinterpret_cast<const Client*>(
                &_Client_default_instance_);
@@ -111,131 +121,185 @@ class Client : public ::google::protobuf::Message /* @@protoc_insertion_point(cl
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(Client* other);
   friend void swap(Client& a, Client& b) {
     a.Swap(&b);
   }
+  inline void Swap(Client* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Client* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Client* New() const final {
-    return CreateMaybeMessage<Client>(NULL);
-  }
-
-  Client* New(::google::protobuf::Arena* arena) const final {
+  Client* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Client>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Client& from);
-  void MergeFrom(const Client& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Client& from) {
+    Client::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Client* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "packet.Client";
   }
+  protected:
+  explicit Client(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 2,
+    kClntIdFieldNumber = 1,
+    kPositionFieldNumber = 3,
+    kReadyFieldNumber = 4,
+  };
   // string name = 2;
   void clear_name();
-  static const int kNameFieldNumber = 2;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // int32 clntId = 1;
   void clear_clntid();
-  static const int kClntIdFieldNumber = 1;
-  ::google::protobuf::int32 clntid() const;
-  void set_clntid(::google::protobuf::int32 value);
+  int32_t clntid() const;
+  void set_clntid(int32_t value);
+  private:
+  int32_t _internal_clntid() const;
+  void _internal_set_clntid(int32_t value);
+  public:
 
   // int32 position = 3;
   void clear_position();
-  static const int kPositionFieldNumber = 3;
-  ::google::protobuf::int32 position() const;
-  void set_position(::google::protobuf::int32 value);
+  int32_t position() const;
+  void set_position(int32_t value);
+  private:
+  int32_t _internal_position() const;
+  void _internal_set_position(int32_t value);
+  public:
 
   // bool ready = 4;
   void clear_ready();
-  static const int kReadyFieldNumber = 4;
   bool ready() const;
   void set_ready(bool value);
+  private:
+  bool _internal_ready() const;
+  void _internal_set_ready(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:packet.Client)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::google::protobuf::int32 clntid_;
-  ::google::protobuf::int32 position_;
-  bool ready_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_room_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int32_t clntid_;
+    int32_t position_;
+    bool ready_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_room_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RoomInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:packet.RoomInfo) */ {
+class RoomInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:packet.RoomInfo) */ {
  public:
-  RoomInfo();
-  virtual ~RoomInfo();
+  inline RoomInfo() : RoomInfo(nullptr) {}
+  ~RoomInfo() override;
+  explicit PROTOBUF_CONSTEXPR RoomInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RoomInfo(const RoomInfo& from);
-
-  inline RoomInfo& operator=(const RoomInfo& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RoomInfo(RoomInfo&& from) noexcept
     : RoomInfo() {
     *this = ::std::move(from);
   }
 
+  inline RoomInfo& operator=(const RoomInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RoomInfo& operator=(RoomInfo&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RoomInfo& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomInfo& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RoomInfo* internal_default_instance() {
     return reinterpret_cast<const RoomInfo*>(
                &_RoomInfo_default_instance_);
@@ -243,192 +307,271 @@ class RoomInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(RoomInfo* other);
   friend void swap(RoomInfo& a, RoomInfo& b) {
     a.Swap(&b);
   }
+  inline void Swap(RoomInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RoomInfo* New() const final {
-    return CreateMaybeMessage<RoomInfo>(NULL);
-  }
-
-  RoomInfo* New(::google::protobuf::Arena* arena) const final {
+  RoomInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RoomInfo>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RoomInfo& from);
-  void MergeFrom(const RoomInfo& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomInfo& from) {
+    RoomInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RoomInfo* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "packet.RoomInfo";
   }
+  protected:
+  explicit RoomInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kRedTeamFieldNumber = 5,
+    kBlueTeamFieldNumber = 6,
+    kNameFieldNumber = 2,
+    kRoomIdFieldNumber = 1,
+    kLimitFieldNumber = 3,
+    kCurrentFieldNumber = 4,
+    kReadyCountFieldNumber = 7,
+    kHostFieldNumber = 8,
+  };
   // repeated .packet.Client redTeam = 5;
   int redteam_size() const;
+  private:
+  int _internal_redteam_size() const;
+  public:
   void clear_redteam();
-  static const int kRedTeamFieldNumber = 5;
   ::packet::Client* mutable_redteam(int index);
-  ::google::protobuf::RepeatedPtrField< ::packet::Client >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::packet::Client >*
       mutable_redteam();
+  private:
+  const ::packet::Client& _internal_redteam(int index) const;
+  ::packet::Client* _internal_add_redteam();
+  public:
   const ::packet::Client& redteam(int index) const;
   ::packet::Client* add_redteam();
-  const ::google::protobuf::RepeatedPtrField< ::packet::Client >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::packet::Client >&
       redteam() const;
 
   // repeated .packet.Client blueTeam = 6;
   int blueteam_size() const;
+  private:
+  int _internal_blueteam_size() const;
+  public:
   void clear_blueteam();
-  static const int kBlueTeamFieldNumber = 6;
   ::packet::Client* mutable_blueteam(int index);
-  ::google::protobuf::RepeatedPtrField< ::packet::Client >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::packet::Client >*
       mutable_blueteam();
+  private:
+  const ::packet::Client& _internal_blueteam(int index) const;
+  ::packet::Client* _internal_add_blueteam();
+  public:
   const ::packet::Client& blueteam(int index) const;
   ::packet::Client* add_blueteam();
-  const ::google::protobuf::RepeatedPtrField< ::packet::Client >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::packet::Client >&
       blueteam() const;
 
   // string name = 2;
   void clear_name();
-  static const int kNameFieldNumber = 2;
-  const ::std::string& name() const;
-  void set_name(const ::std::string& value);
-  #if LANG_CXX11
-  void set_name(::std::string&& value);
-  #endif
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  ::std::string* mutable_name();
-  ::std::string* release_name();
-  void set_allocated_name(::std::string* name);
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // int32 roomId = 1;
   void clear_roomid();
-  static const int kRoomIdFieldNumber = 1;
-  ::google::protobuf::int32 roomid() const;
-  void set_roomid(::google::protobuf::int32 value);
+  int32_t roomid() const;
+  void set_roomid(int32_t value);
+  private:
+  int32_t _internal_roomid() const;
+  void _internal_set_roomid(int32_t value);
+  public:
 
   // int32 limit = 3;
   void clear_limit();
-  static const int kLimitFieldNumber = 3;
-  ::google::protobuf::int32 limit() const;
-  void set_limit(::google::protobuf::int32 value);
+  int32_t limit() const;
+  void set_limit(int32_t value);
+  private:
+  int32_t _internal_limit() const;
+  void _internal_set_limit(int32_t value);
+  public:
 
   // int32 current = 4;
   void clear_current();
-  static const int kCurrentFieldNumber = 4;
-  ::google::protobuf::int32 current() const;
-  void set_current(::google::protobuf::int32 value);
+  int32_t current() const;
+  void set_current(int32_t value);
+  private:
+  int32_t _internal_current() const;
+  void _internal_set_current(int32_t value);
+  public:
 
   // int32 readyCount = 7;
   void clear_readycount();
-  static const int kReadyCountFieldNumber = 7;
-  ::google::protobuf::int32 readycount() const;
-  void set_readycount(::google::protobuf::int32 value);
+  int32_t readycount() const;
+  void set_readycount(int32_t value);
+  private:
+  int32_t _internal_readycount() const;
+  void _internal_set_readycount(int32_t value);
+  public:
 
   // int32 host = 8;
   void clear_host();
-  static const int kHostFieldNumber = 8;
-  ::google::protobuf::int32 host() const;
-  void set_host(::google::protobuf::int32 value);
+  int32_t host() const;
+  void set_host(int32_t value);
+  private:
+  int32_t _internal_host() const;
+  void _internal_set_host(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:packet.RoomInfo)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::packet::Client > redteam_;
-  ::google::protobuf::RepeatedPtrField< ::packet::Client > blueteam_;
-  ::google::protobuf::internal::ArenaStringPtr name_;
-  ::google::protobuf::int32 roomid_;
-  ::google::protobuf::int32 limit_;
-  ::google::protobuf::int32 current_;
-  ::google::protobuf::int32 readycount_;
-  ::google::protobuf::int32 host_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_room_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::packet::Client > redteam_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::packet::Client > blueteam_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int32_t roomid_;
+    int32_t limit_;
+    int32_t current_;
+    int32_t readycount_;
+    int32_t host_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_room_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RoomList_RoomsEntry_DoNotUse : public ::google::protobuf::internal::MapEntry<RoomList_RoomsEntry_DoNotUse, 
-    ::google::protobuf::int32, ::packet::RoomInfo,
-    ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
-    ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
-    0 > {
+class RoomList_RoomsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<RoomList_RoomsEntry_DoNotUse, 
+    int32_t, ::packet::RoomInfo,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> {
 public:
-  typedef ::google::protobuf::internal::MapEntry<RoomList_RoomsEntry_DoNotUse, 
-    ::google::protobuf::int32, ::packet::RoomInfo,
-    ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
-    ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
-    0 > SuperType;
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<RoomList_RoomsEntry_DoNotUse, 
+    int32_t, ::packet::RoomInfo,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> SuperType;
   RoomList_RoomsEntry_DoNotUse();
-  RoomList_RoomsEntry_DoNotUse(::google::protobuf::Arena* arena);
+  explicit PROTOBUF_CONSTEXPR RoomList_RoomsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit RoomList_RoomsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   void MergeFrom(const RoomList_RoomsEntry_DoNotUse& other);
   static const RoomList_RoomsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const RoomList_RoomsEntry_DoNotUse*>(&_RoomList_RoomsEntry_DoNotUse_default_instance_); }
-  void MergeFrom(const ::google::protobuf::Message& other) final;
-  ::google::protobuf::Metadata GetMetadata() const;
+  static bool ValidateKey(void*) { return true; }
+  static bool ValidateValue(void*) { return true; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_room_2eproto;
 };
 
 // -------------------------------------------------------------------
 
-class RoomList : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:packet.RoomList) */ {
+class RoomList final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:packet.RoomList) */ {
  public:
-  RoomList();
-  virtual ~RoomList();
+  inline RoomList() : RoomList(nullptr) {}
+  ~RoomList() override;
+  explicit PROTOBUF_CONSTEXPR RoomList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RoomList(const RoomList& from);
-
-  inline RoomList& operator=(const RoomList& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RoomList(RoomList&& from) noexcept
     : RoomList() {
     *this = ::std::move(from);
   }
 
+  inline RoomList& operator=(const RoomList& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RoomList& operator=(RoomList&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RoomList& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomList& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RoomList* internal_default_instance() {
     return reinterpret_cast<const RoomList*>(
                &_RoomList_default_instance_);
@@ -436,78 +579,116 @@ class RoomList : public ::google::protobuf::Message /* @@protoc_insertion_point(
   static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(RoomList* other);
   friend void swap(RoomList& a, RoomList& b) {
     a.Swap(&b);
   }
+  inline void Swap(RoomList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RoomList* New() const final {
-    return CreateMaybeMessage<RoomList>(NULL);
-  }
-
-  RoomList* New(::google::protobuf::Arena* arena) const final {
+  RoomList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RoomList>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RoomList& from);
-  void MergeFrom(const RoomList& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomList& from) {
+    RoomList::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RoomList* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "packet.RoomList";
   }
+  protected:
+  explicit RoomList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kRoomsFieldNumber = 1,
+  };
   // map<int32, .packet.RoomInfo> rooms = 1;
   int rooms_size() const;
+  private:
+  int _internal_rooms_size() const;
+  public:
   void clear_rooms();
-  static const int kRoomsFieldNumber = 1;
-  const ::google::protobuf::Map< ::google::protobuf::int32, ::packet::RoomInfo >&
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::packet::RoomInfo >&
+      _internal_rooms() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::packet::RoomInfo >*
+      _internal_mutable_rooms();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::packet::RoomInfo >&
       rooms() const;
-  ::google::protobuf::Map< ::google::protobuf::int32, ::packet::RoomInfo >*
+  ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::packet::RoomInfo >*
       mutable_rooms();
 
   // @@protoc_insertion_point(class_scope:packet.RoomList)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::MapField<
-      RoomList_RoomsEntry_DoNotUse,
-      ::google::protobuf::int32, ::packet::RoomInfo,
-      ::google::protobuf::internal::WireFormatLite::TYPE_INT32,
-      ::google::protobuf::internal::WireFormatLite::TYPE_MESSAGE,
-      0 > rooms_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_room_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        RoomList_RoomsEntry_DoNotUse,
+        int32_t, ::packet::RoomInfo,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT32,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> rooms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_room_2eproto;
 };
 // ===================================================================
 
@@ -522,96 +703,111 @@ class RoomList : public ::google::protobuf::Message /* @@protoc_insertion_point(
 
 // int32 clntId = 1;
 inline void Client::clear_clntid() {
-  clntid_ = 0;
+  _impl_.clntid_ = 0;
+}
+inline int32_t Client::_internal_clntid() const {
+  return _impl_.clntid_;
 }
-inline ::google::protobuf::int32 Client::clntid() const {
+inline int32_t Client::clntid() const {
   // @@protoc_insertion_point(field_get:packet.Client.clntId)
-  return clntid_;
+  return _internal_clntid();
 }
-inline void Client::set_clntid(::google::protobuf::int32 value) {
+inline void Client::_internal_set_clntid(int32_t value) {
   
-  clntid_ = value;
+  _impl_.clntid_ = value;
+}
+inline void Client::set_clntid(int32_t value) {
+  _internal_set_clntid(value);
   // @@protoc_insertion_point(field_set:packet.Client.clntId)
 }
 
 // string name = 2;
 inline void Client::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& Client::name() const {
+inline const std::string& Client::name() const {
   // @@protoc_insertion_point(field_get:packet.Client.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void Client::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Client::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:packet.Client.name)
 }
-#if LANG_CXX11
-inline void Client::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:packet.Client.name)
+inline std::string* Client::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:packet.Client.name)
+  return _s;
 }
-#endif
-inline void Client::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:packet.Client.name)
+inline const std::string& Client::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void Client::set_name(const char* value, size_t size) {
+inline void Client::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:packet.Client.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* Client::mutable_name() {
+inline std::string* Client::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:packet.Client.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* Client::release_name() {
+inline std::string* Client::release_name() {
   // @@protoc_insertion_point(field_release:packet.Client.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void Client::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void Client::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:packet.Client.name)
 }
 
 // int32 position = 3;
 inline void Client::clear_position() {
-  position_ = 0;
+  _impl_.position_ = 0;
 }
-inline ::google::protobuf::int32 Client::position() const {
+inline int32_t Client::_internal_position() const {
+  return _impl_.position_;
+}
+inline int32_t Client::position() const {
   // @@protoc_insertion_point(field_get:packet.Client.position)
-  return position_;
+  return _internal_position();
 }
-inline void Client::set_position(::google::protobuf::int32 value) {
+inline void Client::_internal_set_position(int32_t value) {
   
-  position_ = value;
+  _impl_.position_ = value;
+}
+inline void Client::set_position(int32_t value) {
+  _internal_set_position(value);
   // @@protoc_insertion_point(field_set:packet.Client.position)
 }
 
 // bool ready = 4;
 inline void Client::clear_ready() {
-  ready_ = false;
+  _impl_.ready_ = false;
+}
+inline bool Client::_internal_ready() const {
+  return _impl_.ready_;
 }
 inline bool Client::ready() const {
   // @@protoc_insertion_point(field_get:packet.Client.ready)
-  return ready_;
+  return _internal_ready();
 }
-inline void Client::set_ready(bool value) {
+inline void Client::_internal_set_ready(bool value) {
   
-  ready_ = value;
+  _impl_.ready_ = value;
+}
+inline void Client::set_ready(bool value) {
+  _internal_set_ready(value);
   // @@protoc_insertion_point(field_set:packet.Client.ready)
 }
 
@@ -621,184 +817,231 @@ inline void Client::set_ready(bool value) {
 
 // int32 roomId = 1;
 inline void RoomInfo::clear_roomid() {
-  roomid_ = 0;
+  _impl_.roomid_ = 0;
+}
+inline int32_t RoomInfo::_internal_roomid() const {
+  return _impl_.roomid_;
 }
-inline ::google::protobuf::int32 RoomInfo::roomid() const {
+inline int32_t RoomInfo::roomid() const {
   // @@protoc_insertion_point(field_get:packet.RoomInfo.roomId)
-  return roomid_;
+  return _internal_roomid();
 }
-inline void RoomInfo::set_roomid(::google::protobuf::int32 value) {
+inline void RoomInfo::_internal_set_roomid(int32_t value) {
   
-  roomid_ = value;
+  _impl_.roomid_ = value;
+}
+inline void RoomInfo::set_roomid(int32_t value) {
+  _internal_set_roomid(value);
   // @@protoc_insertion_point(field_set:packet.RoomInfo.roomId)
 }
 
 // string name = 2;
 inline void RoomInfo::clear_name() {
-  name_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.ClearToEmpty();
 }
-inline const ::std::string& RoomInfo::name() const {
+inline const std::string& RoomInfo::name() const {
   // @@protoc_insertion_point(field_get:packet.RoomInfo.name)
-  return name_.GetNoArena();
+  return _internal_name();
 }
-inline void RoomInfo::set_name(const ::std::string& value) {
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RoomInfo::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:packet.RoomInfo.name)
 }
-#if LANG_CXX11
-inline void RoomInfo::set_name(::std::string&& value) {
-  
-  name_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:packet.RoomInfo.name)
+inline std::string* RoomInfo::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:packet.RoomInfo.name)
+  return _s;
 }
-#endif
-inline void RoomInfo::set_name(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:packet.RoomInfo.name)
+inline const std::string& RoomInfo::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void RoomInfo::set_name(const char* value, size_t size) {
+inline void RoomInfo::_internal_set_name(const std::string& value) {
   
-  name_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:packet.RoomInfo.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RoomInfo::mutable_name() {
+inline std::string* RoomInfo::_internal_mutable_name() {
   
-  // @@protoc_insertion_point(field_mutable:packet.RoomInfo.name)
-  return name_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* RoomInfo::release_name() {
+inline std::string* RoomInfo::release_name() {
   // @@protoc_insertion_point(field_release:packet.RoomInfo.name)
-  
-  return name_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.name_.Release();
 }
-inline void RoomInfo::set_allocated_name(::std::string* name) {
-  if (name != NULL) {
+inline void RoomInfo::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), name);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:packet.RoomInfo.name)
 }
 
 // int32 limit = 3;
 inline void RoomInfo::clear_limit() {
-  limit_ = 0;
+  _impl_.limit_ = 0;
+}
+inline int32_t RoomInfo::_internal_limit() const {
+  return _impl_.limit_;
 }
-inline ::google::protobuf::int32 RoomInfo::limit() const {
+inline int32_t RoomInfo::limit() const {
   // @@protoc_insertion_point(field_get:packet.RoomInfo.limit)
-  return limit_;
+  return _internal_limit();
 }
-inline void RoomInfo::set_limit(::google::protobuf::int32 value) {
+inline void RoomInfo::_internal_set_limit(int32_t value) {
   
-  limit_ = value;
+  _impl_.limit_ = value;
+}
+inline void RoomInfo::set_limit(int32_t value) {
+  _internal_set_limit(value);
   // @@protoc_insertion_point(field_set:packet.RoomInfo.limit)
 }
 
 // int32 current = 4;
 inline void RoomInfo::clear_current() {
-  current_ = 0;
+  _impl_.current_ = 0;
+}
+inline int32_t RoomInfo::_internal_current() const {
+  return _impl_.current_;
 }
-inline ::google::protobuf::int32 RoomInfo::current() const {
+inline int32_t RoomInfo::current() const {
   // @@protoc_insertion_point(field_get:packet.RoomInfo.current)
-  return current_;
+  return _internal_current();
 }
-inline void RoomInfo::set_current(::google::protobuf::int32 value) {
+inline void RoomInfo::_internal_set_current(int32_t value) {
   
-  current_ = value;
+  _impl_.current_ = value;
+}
+inline void RoomInfo::set_current(int32_t value) {
+  _internal_set_current(value);
   // @@protoc_insertion_point(field_set:packet.RoomInfo.current)
 }
 
 // repeated .packet.Client redTeam = 5;
+inline int RoomInfo::_internal_redteam_size() const {
+  return _impl_.redteam_.size();
+}
 inline int RoomInfo::redteam_size() const {
-  return redteam_.size();
+  return _internal_redteam_size();
 }
 inline void RoomInfo::clear_redteam() {
-  redteam_.Clear();
+  _impl_.redteam_.Clear();
 }
 inline ::packet::Client* RoomInfo::mutable_redteam(int index) {
   // @@protoc_insertion_point(field_mutable:packet.RoomInfo.redTeam)
-  return redteam_.Mutable(index);
+  return _impl_.redteam_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField< ::packet::Client >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::packet::Client >*
 RoomInfo::mutable_redteam() {
   // @@protoc_insertion_point(field_mutable_list:packet.RoomInfo.redTeam)
-  return &redteam_;
+  return &_impl_.redteam_;
+}
+inline const ::packet::Client& RoomInfo::_internal_redteam(int index) const {
+  return _impl_.redteam_.Get(index);
 }
 inline const ::packet::Client& RoomInfo::redteam(int index) const {
   // @@protoc_insertion_point(field_get:packet.RoomInfo.redTeam)
-  return redteam_.Get(index);
+  return _internal_redteam(index);
+}
+inline ::packet::Client* RoomInfo::_internal_add_redteam() {
+  return _impl_.redteam_.Add();
 }
 inline ::packet::Client* RoomInfo::add_redteam() {
+  ::packet::Client* _add = _internal_add_redteam();
   // @@protoc_insertion_point(field_add:packet.RoomInfo.redTeam)
-  return redteam_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::packet::Client >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::packet::Client >&
 RoomInfo::redteam() const {
   // @@protoc_insertion_point(field_list:packet.RoomInfo.redTeam)
-  return redteam_;
+  return _impl_.redteam_;
 }
 
 // repeated .packet.Client blueTeam = 6;
+inline int RoomInfo::_internal_blueteam_size() const {
+  return _impl_.blueteam_.size();
+}
 inline int RoomInfo::blueteam_size() const {
-  return blueteam_.size();
+  return _internal_blueteam_size();
 }
 inline void RoomInfo::clear_blueteam() {
-  blueteam_.Clear();
+  _impl_.blueteam_.Clear();
 }
 inline ::packet::Client* RoomInfo::mutable_blueteam(int index) {
   // @@protoc_insertion_point(field_mutable:packet.RoomInfo.blueTeam)
-  return blueteam_.Mutable(index);
+  return _impl_.blueteam_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField< ::packet::Client >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::packet::Client >*
 RoomInfo::mutable_blueteam() {
   // @@protoc_insertion_point(field_mutable_list:packet.RoomInfo.blueTeam)
-  return &blueteam_;
+  return &_impl_.blueteam_;
+}
+inline const ::packet::Client& RoomInfo::_internal_blueteam(int index) const {
+  return _impl_.blueteam_.Get(index);
 }
 inline const ::packet::Client& RoomInfo::blueteam(int index) const {
   // @@protoc_insertion_point(field_get:packet.RoomInfo.blueTeam)
-  return blueteam_.Get(index);
+  return _internal_blueteam(index);
+}
+inline ::packet::Client* RoomInfo::_internal_add_blueteam() {
+  return _impl_.blueteam_.Add();
 }
 inline ::packet::Client* RoomInfo::add_blueteam() {
+  ::packet::Client* _add = _internal_add_blueteam();
   // @@protoc_insertion_point(field_add:packet.RoomInfo.blueTeam)
-  return blueteam_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::packet::Client >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::packet::Client >&
 RoomInfo::blueteam() const {
   // @@protoc_insertion_point(field_list:packet.RoomInfo.blueTeam)
-  return blueteam_;
+  return _impl_.blueteam_;
 }
 
 // int32 readyCount = 7;
 inline void RoomInfo::clear_readycount() {
-  readycount_ = 0;
+  _impl_.readycount_ = 0;
+}
+inline int32_t RoomInfo::_internal_readycount() const {
+  return _impl_.readycount_;
 }
-inline ::google::protobuf::int32 RoomInfo::readycount() const {
+inline int32_t RoomInfo::readycount() const {
   // @@protoc_insertion_point(field_get:packet.RoomInfo.readyCount)
-  return readycount_;
+  return _internal_readycount();
 }
-inline void RoomInfo::set_readycount(::google::protobuf::int32 value) {
+inline void RoomInfo::_internal_set_readycount(int32_t value) {
   
-  readycount_ = value;
+  _impl_.readycount_ = value;
+}
+inline void RoomInfo::set_readycount(int32_t value) {
+  _internal_set_readycount(value);
   // @@protoc_insertion_point(field_set:packet.RoomInfo.readyCount)
 }
 
 // int32 host = 8;
 inline void RoomInfo::clear_host() {
-  host_ = 0;
+  _impl_.host_ = 0;
+}
+inline int32_t RoomInfo::_internal_host() const {
+  return _impl_.host_;
 }
-inline ::google::protobuf::int32 RoomInfo::host() const {
+inline int32_t RoomInfo::host() const {
   // @@protoc_insertion_point(field_get:packet.RoomInfo.host)
-  return host_;
+  return _internal_host();
 }
-inline void RoomInfo::set_host(::google::protobuf::int32 value) {
+inline void RoomInfo::_internal_set_host(int32_t value) {
   
-  host_ = value;
+  _impl_.host_ = value;
+}
+inline void RoomInfo::set_host(int32_t value) {
+  _internal_set_host(value);
   // @@protoc_insertion_point(field_set:packet.RoomInfo.host)
 }
 
@@ -809,21 +1052,32 @@ inline void RoomInfo::set_host(::google::protobuf::int32 value) {
 // RoomList
 
 // map<int32, .packet.RoomInfo> rooms = 1;
+inline int RoomList::_internal_rooms_size() const {
+  return _impl_.rooms_.size();
+}
 inline int RoomList::rooms_size() const {
-  return rooms_.size();
+  return _internal_rooms_size();
 }
 inline void RoomList::clear_rooms() {
-  rooms_.Clear();
+  _impl_.rooms_.Clear();
 }
-inline const ::google::protobuf::Map< ::google::protobuf::int32, ::packet::RoomInfo >&
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::packet::RoomInfo >&
+RoomList::_internal_rooms() const {
+  return _impl_.rooms_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::packet::RoomInfo >&
 RoomList::rooms() const {
   // @@protoc_insertion_point(field_map:packet.RoomList.rooms)
-  return rooms_.GetMap();
+  return _internal_rooms();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::packet::RoomInfo >*
+RoomList::_internal_mutable_rooms() {
+  return _impl_.rooms_.MutableMap();
 }
-inline ::google::protobuf::Map< ::google::protobuf::int32, ::packet::RoomInfo >*
+inline ::PROTOBUF_NAMESPACE_ID::Map< int32_t, ::packet::RoomInfo >*
 RoomList::mutable_rooms() {
   // @@protoc_insertion_point(field_mutable_map:packet.RoomList.rooms)
-  return rooms_.MutableMap();
+  return _internal_mutable_rooms();
 }
 
 #ifdef __GNUC__
@@ -842,4 +1096,5 @@ RoomList::mutable_rooms() {
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_room_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_room_2eproto
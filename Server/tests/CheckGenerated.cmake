@@ -0,0 +1,36 @@
+# Regenerates protobuf/*.pb.* from the .proto files and fails if the checked-in code differs,
+# so a .proto change cannot go in without its generated code.
+# cmake -DPROTOC=<protoc> -DPROTO_DIR=<Server/protobuf> -DWORK_DIR=<scratch dir> -P CheckGenerated.cmake
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR}/proto ${WORK_DIR}/out)
+
+# Room.proto was generated as room.proto on Windows; its code is room.pb.*
+configure_file(${PROTO_DIR}/PlayState.proto ${WORK_DIR}/proto/PlayState.proto COPYONLY)
+configure_file(${PROTO_DIR}/data.proto ${WORK_DIR}/proto/data.proto COPYONLY)
+configure_file(${PROTO_DIR}/Room.proto ${WORK_DIR}/proto/room.proto COPYONLY)
+
+execute_process(
+	COMMAND ${PROTOC} -I${WORK_DIR}/proto --cpp_out=${WORK_DIR}/out
+		${WORK_DIR}/proto/PlayState.proto ${WORK_DIR}/proto/data.proto ${WORK_DIR}/proto/room.proto
+	RESULT_VARIABLE result)
+if (NOT result EQUAL 0)
+	message(FATAL_ERROR "protoc failed")
+endif()
+
+set(stale "")
+foreach (name PlayState data room)
+	foreach (ext pb.h pb.cc)
+		execute_process(
+			COMMAND ${CMAKE_COMMAND} -E compare_files ${WORK_DIR}/out/${name}.${ext} ${PROTO_DIR}/${name}.${ext}
+			RESULT_VARIABLE result)
+		if (NOT result EQUAL 0)
+			list(APPEND stale ${name}.${ext})
+		endif()
+	endforeach()
+endforeach()
+
+if (stale)
+	execute_process(COMMAND ${PROTOC} --version OUTPUT_VARIABLE version OUTPUT_STRIP_TRAILING_WHITESPACE)
+	message(FATAL_ERROR "out of date with the .proto files (checked in with libprotoc 3.21.12, this is ${version}): ${stale}")
+endif()
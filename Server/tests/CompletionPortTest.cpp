@@ -0,0 +1,147 @@
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "CompletionPort.h"
+
+#define WORKERS 4
+#define POSTED 20000
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+			++failures; \
+		} \
+	} while (0)
+
+static void TestPostAndTimeout()
+{
+	CompletionPort port;
+	CHECK(port.Create(2));
+
+	CompletionEntry entry;
+	CHECK(!port.Dequeue(entry, 50));
+
+	CHECK(port.Post(7, 42));
+	CHECK(port.Dequeue(entry, 1000));
+	CHECK(entry.completionKey == 42 && entry.dwBytesTransferred == 7 && entry.lpRequest == nullptr);
+}
+
+// every posted entry reaches exactly one of several workers
+static void TestWorkers()
+{
+	CompletionPort port;
+	CHECK(port.Create(WORKERS));
+
+	std::atomic<long long> sum(0);
+	std::atomic<int> count(0);
+	std::atomic<bool> done(false);
+	std::vector<std::thread> workers;
+	for (int i = 0; i < WORKERS; ++i)
+	{
+		workers.emplace_back([&] {
+			CompletionEntry entries[16];
+			while (!done)
+			{
+				int taken = port.DequeueBatch(entries, 16, 50);
+				for (int j = 0; j < taken; ++j)
+				{
+					sum += entries[j].dwBytesTransferred;
+					++count;
+				}
+			}
+		});
+	}
+
+	long long expected = 0;
+	for (int i = 1; i <= POSTED; ++i)
+	{
+		port.Post(i, 1);
+		expected += i;
+	}
+	for (int waited = 0; count < POSTED && waited < 5000; ++waited)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	done = true;
+	for (std::thread& worker : workers)
+		worker.join();
+
+	CHECK(count == POSTED);
+	CHECK(sum == expected);
+}
+
+static void TestSocketIo()
+{
+	CompletionPort port;
+	CHECK(port.Create(1));
+
+	int fds[2];
+	CHECK(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+	CHECK(port.Associate(fds[0], 1));
+	CHECK(port.Associate(fds[1], 2));
+
+	char recvData[64] = {};
+	WSABUF recvBuf = { sizeof(recvData), recvData };
+	IoRequest recvRequest;
+	recvRequest.buffers = &recvBuf;
+	recvRequest.bufferCount = 1;
+	CHECK(CompletionPort::PostRecv(fds[0], &recvRequest));
+
+	// two buffers go out as one gather send
+	char hello[] = "hello, ";
+	char world[] = "world";
+	WSABUF sendBufs[2] = { { 7, hello }, { 5, world } };
+	IoRequest sendRequest;
+	sendRequest.buffers = sendBufs;
+	sendRequest.bufferCount = 2;
+	CHECK(CompletionPort::PostSend(fds[1], &sendRequest));
+
+	bool received = false, sent = false;
+	CompletionEntry entry;
+	for (int i = 0; i < 2 && port.Dequeue(entry, 1000); ++i)
+	{
+		if (entry.lpRequest == &recvRequest)
+		{
+			received = entry.completionKey == 1 && entry.dwBytesTransferred == 12;
+			CHECK(memcmp(recvData, "hello, world", 12) == 0);
+		}
+		else if (entry.lpRequest == &sendRequest)
+		{
+			sent = entry.completionKey == 2 && entry.dwBytesTransferred == 12;
+		}
+	}
+	CHECK(received);
+	CHECK(sent);
+
+	// a receive still parked when the socket leaves the port comes back failed
+	CHECK(CompletionPort::PostRecv(fds[0], &recvRequest));
+	port.Dissociate(fds[0]);
+	entry = CompletionEntry();
+	CHECK(!port.Dequeue(entry, 1000));
+	CHECK(entry.lpRequest == &recvRequest && !entry.success);
+
+	port.Dissociate(fds[1]);
+	close(fds[0]);
+	close(fds[1]);
+}
+
+int main()
+{
+	TestPostAndTimeout();
+	TestWorkers();
+	TestSocketIo();
+
+	if (failures != 0)
+	{
+		printf("%d checks failed\n", failures);
+		return 1;
+	}
+	printf("all checks passed\n");
+	return 0;
+}
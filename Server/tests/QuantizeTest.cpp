@@ -0,0 +1,221 @@
+#include <cstdio>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include "Quantize.h"
+
+// one step of a QUANT_POSITION_BITS coordinate is 2 * bound / (2^21 - 1); a value is off by at
+// most half of it, plus float rounding near bound
+#define POSITION_TOLERANCE(bound) ((bound) / ((1 << QUANT_POSITION_BITS) - 1) + (bound) * 1e-6f)
+// 10 bits over +-0.7071 per component, the dropped one rebuilt from them; the measured worst
+// case is about 0.24 degrees
+#define ROTATION_TOLERANCE 0.3
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+			++failures; \
+		} \
+	} while (0)
+
+static state::Vector3Proto Vector(float x, float y, float z)
+{
+	state::Vector3Proto vector;
+	vector.set_x(x);
+	vector.set_y(y);
+	vector.set_z(z);
+	return vector;
+}
+
+static float PositionError(const state::Vector3Proto& position, float bound)
+{
+	state::Vector3Proto decoded;
+	UnpackPosition(PackPosition(position, bound), bound, &decoded);
+	return fmaxf(fabsf(position.x() - decoded.x()), fmaxf(fabsf(position.y() - decoded.y()), fabsf(position.z() - decoded.z())));
+}
+
+// Euler angles in degrees to (x, y, z, w), in the order PackRotation applies them
+static void ToQuaternion(const state::Vector3Proto& euler, double q[4])
+{
+	double half = 3.14159265358979323846 / 360.0;
+	double cx = cos(euler.x() * half), sx = sin(euler.x() * half);
+	double cy = cos(euler.y() * half), sy = sin(euler.y() * half);
+	double cz = cos(euler.z() * half), sz = sin(euler.z() * half);
+	q[0] = sx * cy * cz + cx * sy * sz;
+	q[1] = cx * sy * cz - sx * cy * sz;
+	q[2] = cx * cy * sz - sx * sy * cz;
+	q[3] = cx * cy * cz + sx * sy * sz;
+}
+
+// degrees between two rotations
+static double RotationError(const state::Vector3Proto& a, const state::Vector3Proto& b)
+{
+	double qa[4], qb[4];
+	ToQuaternion(a, qa);
+	ToQuaternion(b, qb);
+	double dot = fabs(qa[0] * qb[0] + qa[1] * qb[1] + qa[2] * qb[2] + qa[3] * qb[3]);
+	if (dot > 1.0)
+		dot = 1.0;
+	return 2.0 * acos(dot) * 180.0 / 3.14159265358979323846;
+}
+
+static double RoundTripRotation(const state::Vector3Proto& euler)
+{
+	state::Vector3Proto decoded;
+	UnpackRotation(PackRotation(euler), &decoded);
+	return RotationError(euler, decoded);
+}
+
+static void TestPosition()
+{
+	const float bounds[] = { 1024.0f, 100.0f, 4096.0f };
+	for (float bound : bounds)
+	{
+		// the corners and the center of the cube
+		for (float x : { -bound, 0.0f, bound })
+		{
+			for (float z : { -bound, bound })
+				CHECK(PositionError(Vector(x, -bound, z), bound) <= POSITION_TOLERANCE(bound));
+		}
+
+		std::mt19937 rng(1);
+		std::uniform_real_distribution<float> coordinate(-bound, bound);
+		float maxError = 0.0f;
+		for (int i = 0; i < 100000; ++i)
+			maxError = fmaxf(maxError, PositionError(Vector(coordinate(rng), coordinate(rng), coordinate(rng)), bound));
+		printf("bound %g: max position error %g\n", bound, maxError);
+		CHECK(maxError <= POSITION_TOLERANCE(bound));
+	}
+}
+
+static void TestPositionClamp()
+{
+	const float bound = 1024.0f;
+	const float inf = std::numeric_limits<float>::infinity();
+	const float nan = std::numeric_limits<float>::quiet_NaN();
+	state::Vector3Proto decoded;
+
+	UnpackPosition(PackPosition(Vector(5000.0f, -5000.0f, inf), bound), bound, &decoded);
+	CHECK(decoded.x() == bound);
+	CHECK(decoded.y() == -bound);
+	CHECK(decoded.z() == bound);
+
+	UnpackPosition(PackPosition(Vector(-inf, nan, 0.0f), bound), bound, &decoded);
+	CHECK(decoded.x() == -bound);
+	CHECK(decoded.y() == -bound);
+	CHECK(fabsf(decoded.z()) <= POSITION_TOLERANCE(bound));
+
+	// a clamped coordinate does not spill into its neighbours' bits
+	CHECK(PackPosition(Vector(bound * 2, -bound * 2, bound * 2), bound) == PackPosition(Vector(bound, -bound, bound), bound));
+}
+
+static void TestRotation()
+{
+	// +-180 degrees on each axis and together
+	for (float angle : { -180.0f, 180.0f })
+	{
+		CHECK(RoundTripRotation(Vector(angle, 0.0f, 0.0f)) <= ROTATION_TOLERANCE);
+		CHECK(RoundTripRotation(Vector(0.0f, angle, 0.0f)) <= ROTATION_TOLERANCE);
+		CHECK(RoundTripRotation(Vector(0.0f, 0.0f, angle)) <= ROTATION_TOLERANCE);
+		CHECK(RoundTripRotation(Vector(angle, angle, angle)) <= ROTATION_TOLERANCE);
+		CHECK(RoundTripRotation(Vector(angle, -angle, 45.0f)) <= ROTATION_TOLERANCE);
+	}
+	CHECK(RoundTripRotation(Vector(0.0f, 0.0f, 0.0f)) <= ROTATION_TOLERANCE);
+	CHECK(RoundTripRotation(Vector(360.0f, -360.0f, 720.0f)) <= ROTATION_TOLERANCE);
+
+	// back in Euler angles the error grows near x = +-90 (see Quantize.h), so x stays clear of it
+	std::mt19937 rng(2);
+	std::uniform_real_distribution<float> pitch(-80.0f, 80.0f), angle(-180.0f, 180.0f);
+	double maxError = 0.0;
+	for (int i = 0; i < 100000; ++i)
+		maxError = fmax(maxError, RoundTripRotation(Vector(pitch(rng), angle(rng), angle(rng))));
+	printf("max rotation error %g degrees\n", maxError);
+	CHECK(maxError <= ROTATION_TOLERANCE);
+}
+
+static void TestRotationNotFinite()
+{
+	const float inf = std::numeric_limits<float>::infinity();
+	const float nan = std::numeric_limits<float>::quiet_NaN();
+	uint32_t none = PackRotation(Vector(0.0f, 0.0f, 0.0f));
+
+	CHECK(PackRotation(Vector(nan, 0.0f, 0.0f)) == none);
+	CHECK(PackRotation(Vector(10.0f, nan, 20.0f)) == none);
+	CHECK(PackRotation(Vector(0.0f, 0.0f, inf)) == none);
+	CHECK(PackRotation(Vector(-inf, nan, inf)) == none);
+
+	state::Vector3Proto decoded;
+	UnpackRotation(none, &decoded);
+	CHECK(std::isfinite(decoded.x()) && std::isfinite(decoded.y()) && std::isfinite(decoded.z()));
+	CHECK(RotationError(decoded, Vector(0.0f, 0.0f, 0.0f)) <= ROTATION_TOLERANCE);
+}
+
+static void TestCompactTransform()
+{
+	const float bound = 1024.0f;
+	state::TransformProto transform;
+	*transform.mutable_position() = Vector(12.5f, -3.25f, 1000.0f);
+	*transform.mutable_rotation() = Vector(30.0f, -180.0f, 75.0f);
+	*transform.mutable_scale() = Vector(1.0f, 1.0f, 1.0f);
+
+	// tag and 8 bytes of position, tag and 4 bytes of rotation, no scale
+	state::CompactTransform compact;
+	PackTransform(transform, bound, &compact);
+	std::string wire = compact.SerializeAsString();
+	CHECK(wire.size() == 14);
+
+	state::CompactTransform received;
+	CHECK(received.ParseFromString(wire));
+	state::TransformProto decoded;
+	UnpackTransform(received, bound, &decoded);
+	CHECK(PositionError(transform.position(), bound) <= POSITION_TOLERANCE(bound));
+	CHECK(fabsf(decoded.position().x() - 12.5f) <= POSITION_TOLERANCE(bound));
+	CHECK(fabsf(decoded.position().z() - 1000.0f) <= POSITION_TOLERANCE(bound));
+	CHECK(RotationError(decoded.rotation(), transform.rotation()) <= ROTATION_TOLERANCE);
+	CHECK(IsUnitScale(decoded.scale()));
+
+	// a scale other than (1, 1, 1) goes out as it is
+	*transform.mutable_scale() = Vector(2.0f, 0.5f, 1.0f);
+	PackTransform(transform, bound, &compact);
+	CHECK(received.ParseFromString(compact.SerializeAsString()));
+	UnpackTransform(received, bound, &decoded);
+	CHECK(decoded.scale().x() == 2.0f && decoded.scale().y() == 0.5f && decoded.scale().z() == 1.0f);
+
+	// the -bound corner packs to 0 and is still sent
+	state::TransformProto corner;
+	*corner.mutable_position() = Vector(-bound, -bound * 3, -bound);
+	PackTransform(corner, bound, &compact);
+	CHECK(compact.position() == 0);
+	CHECK(received.ParseFromString(compact.SerializeAsString()));
+	CHECK(received.has_position() && !received.has_rotation() && !received.has_scale());
+	UnpackTransform(received, bound, &decoded);
+	CHECK(decoded.position().x() == -bound && decoded.position().y() == -bound && decoded.position().z() == -bound);
+
+	// a delta with the rotation alone
+	state::TransformProto rotationOnly;
+	*rotationOnly.mutable_rotation() = Vector(0.0f, 90.0f, 0.0f);
+	PackTransform(rotationOnly, bound, &compact);
+	CHECK(received.ParseFromString(compact.SerializeAsString()));
+	CHECK(!received.has_position() && received.has_rotation());
+}
+
+int main()
+{
+	TestPosition();
+	TestPositionClamp();
+	TestRotation();
+	TestRotationNotFinite();
+	TestCompactTransform();
+
+	if (failures != 0)
+	{
+		printf("%d checks failed\n", failures);
+		return 1;
+	}
+	printf("all checks passed\n");
+	return 0;
+}